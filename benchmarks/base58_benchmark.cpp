@@ -0,0 +1,229 @@
+// Compares the Base58 codec with the former digit-at-a-time implementation
+// for address, WIF and XEP-2 sized payloads, and address conversion as
+// Hash160::toAddress / fromAddress do it now and did before.
+//
+// Usage:
+//   base58_benchmark [seconds-per-case]
+
+#include <epicchaincpp/utils/base58.hpp>
+#include <epicchaincpp/utils/address.hpp>
+#include <epicchaincpp/crypto/hash.hpp>
+#include <epicchaincpp/types/hash160.hpp>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+using namespace epicchaincpp;
+
+namespace {
+
+const char* kAlphabet = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+/// Base58 encoding as it was done before limbs
+std::string formerEncode(const Bytes& data) {
+    size_t zeros = 0;
+    while (zeros < data.size() && data[zeros] == 0) {
+        zeros++;
+    }
+    std::vector<uint8_t> buffer(data.size() * 138 / 100 + 1);
+    size_t length = 0;
+    for (uint8_t byte : data) {
+        int carry = byte;
+        for (size_t i = 0; i < length || carry; ++i) {
+            carry += 256 * buffer[i];
+            buffer[i] = carry % 58;
+            carry /= 58;
+            if (i >= length) {
+                length = i + 1;
+            }
+        }
+    }
+    std::string result(zeros, '1');
+    for (size_t i = 0; i < length; ++i) {
+        result += kAlphabet[buffer[length - 1 - i]];
+    }
+    return result;
+}
+
+/// Base58 decoding as it was done before the lookup table
+Bytes formerDecode(const std::string& encoded) {
+    size_t zeros = 0;
+    while (zeros < encoded.size() && encoded[zeros] == '1') {
+        zeros++;
+    }
+    std::vector<uint8_t> buffer(encoded.size() * 733 / 1000 + 1);
+    size_t length = 0;
+    for (char c : encoded) {
+        const char* p = std::strchr(kAlphabet, c);
+        if (p == nullptr) {
+            return Bytes();
+        }
+        int carry = static_cast<int>(p - kAlphabet);
+        for (size_t i = 0; i < length || carry; ++i) {
+            carry += 58 * buffer[i];
+            buffer[i] = carry % 256;
+            carry /= 256;
+            if (i >= length) {
+                length = i + 1;
+            }
+        }
+    }
+    Bytes result(zeros, 0);
+    for (size_t i = 0; i < length; ++i) {
+        result.push_back(buffer[length - 1 - i]);
+    }
+    return result;
+}
+
+Bytes formerChecksum(const Bytes& data) {
+    Bytes hash = HashUtils::doubleSha256(data);
+    return Bytes(hash.begin(), hash.begin() + 4);
+}
+
+std::string formerEncodeCheck(const Bytes& data) {
+    Bytes withChecksum = data;
+    Bytes checksum = formerChecksum(data);
+    withChecksum.insert(withChecksum.end(), checksum.begin(), checksum.end());
+    return formerEncode(withChecksum);
+}
+
+Bytes formerDecodeCheck(const std::string& encoded) {
+    Bytes decoded = formerDecode(encoded);
+    if (decoded.size() < 4) {
+        return Bytes();
+    }
+    Bytes data(decoded.begin(), decoded.end() - 4);
+    Bytes checksum = formerChecksum(data);
+    if (!std::equal(checksum.begin(), checksum.end(), decoded.end() - 4)) {
+        return Bytes();
+    }
+    return data;
+}
+
+/// Address to script hash as it was done before: validate, then decode again
+Bytes formerAddressToScriptHash(const std::string& address) {
+    Bytes validated = formerDecodeCheck(address);
+    if (address.size() != 34 || validated.size() != 21 || validated[0] != AddressUtils::getAddressVersion()) {
+        return Bytes();
+    }
+    Bytes decoded = formerDecodeCheck(address);
+    return Bytes(decoded.begin() + 1, decoded.end());
+}
+
+/// Run body over the inputs repeatedly for about the given time and return calls per second
+template<typename Input, typename Body>
+double rate(double seconds, const std::vector<Input>& inputs, Body body) {
+    size_t calls = 0;
+    size_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0;
+    while (elapsed < seconds) {
+        for (const auto& input : inputs) {
+            sink += body(input);
+        }
+        calls += inputs.size();
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    volatile size_t keep = sink;
+    (void)keep;
+    return calls / elapsed;
+}
+
+void report(const std::string& label, double former, double current) {
+    std::cout << "  " << std::left << std::setw(22) << label
+              << std::right << std::fixed << std::setprecision(0)
+              << std::setw(12) << former << " /s former"
+              << std::setw(12) << current << " /s now"
+              << std::setprecision(2)
+              << std::setw(8) << current / former << "x"
+              << std::endl;
+}
+
+std::vector<Bytes> payloads(size_t count, size_t length, uint8_t prefix) {
+    std::vector<Bytes> result;
+    for (size_t i = 0; i < count; ++i) {
+        Bytes data(length);
+        data[0] = prefix;
+        for (size_t j = 1; j < length; ++j) {
+            data[j] = static_cast<uint8_t>(i * 131 + j * 17);
+        }
+        result.push_back(data);
+    }
+    return result;
+}
+
+void benchmarkPayload(const std::string& name, size_t length, uint8_t prefix, double seconds) {
+    auto data = payloads(256, length, prefix);
+    std::vector<std::string> encoded;
+    for (const auto& payload : data) {
+        encoded.push_back(Base58::encodeCheck(payload));
+    }
+    
+    std::cout << name << " (" << length << " bytes + checksum)" << std::endl;
+    report("encodeCheck",
+           rate(seconds, data, [](const Bytes& payload) { return formerEncodeCheck(payload).size(); }),
+           rate(seconds, data, [](const Bytes& payload) { return Base58::encodeCheck(payload).size(); }));
+    report("decodeCheck",
+           rate(seconds, encoded, [](const std::string& text) { return formerDecodeCheck(text).size(); }),
+           rate(seconds, encoded, [](const std::string& text) { return Base58::decodeCheck(text).size(); }));
+    report("tryDecodeCheck",
+           rate(seconds, encoded, [](const std::string& text) { return formerDecodeCheck(text).size(); }),
+           rate(seconds, encoded, [length](const std::string& text) {
+               uint8_t out[64];
+               return static_cast<size_t>(Base58::tryDecodeCheck(text, out, length));
+           }));
+}
+
+void benchmarkAddresses(double seconds) {
+    std::vector<Hash160> hashes;
+    for (const auto& payload : payloads(256, 20, 0x5a)) {
+        hashes.emplace_back(payload);
+    }
+    std::vector<std::string> addresses;
+    for (const auto& hash : hashes) {
+        addresses.push_back(hash.toAddress());
+    }
+    
+    std::cout << "Addresses" << std::endl;
+    report("Hash160::toAddress",
+           rate(seconds, hashes, [](const Hash160& hash) {
+               Bytes data = hash.toArray();
+               data.insert(data.begin(), AddressUtils::getAddressVersion());
+               return formerEncodeCheck(data).size();
+           }),
+           rate(seconds, hashes, [](const Hash160& hash) { return hash.toAddress().size(); }));
+    report("Hash160::fromAddress",
+           rate(seconds, addresses, [](const std::string& address) {
+               return static_cast<size_t>(Hash160(formerAddressToScriptHash(address)).toArray()[0]);
+           }),
+           rate(seconds, addresses, [](const std::string& address) {
+               return static_cast<size_t>(Hash160::fromAddress(address).toArray()[0]);
+           }));
+    report("isValidAddress",
+           rate(seconds, addresses, [](const std::string& address) {
+               return formerDecodeCheck(address).size();
+           }),
+           rate(seconds, addresses, [](const std::string& address) {
+               return static_cast<size_t>(AddressUtils::isValidAddress(address));
+           }));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        double seconds = argc >= 2 ? std::stod(argv[1]) : 0.3;
+        benchmarkPayload("Address", 21, 0x35, seconds);
+        benchmarkPayload("WIF", 34, 0x80, seconds);
+        benchmarkPayload("XEP-2", 39, 0x01, seconds);
+        benchmarkPayload("Extended key", 78, 0x04, seconds);
+        benchmarkAddresses(seconds);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,166 @@
+// Measures HashUtils::sha256Many and hash160Many with each kernel the CPU
+// supports, against hashing one message at a time, for transaction-sized
+// messages and single-signature verification scripts.
+//
+// Usage:
+//   batch_hash_benchmark [messages]
+
+#include <epicchaincpp/crypto/hash.hpp>
+#include <epicchaincpp/crypto/ec_key_pair.hpp>
+#include <epicchaincpp/script/script_builder.hpp>
+#include <epicchaincpp/transaction/transaction.hpp>
+#include <epicchaincpp/transaction/signer.hpp>
+#include <epicchaincpp/types/hash160.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+using namespace epicchaincpp;
+
+namespace {
+
+using Kernel = HashUtils::HashKernel;
+
+const char* kernelName(Kernel kernel) {
+    switch (kernel) {
+        case Kernel::Scalar: return "scalar";
+        case Kernel::ShaNi: return "sha-ni";
+        case Kernel::Avx2: return "avx2 x8";
+        case Kernel::Avx512: return "avx512 x16";
+        default: return "auto";
+    }
+}
+
+std::vector<Kernel> supportedKernels() {
+    std::vector<Kernel> kernels;
+    for (Kernel kernel : {Kernel::Scalar, Kernel::ShaNi, Kernel::Avx2, Kernel::Avx512}) {
+        if (HashUtils::isKernelSupported(kernel)) {
+            kernels.push_back(kernel);
+        }
+    }
+    return kernels;
+}
+
+/// Seconds per call of body, best of a few runs
+template<typename Body>
+double time(Body body) {
+    double best = 1e9;
+    for (int run = 0; run < 5; ++run) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+void report(const std::string& label, size_t count, double seconds, double baseline) {
+    std::cout << "  " << std::left << std::setw(22) << label
+              << std::right << std::fixed << std::setprecision(0)
+              << std::setw(12) << count / seconds << " hash/s"
+              << std::setprecision(2)
+              << std::setw(8) << baseline / seconds << "x"
+              << std::endl;
+}
+
+void benchmarkSha256(size_t count, size_t length) {
+    std::vector<Bytes> messages(count, Bytes(length));
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t j = 0; j < length; ++j) {
+            messages[i][j] = static_cast<uint8_t>(i + j);
+        }
+    }
+    std::vector<ByteSpan> inputs(messages.begin(), messages.end());
+    std::vector<Digest256> outputs(count);
+    
+    std::cout << "sha256 of " << count << " x " << length << " B" << std::endl;
+    double baseline = time([&] {
+        for (size_t i = 0; i < count; ++i) {
+            HashUtils::sha256(messages[i].data(), messages[i].size(), outputs[i]);
+        }
+    });
+    report("one at a time", count, baseline, baseline);
+    for (Kernel kernel : supportedKernels()) {
+        double seconds = time([&] { HashUtils::sha256Many(inputs.data(), outputs.data(), count, kernel); });
+        report(std::string("sha256Many ") + kernelName(kernel), count, seconds, baseline);
+    }
+}
+
+void benchmarkHash160(size_t count) {
+    std::vector<Bytes> keys;
+    for (size_t i = 0; i < 64; ++i) {
+        keys.push_back(ECKeyPair::generate().getPublicKey()->getEncoded());
+    }
+    std::vector<Bytes> scripts;
+    for (size_t i = 0; i < count; ++i) {
+        scripts.push_back(ScriptBuilder::buildVerificationScript(keys[i % keys.size()]));
+    }
+    std::vector<ByteSpan> inputs(scripts.begin(), scripts.end());
+    std::vector<Digest160> outputs(count);
+    
+    std::cout << "hash160 of " << count << " verification scripts" << std::endl;
+    double baseline = time([&] {
+        for (size_t i = 0; i < count; ++i) {
+            HashUtils::sha256ThenRipemd160(scripts[i].data(), scripts[i].size(), outputs[i]);
+        }
+    });
+    report("one at a time", count, baseline, baseline);
+    for (Kernel kernel : supportedKernels()) {
+        double seconds = time([&] { HashUtils::hash160Many(inputs.data(), outputs.data(), count, kernel); });
+        report(std::string("hash160Many ") + kernelName(kernel), count, seconds, baseline);
+    }
+    double seconds = time([&] { Hash160::fromScripts(scripts); });
+    report("Hash160::fromScripts", count, seconds, baseline);
+}
+
+void benchmarkTransactions(size_t count) {
+    std::vector<SharedPtr<Transaction>> transactions;
+    for (size_t i = 0; i < count; ++i) {
+        auto tx = std::make_shared<Transaction>();
+        tx->setNonce(static_cast<uint32_t>(i));
+        tx->setSystemFee(997775);
+        tx->setNetworkFee(122862);
+        tx->setValidUntilBlock(5760);
+        tx->setScript(Bytes(100 + i % 200, 0x0c));
+        tx->addSigner(std::make_shared<Signer>(Hash160(Bytes(20, 0x5a)), WitnessScope::CALLED_BY_ENTRY));
+        transactions.push_back(tx);
+    }
+    
+    std::cout << "transaction ids of " << count << " transactions" << std::endl;
+    double baseline = time([&] {
+        for (const auto& tx : transactions) {
+            tx->calculateHash();
+        }
+    });
+    report("calculateHash each", count, baseline, baseline);
+    double seconds = 1e9;
+    for (int run = 0; run < 5; ++run) {
+        // Drop the cached hashes, since calculateHashes skips those
+        for (const auto& tx : transactions) {
+            tx->setNonce(tx->getNonce());
+        }
+        auto start = std::chrono::steady_clock::now();
+        Transaction::calculateHashes(transactions);
+        seconds = std::min(seconds, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    report("calculateHashes", count, seconds, baseline);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        size_t count = argc >= 2 ? std::stoul(argv[1]) : 100000;
+        std::cout << "Preferred kernel: " << kernelName(HashUtils::preferredKernel()) << std::endl;
+        benchmarkSha256(count, 32);
+        benchmarkSha256(count, 250);
+        benchmarkSha256(count / 10, 4096);
+        benchmarkHash160(count);
+        benchmarkTransactions(count / 10);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,220 @@
+// Compares decoding verbose (JSON) blocks with decoding raw (base64) blocks.
+//
+// Usage:
+//   block_decode_benchmark                          synthetic blocks
+//   block_decode_benchmark <rpc-url> <start> <count> blocks fetched from a node
+
+#include <epicchaincpp/protocol/core/block.hpp>
+#include <epicchaincpp/protocol/response_types_impl.hpp>
+#include <epicchaincpp/protocol/http_service.hpp>
+#include <epicchaincpp/transaction/transaction.hpp>
+#include <epicchaincpp/transaction/transaction_attribute.hpp>
+#include <epicchaincpp/transaction/signer.hpp>
+#include <epicchaincpp/transaction/witness.hpp>
+#include <epicchaincpp/serialization/binary_writer.hpp>
+#include <epicchaincpp/utils/base64.hpp>
+#include <nlohmann/json.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+using namespace epicchaincpp;
+
+namespace {
+
+struct Sample {
+    std::string verbose;
+    std::string raw;
+};
+
+struct Result {
+    double seconds = 0;
+    size_t bytes = 0;
+    size_t transactions = 0;
+};
+
+nlohmann::json witnessJson(const Witness& witness) {
+    return {
+        {"invocation", Base64::encode(witness.getInvocationScript())},
+        {"verification", Base64::encode(witness.getVerificationScript())}
+    };
+}
+
+SharedPtr<Transaction> makeTransaction(uint32_t nonce) {
+    auto tx = std::make_shared<Transaction>();
+    tx->setNonce(nonce);
+    tx->setSystemFee(997775);
+    tx->setNetworkFee(122862);
+    tx->setValidUntilBlock(5760);
+    // Typical transfer-sized script
+    tx->setScript(Bytes(100, 0x0c));
+    tx->addSigner(std::make_shared<Signer>(Hash160(Bytes(20, 0x5a)), WitnessScope::CALLED_BY_ENTRY));
+    tx->addWitness(std::make_shared<Witness>(Bytes(66, 0x0c), Bytes(40, 0x21)));
+    return tx;
+}
+
+/// Build the same block in both wire formats
+Sample makeSample(uint32_t index, size_t txCount) {
+    std::vector<SharedPtr<Transaction>> txs;
+    for (size_t i = 0; i < txCount; ++i) {
+        txs.push_back(makeTransaction(index * 1000 + static_cast<uint32_t>(i)));
+    }
+    Witness blockWitness(Bytes(66 * 5, 0x0c), Bytes(250, 0x21));
+
+    BinaryWriter writer;
+    writer.writeUInt32(0);
+    writer.writeBytes(Bytes(32, 0x11));
+    writer.writeBytes(Bytes(32, 0x22));
+    writer.writeUInt64(1700000000000ULL + index);
+    writer.writeUInt64(index);
+    writer.writeUInt32(index);
+    writer.writeUInt8(0);
+    writer.writeBytes(Bytes(20, 0x33));
+    writer.writeVarInt(1);
+    blockWitness.serialize(writer);
+    writer.writeVarInt(txs.size());
+    for (const auto& tx : txs) {
+        tx->serialize(writer);
+    }
+    Bytes raw = writer.toArray();
+
+    auto block = Block::fromBase64(Base64::encode(raw));
+    const auto& header = block->getHeader();
+    nlohmann::json txJson = nlohmann::json::array();
+    for (const auto& tx : txs) {
+        nlohmann::json signers = nlohmann::json::array();
+        for (const auto& signer : tx->getSigners()) {
+            signers.push_back({{"account", signer->getAccount().toString()}, {"scopes", "CalledByEntry"}});
+        }
+        nlohmann::json witnesses = nlohmann::json::array();
+        for (const auto& witness : tx->getWitnesses()) {
+            witnesses.push_back(witnessJson(*witness));
+        }
+        txJson.push_back({
+            {"hash", tx->getHash().toString()},
+            {"size", tx->getSize()},
+            {"version", tx->getVersion()},
+            {"nonce", tx->getNonce()},
+            {"sender", signers[0]["account"]},
+            {"sysfee", std::to_string(tx->getSystemFee())},
+            {"netfee", std::to_string(tx->getNetworkFee())},
+            {"validuntilblock", tx->getValidUntilBlock()},
+            {"signers", signers},
+            {"attributes", nlohmann::json::array()},
+            {"script", Base64::encode(tx->getScript())},
+            {"witnesses", witnesses}
+        });
+    }
+    nlohmann::json verbose = {
+        {"hash", block->getHash().toString()},
+        {"size", raw.size()},
+        {"version", 0},
+        {"previousblockhash", header->getPreviousHash().toString()},
+        {"merkleroot", header->getMerkleRoot().toString()},
+        {"time", header->getTimestamp()},
+        {"nonce", "0000000000000000"},
+        {"index", index},
+        {"primary", 0},
+        {"nextconsensus", header->getNextConsensus().toAddress()},
+        {"witnesses", nlohmann::json::array({witnessJson(blockWitness)})},
+        {"tx", txJson},
+        {"confirmations", 1}
+    };
+
+    return {verbose.dump(), nlohmann::json(Base64::encode(raw)).dump()};
+}
+
+/// Fetch a block from a node in both formats
+Sample fetchSample(HttpService& http, uint32_t index) {
+    Sample sample;
+    for (bool verbose : {true, false}) {
+        nlohmann::json request = {
+            {"jsonrpc", "2.0"}, {"id", 1}, {"method", "getblock"}, {"params", {index, verbose}}
+        };
+        nlohmann::json response = http.post(request);
+        (verbose ? sample.verbose : sample.raw) = response.at("result").dump();
+    }
+    return sample;
+}
+
+/// Decode verbose blocks the way a consumer would: parse the text, then pull
+/// out the per-transaction fields that the binary path yields natively.
+Result decodeVerbose(const std::vector<Sample>& samples) {
+    Result result;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& sample : samples) {
+        EpicChainGetBlockResponse response;
+        response.parseJson(nlohmann::json::parse(sample.verbose));
+        for (const auto& tx : response.getTransactions()) {
+            Hash256 hash = Hash256::fromHexString(tx["hash"].get<std::string>());
+            Bytes script = Base64::decode(tx["script"].get<std::string>());
+            (void)hash;
+            (void)script;
+            ++result.transactions;
+        }
+        result.bytes += sample.verbose.size();
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+Result decodeRaw(const std::vector<Sample>& samples) {
+    Result result;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& sample : samples) {
+        EpicChainGetBlockResponse response;
+        response.parseJson(nlohmann::json::parse(sample.raw));
+        for (const auto& tx : response.getBlock()->getTransactions()) {
+            (void)tx->getHash();
+            ++result.transactions;
+        }
+        result.bytes += sample.raw.size();
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+void report(const std::string& label, const Result& result, size_t blocks) {
+    std::cout << std::left << std::setw(10) << label
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << blocks / result.seconds << " blocks/s"
+              << std::setw(12) << result.transactions / result.seconds << " tx/s"
+              << std::setw(12) << result.bytes / 1024.0 << " KiB on the wire"
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        std::vector<Sample> samples;
+        if (argc >= 4) {
+            HttpService http(argv[1]);
+            uint32_t start = static_cast<uint32_t>(std::stoul(argv[2]));
+            uint32_t count = static_cast<uint32_t>(std::stoul(argv[3]));
+            for (uint32_t i = 0; i < count; ++i) {
+                samples.push_back(fetchSample(http, start + i));
+            }
+        } else {
+            const size_t blockCount = 200;
+            const size_t txPerBlock = 500;
+            for (size_t i = 0; i < blockCount; ++i) {
+                samples.push_back(makeSample(static_cast<uint32_t>(i), txPerBlock));
+            }
+        }
+
+        Result verbose = decodeVerbose(samples);
+        Result raw = decodeRaw(samples);
+
+        std::cout << "Decoded " << samples.size() << " blocks" << std::endl;
+        report("verbose", verbose, samples.size());
+        report("binary", raw, samples.size());
+        std::cout << "Speedup: " << std::setprecision(2) << verbose.seconds / raw.seconds << "x" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
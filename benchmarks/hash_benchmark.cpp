@@ -0,0 +1,130 @@
+// Measures HashUtils throughput from 32-byte to 1 MB inputs: a fresh OpenSSL
+// context and heap result per call (the former implementation), the Bytes
+// overloads, and the fixed-size digest overloads. Also compares transaction
+// hashing via getHashData() with hashing while serializing.
+//
+// Usage:
+//   hash_benchmark [seconds-per-case]
+
+#include <epicchaincpp/crypto/hash.hpp>
+#include <epicchaincpp/transaction/transaction.hpp>
+#include <epicchaincpp/transaction/signer.hpp>
+#include <epicchaincpp/transaction/witness.hpp>
+#include <openssl/evp.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+using namespace epicchaincpp;
+
+namespace {
+
+/// SHA256 as it was done before pooled contexts
+Bytes sha256FreshContext(const Bytes& data) {
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    Bytes result(32);
+    unsigned int len = 32;
+    EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr);
+    EVP_DigestUpdate(ctx, data.data(), data.size());
+    EVP_DigestFinal_ex(ctx, result.data(), &len);
+    EVP_MD_CTX_free(ctx);
+    return result;
+}
+
+/// Run body repeatedly for about the given time and return calls per second
+template<typename Body>
+double rate(double seconds, Body body) {
+    size_t calls = 0;
+    uint8_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0;
+    while (elapsed < seconds) {
+        for (int i = 0; i < 64; ++i) {
+            sink ^= body();
+        }
+        calls += 64;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    volatile uint8_t keep = sink;
+    (void)keep;
+    return calls / elapsed;
+}
+
+std::string sizeLabel(size_t size) {
+    if (size >= 1024 * 1024) {
+        return std::to_string(size / (1024 * 1024)) + " MB";
+    }
+    if (size >= 1024) {
+        return std::to_string(size / 1024) + " KB";
+    }
+    return std::to_string(size) + " B";
+}
+
+void report(const std::string& label, double perSecond, size_t bytes) {
+    std::cout << "  " << std::left << std::setw(24) << label
+              << std::right << std::fixed << std::setprecision(0)
+              << std::setw(12) << perSecond << " hash/s"
+              << std::setprecision(1)
+              << std::setw(10) << perSecond * bytes / (1024 * 1024) << " MiB/s"
+              << std::endl;
+}
+
+SharedPtr<Transaction> makeTransaction() {
+    auto tx = std::make_shared<Transaction>();
+    tx->setNonce(1);
+    tx->setSystemFee(997775);
+    tx->setNetworkFee(122862);
+    tx->setValidUntilBlock(5760);
+    tx->setScript(Bytes(100, 0x0c));
+    tx->addSigner(std::make_shared<Signer>(Hash160(Bytes(20, 0x5a)), WitnessScope::CALLED_BY_ENTRY));
+    tx->addWitness(std::make_shared<Witness>(Bytes(66, 0x0c), Bytes(40, 0x21)));
+    return tx;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        double seconds = argc >= 2 ? std::stod(argv[1]) : 0.3;
+        
+        for (size_t size : {size_t(32), size_t(256), size_t(4096), size_t(65536), size_t(1024 * 1024)}) {
+            Bytes data(size, 0xab);
+            std::cout << "Input " << sizeLabel(size) << std::endl;
+            
+            report("sha256 fresh context", rate(seconds, [&] { return sha256FreshContext(data)[0]; }), size);
+            report("sha256 Bytes", rate(seconds, [&] { return HashUtils::sha256(data)[0]; }), size);
+            report("sha256 Digest256", rate(seconds, [&] {
+                Digest256 hash;
+                HashUtils::sha256(data.data(), data.size(), hash);
+                return hash[0];
+            }), size);
+            report("doubleSha256 Digest256", rate(seconds, [&] {
+                Digest256 hash;
+                HashUtils::doubleSha256(data.data(), data.size(), hash);
+                return hash[0];
+            }), size);
+            report("hash160 Bytes", rate(seconds, [&] { return HashUtils::sha256ThenRipemd160(data)[0]; }), size);
+            report("hash160 Digest160", rate(seconds, [&] {
+                Digest160 hash;
+                HashUtils::sha256ThenRipemd160(data.data(), data.size(), hash);
+                return hash[0];
+            }), size);
+        }
+        
+        auto tx = makeTransaction();
+        size_t unsignedSize = tx->getUnsignedSize();
+        std::cout << "Transaction hash (" << unsignedSize << " unsigned bytes)" << std::endl;
+        report("former calculateHash", rate(seconds, [&] {
+            return static_cast<uint8_t>(Hash256(sha256FreshContext(tx->getHashData())) == Hash256());
+        }), unsignedSize);
+        report("calculateHash", rate(seconds, [&] {
+            return static_cast<uint8_t>(tx->calculateHash() == Hash256());
+        }), unsignedSize);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,120 @@
+// Compares the hex codec with the former stringstream / stoul implementation
+// from 20 bytes (a script hash) to 1 MB (a large NEF file), through both the
+// string API and the caller-buffer API.
+//
+// Usage:
+//   hex_benchmark [seconds-per-case]
+
+#include <epicchaincpp/utils/hex.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace epicchaincpp;
+
+namespace {
+
+/// Hex encoding as it was done before the lookup tables
+std::string formerEncode(const Bytes& data) {
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (const auto& byte : data) {
+        ss << std::setw(2) << static_cast<int>(byte);
+    }
+    return ss.str();
+}
+
+/// Hex decoding as it was done before the lookup tables
+Bytes formerDecode(const std::string& hex) {
+    Bytes result;
+    result.reserve(hex.length() / 2);
+    for (size_t i = 0; i < hex.length(); i += 2) {
+        std::string byteString = hex.substr(i, 2);
+        for (char c : byteString) {
+            if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))) {
+                return Bytes();
+            }
+        }
+        result.push_back(static_cast<uint8_t>(std::stoul(byteString, nullptr, 16)));
+    }
+    return result;
+}
+
+/// Run body repeatedly for about the given time and return calls per second
+template<typename Body>
+double rate(double seconds, Body body) {
+    size_t calls = 0;
+    size_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0;
+    while (elapsed < seconds) {
+        for (int i = 0; i < 16; ++i) {
+            sink += body();
+        }
+        calls += 16;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    volatile size_t keep = sink;
+    (void)keep;
+    return calls / elapsed;
+}
+
+std::string sizeLabel(size_t size) {
+    if (size >= 1024 * 1024) {
+        return std::to_string(size / (1024 * 1024)) + " MB";
+    }
+    if (size >= 1024) {
+        return std::to_string(size / 1024) + " KB";
+    }
+    return std::to_string(size) + " B";
+}
+
+void report(const std::string& label, double perSecond, size_t bytes, double baseline) {
+    std::cout << "  " << std::left << std::setw(20) << label
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << perSecond * bytes / (1024 * 1024) << " MiB/s"
+              << std::setprecision(2)
+              << std::setw(10) << perSecond / baseline << "x"
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        double seconds = argc >= 2 ? std::stod(argv[1]) : 0.3;
+        
+        for (size_t size : {size_t(20), size_t(32), size_t(256), size_t(4096), size_t(65536), size_t(1024 * 1024)}) {
+            Bytes data(size);
+            for (size_t i = 0; i < size; ++i) {
+                data[i] = static_cast<uint8_t>(i * 131 + 7);
+            }
+            std::string hex = Hex::encode(data);
+            std::string text(2 * size, '\0');
+            Bytes bytes(size);
+            std::cout << "Input " << sizeLabel(size) << std::endl;
+            
+            double former = rate(seconds, [&] { return formerEncode(data).size(); });
+            report("former encode", former, size, former);
+            report("encode", rate(seconds, [&] { return Hex::encode(data).size(); }), size, former);
+            report("encode into buffer", rate(seconds, [&] {
+                Hex::encode(data.data(), data.size(), &text[0]);
+                return static_cast<size_t>(text[0]);
+            }), size, former);
+            
+            former = rate(seconds, [&] { return formerDecode(hex).size(); });
+            report("former decode", former, size, former);
+            report("decode", rate(seconds, [&] { return Hex::decode(hex).size(); }), size, former);
+            report("decode into buffer", rate(seconds, [&] {
+                return static_cast<size_t>(Hex::tryDecode(hex.data(), hex.size(), bytes.data()));
+            }), size, former);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
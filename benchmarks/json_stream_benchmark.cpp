@@ -0,0 +1,352 @@
+// Compares buffered DOM parsing of large RPC responses with streaming them
+// through RpcResponseSax, measuring parse time and peak heap usage.
+//
+// Usage:
+//   json_stream_benchmark                     synthetic getblock/getapplicationlog responses
+//   json_stream_benchmark <response.json>...  recorded responses; arrays under "tx" and
+//                                             "executions/notifications" are streamed
+
+#include <epicchaincpp/protocol/rpc_response_sax.hpp>
+#include <epicchaincpp/protocol/response_types_impl.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <iterator>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace epicchaincpp;
+
+namespace {
+
+// Heap accounting through the global allocation functions below
+std::atomic<size_t> liveBytes{0};
+std::atomic<size_t> peakBytes{0};
+
+constexpr size_t kHeader = alignof(std::max_align_t);
+
+void* countedAlloc(size_t size) {
+    void* block = std::malloc(size + kHeader);
+    if (!block) {
+        throw std::bad_alloc();
+    }
+    *static_cast<size_t*>(block) = size;
+    size_t live = liveBytes.fetch_add(size) + size;
+    size_t peak = peakBytes.load();
+    while (live > peak && !peakBytes.compare_exchange_weak(peak, live)) {
+    }
+    return static_cast<char*>(block) + kHeader;
+}
+
+void countedFree(void* ptr) noexcept {
+    if (!ptr) {
+        return;
+    }
+    void* block = static_cast<char*>(ptr) - kHeader;
+    liveBytes.fetch_sub(*static_cast<size_t*>(block));
+    std::free(block);
+}
+
+/// Bytes the receive path holds at once: the HTTP layer hands the body over
+/// in pieces of at most this size.
+constexpr size_t kChunkSize = 16 * 1024;
+
+struct Sample {
+    std::string name;
+    std::string body;
+};
+
+struct Result {
+    double seconds = 0;
+    size_t peakBytes = 0;
+    size_t elements = 0;
+};
+
+std::string hex(size_t seed, size_t bytes) {
+    static const char digits[] = "0123456789abcdef";
+    std::string out = "0x";
+    for (size_t i = 0; i < bytes * 2; ++i) {
+        out += digits[(seed * 31 + i * 7) & 0x0f];
+    }
+    return out;
+}
+
+/// A verbose getblock response shaped like a node's
+Sample makeBlock(size_t txCount) {
+    nlohmann::json txs = nlohmann::json::array();
+    for (size_t i = 0; i < txCount; ++i) {
+        txs.push_back({
+            {"hash", hex(i, 32)},
+            {"size", 252},
+            {"version", 0},
+            {"nonce", 1000 + i},
+            {"sender", "NiHURyS83nX2mpxtA7xq84cGxVbHojj5Wc"},
+            {"sysfee", "997775"},
+            {"netfee", "122862"},
+            {"validuntilblock", 5760},
+            {"signers", {{{"account", hex(i + 1, 20)}, {"scopes", "CalledByEntry"}}}},
+            {"attributes", nlohmann::json::array()},
+            {"script", std::string(136, 'D')},
+            {"witnesses", {{{"invocation", std::string(88, 'D')}, {"verification", std::string(56, 'D')}}}}
+        });
+    }
+    nlohmann::json result = {
+        {"hash", hex(0, 32)},
+        {"size", txCount * 252},
+        {"version", 0},
+        {"previousblockhash", hex(1, 32)},
+        {"merkleroot", hex(2, 32)},
+        {"time", 1700000000000ULL},
+        {"nonce", "0000000000000000"},
+        {"index", 1},
+        {"primary", 0},
+        {"nextconsensus", "NiHURyS83nX2mpxtA7xq84cGxVbHojj5Wc"},
+        {"witnesses", {{{"invocation", std::string(440, 'D')}, {"verification", std::string(336, 'D')}}}},
+        {"tx", txs},
+        {"confirmations", 1}
+    };
+    nlohmann::json response = {{"jsonrpc", "2.0"}, {"id", 1}, {"result", result}};
+    return {"getblock (" + std::to_string(txCount) + " tx)", response.dump()};
+}
+
+/// A getapplicationlog response with many Transfer notifications
+Sample makeApplicationLog(size_t notificationCount) {
+    nlohmann::json notifications = nlohmann::json::array();
+    for (size_t i = 0; i < notificationCount; ++i) {
+        notifications.push_back({
+            {"contract", hex(7, 20)},
+            {"eventname", "Transfer"},
+            {"state", {
+                {"type", "Array"},
+                {"value", {
+                    {{"type", "ByteString"}, {"value", std::string(28, 'A')}},
+                    {{"type", "ByteString"}, {"value", std::string(28, 'B')}},
+                    {{"type", "Integer"}, {"value", std::to_string(i * 100)}}
+                }}
+            }}
+        });
+    }
+    nlohmann::json result = {
+        {"txid", hex(3, 32)},
+        {"executions", {{
+            {"trigger", "Application"},
+            {"vmstate", "HALT"},
+            {"gasconsumed", "9977750"},
+            {"stack", nlohmann::json::array()},
+            {"notifications", notifications}
+        }}}
+    };
+    nlohmann::json response = {{"jsonrpc", "2.0"}, {"id", 1}, {"result", result}};
+    return {"applicationlog (" + std::to_string(notificationCount) + " notif.)", response.dump()};
+}
+
+Sample loadSample(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    std::ostringstream text;
+    text << file.rdbuf();
+    return {path, text.str()};
+}
+
+/// Delivers a body in kChunkSize pieces, like a curl write callback would
+class ChunkedBody {
+public:
+    explicit ChunkedBody(const std::string& body) : body_(body) {}
+    
+    template<typename Consumer>
+    void forEachChunk(Consumer&& consume) const {
+        std::vector<char> chunk(kChunkSize);
+        for (size_t offset = 0; offset < body_.size(); offset += kChunkSize) {
+            size_t size = std::min(kChunkSize, body_.size() - offset);
+            std::copy_n(body_.data() + offset, size, chunk.data());
+            consume(chunk.data(), size);
+        }
+    }
+
+private:
+    const std::string& body_;
+};
+
+/// Input iterator pulling the body chunk by chunk, holding one chunk at a time
+class ChunkIterator {
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = char;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const char*;
+    using reference = const char&;
+    
+    ChunkIterator() = default;
+    ChunkIterator(const std::string* body, std::vector<char>* chunk) : body_(body), chunk_(chunk) { refill(); }
+    
+    reference operator*() const { return (*chunk_)[pos_]; }
+    ChunkIterator& operator++() {
+        if (++pos_ == limit_) {
+            refill();
+        }
+        return *this;
+    }
+    bool operator==(const ChunkIterator& other) const { return done() == other.done(); }
+    bool operator!=(const ChunkIterator& other) const { return !(*this == other); }
+
+private:
+    const std::string* body_ = nullptr;
+    std::vector<char>* chunk_ = nullptr;
+    size_t offset_ = 0;
+    size_t pos_ = 0;
+    size_t limit_ = 0;
+    
+    bool done() const { return !body_ || pos_ == limit_; }
+    
+    void refill() {
+        size_t size = std::min(kChunkSize, body_->size() - offset_);
+        std::copy_n(body_->data() + offset_, size, chunk_->data());
+        offset_ += size;
+        pos_ = 0;
+        limit_ = size;
+    }
+};
+
+/// Typed fill matching the method the sample came from
+void fillTyped(const nlohmann::json& result) {
+    if (result.contains("tx")) {
+        EpicChainGetBlockResponse response;
+        response.parseJson(result);
+    } else {
+        EpicChainGetApplicationLogResponse response;
+        response.parseJson(result);
+    }
+}
+
+/// What a consumer does with each element: read a field or two, then drop it
+size_t touch(const nlohmann::json& element) {
+    auto it = element.find("hash");
+    if (it == element.end()) {
+        it = element.find("eventname");
+    }
+    return it == element.end() ? 0 : it->get_ref<const std::string&>().size();
+}
+
+/// The buffered path: accumulate the body, parse a DOM, then fill the response
+Result parseBuffered(const Sample& sample) {
+    size_t baseline = liveBytes.load();
+    peakBytes.store(baseline);
+    Result result;
+    auto start = std::chrono::steady_clock::now();
+    {
+        std::string body;
+        ChunkedBody(sample.body).forEachChunk([&](const char* data, size_t size) { body.append(data, size); });
+        nlohmann::json response = nlohmann::json::parse(body);
+        nlohmann::json& value = response["result"];
+        for (const char* name : {"tx", "executions"}) {
+            if (value.contains(name)) {
+                for (const auto& element : value[name]) {
+                    if (std::string(name) == "executions") {
+                        for (const auto& notification : element["notifications"]) {
+                            touch(notification);
+                            ++result.elements;
+                        }
+                    } else {
+                        touch(element);
+                        ++result.elements;
+                    }
+                }
+            }
+        }
+        fillTyped(std::move(value));
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.peakBytes = peakBytes.load() - baseline;
+    return result;
+}
+
+/// The streamed path: SAX-parse chunk by chunk and hand off large arrays
+Result parseStreamed(const Sample& sample) {
+    size_t baseline = liveBytes.load();
+    peakBytes.store(baseline);
+    Result result;
+    auto start = std::chrono::steady_clock::now();
+    {
+        std::vector<char> chunk(kChunkSize);
+        RpcResponseSax handler({"tx", "executions/notifications"}, [&](const std::string&, nlohmann::json&& element) {
+            touch(element);
+            ++result.elements;
+        });
+        nlohmann::json::sax_parse(ChunkIterator(&sample.body, &chunk), ChunkIterator(), &handler);
+        fillTyped(handler.takeResult());
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.peakBytes = peakBytes.load() - baseline;
+    return result;
+}
+
+template<typename Parse>
+Result measure(const Sample& sample, Parse parse, int rounds) {
+    Result best = parse(sample);
+    for (int i = 1; i < rounds; ++i) {
+        Result run = parse(sample);
+        best.seconds = std::min(best.seconds, run.seconds);
+        best.peakBytes = std::max(best.peakBytes, run.peakBytes);
+    }
+    return best;
+}
+
+void report(const std::string& label, const Result& result, size_t bytes) {
+    std::cout << "  " << std::left << std::setw(10) << label
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << result.seconds * 1000 << " ms"
+              << std::setw(10) << bytes / (1024.0 * 1024.0) / result.seconds << " MiB/s"
+              << std::setw(12) << result.peakBytes / 1024.0 << " KiB peak"
+              << std::setw(10) << result.elements << " elements"
+              << std::endl;
+}
+
+} // namespace
+
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void* ptr) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr) noexcept { countedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { countedFree(ptr); }
+
+int main(int argc, char* argv[]) {
+    try {
+        std::vector<Sample> samples;
+        if (argc >= 2) {
+            for (int i = 1; i < argc; ++i) {
+                samples.push_back(loadSample(argv[i]));
+            }
+        } else {
+            samples.push_back(makeBlock(5000));
+            samples.push_back(makeBlock(50000));
+            samples.push_back(makeApplicationLog(100000));
+        }
+        
+        const int rounds = 5;
+        for (const auto& sample : samples) {
+            std::cout << sample.name << ", " << std::fixed << std::setprecision(1)
+                      << sample.body.size() / 1024.0 << " KiB" << std::endl;
+            Result buffered = measure(sample, parseBuffered, rounds);
+            Result streamed = measure(sample, parseStreamed, rounds);
+            report("buffered", buffered, sample.body.size());
+            report("streamed", streamed, sample.body.size());
+            std::cout << "  Peak memory: " << std::setprecision(1)
+                      << static_cast<double>(buffered.peakBytes) / streamed.peakBytes << "x lower, time: "
+                      << std::setprecision(2) << buffered.seconds / streamed.seconds << "x" << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
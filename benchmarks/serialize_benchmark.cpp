@@ -0,0 +1,98 @@
+// Measures serialization throughput of a 1000-transaction block.
+//
+// Build this target on two revisions to compare BinaryWriter changes; the
+// benchmark only uses APIs that exist on both sides.
+//
+// Usage:
+//   serialize_benchmark [iterations]
+
+#include <epicchaincpp/protocol/core/block.hpp>
+#include <epicchaincpp/transaction/transaction.hpp>
+#include <epicchaincpp/transaction/signer.hpp>
+#include <epicchaincpp/transaction/witness.hpp>
+#include <epicchaincpp/serialization/binary_writer.hpp>
+#include <epicchaincpp/utils/base64.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+using namespace epicchaincpp;
+
+namespace {
+
+const size_t TRANSACTIONS = 1000;
+
+SharedPtr<Block> makeBlock() {
+    BinaryWriter writer;
+    writer.writeUInt32(0);
+    writer.writeBytes(Bytes(32, 0x11));
+    writer.writeBytes(Bytes(32, 0x22));
+    writer.writeUInt64(1700000000000ULL);
+    writer.writeUInt64(7);
+    writer.writeUInt32(1);
+    writer.writeUInt8(0);
+    writer.writeBytes(Bytes(20, 0x33));
+    writer.writeVarInt(1);
+    Witness(Bytes(66 * 5, 0x0c), Bytes(250, 0x21)).serialize(writer);
+    writer.writeVarInt(TRANSACTIONS);
+    for (size_t i = 0; i < TRANSACTIONS; ++i) {
+        Transaction tx;
+        tx.setNonce(static_cast<uint32_t>(i));
+        tx.setSystemFee(997775);
+        tx.setNetworkFee(122862);
+        tx.setValidUntilBlock(5760);
+        tx.setScript(Bytes(100, 0x0c));
+        tx.addSigner(std::make_shared<Signer>(Hash160(Bytes(20, 0x5a)), WitnessScope::CALLED_BY_ENTRY));
+        tx.addWitness(std::make_shared<Witness>(Bytes(66, 0x0c), Bytes(40, 0x21)));
+        tx.serialize(writer);
+    }
+    return Block::fromBase64(Base64::encode(writer.toArray()));
+}
+
+template<typename Fn>
+void run(const std::string& label, size_t iterations, Fn fn) {
+    size_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        bytes += fn();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << std::left << std::setw(24) << label
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << iterations / seconds << " blocks/s"
+              << std::setw(10) << bytes / seconds / (1024 * 1024) << " MiB/s"
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        size_t iterations = argc > 1 ? std::stoul(argv[1]) : 500;
+        auto block = makeBlock();
+        std::cout << "Block of " << block->getTransactions().size() << " transactions, "
+                  << block->toArray().size() << " bytes" << std::endl;
+
+        run("BinaryWriter", iterations, [&]() {
+            BinaryWriter writer;
+            block->serialize(writer);
+            Bytes bytes = writer.toArray();
+            return bytes.size();
+        });
+        run("Block::toArray", iterations, [&]() {
+            return block->toArray().size();
+        });
+        run("Transaction::toArray", iterations, [&]() {
+            size_t size = 0;
+            for (const auto& tx : block->getTransactions()) {
+                size += tx->toArray().size();
+            }
+            return size;
+        });
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+// Measures ECDSA verification throughput of SignatureBatchVerifier for
+// increasing thread counts, against a serial ECPublicKey::verify loop.
+//
+// Usage:
+//   verify_benchmark [signatures] [keys]
+
+#include <epicchaincpp/crypto/signature_batch_verifier.hpp>
+#include <epicchaincpp/crypto/ec_key_pair.hpp>
+#include <epicchaincpp/crypto/ecdsa_signature.hpp>
+#include <epicchaincpp/crypto/hash.hpp>
+#include <epicchaincpp/utils/thread_pool.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+using namespace epicchaincpp;
+
+namespace {
+
+struct SignedMessage {
+    Bytes message;
+    Bytes hash;
+    SharedPtr<ECDSASignature> signature;
+    SharedPtr<ECPublicKey> publicKey;
+};
+
+void report(const std::string& label, size_t threads, size_t count, double seconds) {
+    double rate = count / seconds;
+    std::cout << std::left << std::setw(24) << label
+              << std::right << std::fixed << std::setprecision(0)
+              << std::setw(10) << rate << " verify/s"
+              << std::setw(10) << rate / threads << " verify/s/core"
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        size_t count = argc > 1 ? std::stoul(argv[1]) : 5000;
+        size_t keyCount = argc > 2 ? std::stoul(argv[2]) : 7;
+
+        std::vector<ECKeyPair> keyPairs;
+        for (size_t i = 0; i < keyCount; ++i) {
+            keyPairs.push_back(ECKeyPair::generate());
+        }
+        std::vector<SignedMessage> messages;
+        messages.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            const auto& keyPair = keyPairs[i % keyPairs.size()];
+            Bytes message(64, static_cast<uint8_t>(i));
+            message[0] = static_cast<uint8_t>(i >> 8);
+            messages.push_back({message, HashUtils::sha256(message), keyPair.sign(message), keyPair.getPublicKey()});
+        }
+        std::cout << count << " signatures by " << keyCount << " keys" << std::endl;
+
+        auto start = std::chrono::steady_clock::now();
+        size_t valid = 0;
+        for (const auto& m : messages) {
+            valid += m.publicKey->verify(m.message, m.signature) ? 1 : 0;
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (valid != count) {
+            throw std::runtime_error("serial verification failed");
+        }
+        report("ECPublicKey::verify", 1, count, seconds);
+
+        for (size_t threads = 1; threads <= ThreadPool::hardwareConcurrency(); threads *= 2) {
+            auto pool = std::make_shared<ThreadPool>(threads);
+            SignatureBatchVerifier verifier(pool);
+            for (const auto& m : messages) {
+                verifier.add(m.hash, m.signature, m.publicKey);
+            }
+            start = std::chrono::steady_clock::now();
+            // Run from a pool task so exactly `threads` threads do the work
+            auto result = pool->submit([&verifier]() { return verifier.verify(); }).get();
+            seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (!result.allValid()) {
+                throw std::runtime_error("batch verification failed");
+            }
+            report("Batch, " + std::to_string(threads) + " thread(s)", threads, count, seconds);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,165 @@
+// Measures XEP2::decryptAll and encryptAll against decrypting and encrypting
+// one key at a time, at several thread counts and under a memory cap, and
+// loading a wallet file with its accounts decrypted in bulk or on first use.
+//
+// Usage:
+//   xep2_bulk_benchmark [keys]
+
+#include <epicchaincpp/crypto/xep2.hpp>
+#include <epicchaincpp/crypto/ec_key_pair.hpp>
+#include <epicchaincpp/utils/thread_pool.hpp>
+#include <epicchaincpp/wallet/wallet.hpp>
+#include <epicchaincpp/wallet/account.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace epicchaincpp;
+
+namespace {
+
+const std::string kPassword = "BenchmarkPassword";
+
+template<typename Body>
+double time(Body body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void report(const std::string& label, size_t count, double seconds, double baseline) {
+    std::cout << "  " << std::left << std::setw(34) << label
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << count / seconds << " keys/s"
+              << std::setw(10) << seconds << " s"
+              << std::setw(10) << baseline / seconds << "x"
+              << std::endl;
+}
+
+XEP2BulkOptions withThreads(size_t threads) {
+    XEP2BulkOptions options;
+    options.threads = threads;
+    return options;
+}
+
+std::vector<size_t> threadCounts() {
+    std::vector<size_t> counts;
+    for (size_t threads = 2; threads < ThreadPool::hardwareConcurrency(); threads *= 2) {
+        counts.push_back(threads);
+    }
+    counts.push_back(ThreadPool::hardwareConcurrency());
+    return counts;
+}
+
+void benchmarkDecrypt(const std::vector<Bytes>& privateKeys, const std::vector<std::string>& keys) {
+    size_t count = keys.size();
+    std::cout << "decrypt " << count << " keys (scrypt N=16384 r=8 p=8, "
+              << XEP2::scryptMemory(ScryptParams::getDefault()) / (1024 * 1024) << " MiB each)" << std::endl;
+    double baseline = time([&] {
+        for (const auto& key : keys) {
+            XEP2::decrypt(key, kPassword);
+        }
+    });
+    report("one at a time", count, baseline, baseline);
+    for (size_t threads : threadCounts()) {
+        double seconds = time([&] { XEP2::decryptAll(keys, kPassword, ScryptParams::getDefault(), withThreads(threads)); });
+        report("decryptAll " + std::to_string(threads) + " threads", count, seconds, baseline);
+    }
+    
+    // Cap memory at two derivations, and report progress as it goes
+    XEP2BulkOptions capped;
+    capped.memoryLimit = 2 * XEP2::scryptMemory(ScryptParams::getDefault());
+    capped.onProgress = [](const XEP2BulkProgress& progress) {
+        if (progress.completed == progress.total) {
+            std::cout << "  progress: " << progress.completed << "/" << progress.total
+                      << " done, " << progress.failed << " failed, " << progress.concurrency
+                      << " at once, " << std::setprecision(2) << progress.elapsedSeconds << " s" << std::endl;
+        }
+    };
+    std::vector<XEP2DecryptResult> results;
+    double seconds = time([&] { results = XEP2::decryptAll(keys, kPassword, ScryptParams::getDefault(), capped); });
+    report("decryptAll capped at 2 x scrypt", count, seconds, baseline);
+    double slowest = 0;
+    for (size_t i = 0; i < results.size(); ++i) {
+        if (results[i].privateKey != privateKeys[i]) {
+            throw std::runtime_error("decryptAll returned a wrong key");
+        }
+        slowest = std::max(slowest, results[i].seconds);
+    }
+    std::cout << "  slowest key: " << std::setprecision(3) << slowest << " s" << std::endl;
+}
+
+void benchmarkEncrypt(const std::vector<Bytes>& privateKeys) {
+    size_t count = privateKeys.size();
+    std::cout << "encrypt " << count << " keys" << std::endl;
+    double baseline = time([&] {
+        for (const auto& privateKey : privateKeys) {
+            XEP2::encrypt(privateKey, kPassword);
+        }
+    });
+    report("one at a time", count, baseline, baseline);
+    size_t threads = ThreadPool::hardwareConcurrency();
+    double seconds = time([&] { XEP2::encryptAll(privateKeys, kPassword, ScryptParams::getDefault(), withThreads(threads)); });
+    report("encryptAll " + std::to_string(threads) + " threads", count, seconds, baseline);
+}
+
+void benchmarkWallet(const std::vector<Bytes>& privateKeys) {
+    std::string filepath = "/tmp/xep2_bulk_benchmark_wallet.json";
+    {
+        Wallet wallet("Benchmark", "1.0");
+        for (const auto& privateKey : privateKeys) {
+            wallet.addAccount(std::make_shared<Account>(std::make_shared<ECKeyPair>(privateKey)));
+        }
+        wallet.save(filepath, kPassword);
+    }
+    
+    size_t count = privateKeys.size();
+    std::cout << "load a wallet of " << count << " XEP-2 accounts" << std::endl;
+    WalletLoadOptions sequential;
+    sequential.xep2.threads = 1;
+    double baseline = time([&] { Wallet::load(filepath, kPassword, sequential); });
+    report("decrypt one at a time", count, baseline, baseline);
+    double seconds = time([&] { Wallet::load(filepath, kPassword); });
+    report("decrypt in bulk", count, seconds, baseline);
+    
+    WalletLoadOptions lazy;
+    lazy.decryptOnFirstUse = true;
+    SharedPtr<Wallet> wallet;
+    seconds = time([&] { wallet = Wallet::load(filepath, kPassword, lazy); });
+    report("decrypt on first use", count, seconds, baseline);
+    seconds = time([&] { wallet->unlockAll(kPassword); });
+    report("  then unlockAll", count, seconds, baseline);
+    std::remove(filepath.c_str());
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        size_t count = argc >= 2 ? std::stoul(argv[1]) : 32;
+        std::cout << "Hardware threads: " << ThreadPool::hardwareConcurrency() << std::endl;
+        
+        std::vector<Bytes> privateKeys;
+        for (size_t i = 0; i < count; ++i) {
+            privateKeys.push_back(ECKeyPair::generate().getPrivateKey()->getBytes());
+        }
+        auto encrypted = XEP2::encryptAll(privateKeys, kPassword);
+        std::vector<std::string> keys;
+        for (const auto& result : encrypted) {
+            keys.push_back(result.xep2);
+        }
+        
+        benchmarkDecrypt(privateKeys, keys);
+        benchmarkEncrypt(privateKeys);
+        benchmarkWallet(privateKeys);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
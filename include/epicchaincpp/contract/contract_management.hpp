@@ -17,10 +17,10 @@ public:
     static const std::string NAME;
     
     /// Constructor
-    explicit ContractManagement(const SharedPtr<NeoRpcClient>& client);
+    explicit ContractManagement(const SharedPtr<EpicChainRpcClient>& client);
     
     /// Create instance
-    static SharedPtr<ContractManagement> create(const SharedPtr<NeoRpcClient>& client);
+    static SharedPtr<ContractManagement> create(const SharedPtr<EpicChainRpcClient>& client);
     
     /// Deploy a contract
     /// @param nef The NEF file
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "epicchaincpp/types/types.hpp"
+#include "epicchaincpp/types/hash160.hpp"
+
+namespace epicchaincpp {
+
+/// Deployment state of a contract, as returned by getcontractstate
+struct ContractMetadata {
+    int id = 0;
+    uint32_t updateCounter = 0;
+    
+    /// The NEF file, Base64 encoded
+    std::string nef;
+    
+    nlohmann::json manifest;
+};
+
+/// Token metadata shared by XEP-17 and XEP-11 contracts
+struct TokenMetadata {
+    std::string symbol;
+    int decimals = 0;
+};
+
+/// Thread-safe cache of contract metadata keyed by network magic and script
+/// hash, so clients of different networks can share one instance.
+///
+/// Concurrent callers asking for the same missing entry share one in-flight
+/// fetch; a failed fetch is reported to every waiter and not cached. Entries
+/// stay valid until the contract is updated or destroyed, which the cache
+/// cannot observe by itself: callers report it through invalidate() or by
+/// passing ContractManagement notifications to onNotification(), e.g. from a
+/// SubscriptionClient notification subscription.
+///
+/// With a persistence path set, the cache is loaded from that file and
+/// flush() writes it back, so a restarted process skips the fetches. Files
+/// older than the maximum age are ignored, since updates made while the
+/// process was down were never observed.
+class ContractMetadataCache {
+public:
+    using MetadataFetcher = std::function<ContractMetadata()>;
+    using TokenFetcher = std::function<TokenMetadata()>;
+    
+    /// Cache counters
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+        size_t contracts;
+        size_t tokens;
+    };
+
+private:
+    /// Network magic and script hash
+    using Key = std::pair<uint32_t, Hash160>;
+    
+    mutable std::mutex mutex_;
+    std::map<Key, std::shared_future<SharedPtr<const ContractMetadata>>> contracts_;
+    std::map<Key, std::shared_future<SharedPtr<const TokenMetadata>>> tokens_;
+    uint64_t hits_;
+    uint64_t misses_;
+    
+    std::string persistencePath_;
+    std::chrono::seconds maxPersistedAge_;
+    
+    /// Entry changes so far, and how many of them the persistence file holds
+    uint64_t changes_;
+    uint64_t flushedChanges_;
+    
+    template<typename T>
+    SharedPtr<const T> getOrFetch(std::map<Key, std::shared_future<SharedPtr<const T>>>& entries,
+                                  const Key& key, const std::function<T()>& fetch);
+    
+    void load();
+
+public:
+    /// Constructor
+    ContractMetadataCache();
+    
+    /// Destructor. Flushes to the persistence file, if one is set.
+    ~ContractMetadataCache();
+    
+    ContractMetadataCache(const ContractMetadataCache&) = delete;
+    ContractMetadataCache& operator=(const ContractMetadataCache&) = delete;
+    
+    /// Get a contract's deployment state, running fetch() on a miss
+    /// @param network The network magic
+    /// @param scriptHash The contract script hash
+    /// @param fetch Fetches the state, typically through getcontractstate
+    /// @return The cached state
+    SharedPtr<const ContractMetadata> getContractMetadata(uint32_t network, const Hash160& scriptHash,
+                                                          const MetadataFetcher& fetch);
+    
+    /// Get a token's symbol and decimals, running fetch() on a miss
+    /// @param network The network magic
+    /// @param scriptHash The token contract script hash
+    /// @param fetch Fetches the metadata
+    /// @return The cached metadata
+    SharedPtr<const TokenMetadata> getTokenMetadata(uint32_t network, const Hash160& scriptHash,
+                                                    const TokenFetcher& fetch);
+    
+    /// Drop everything cached for a contract
+    /// @param network The network magic
+    /// @param scriptHash The contract script hash
+    void invalidate(uint32_t network, const Hash160& scriptHash);
+    
+    /// Inspect a contract notification and invalidate the contract named by
+    /// a ContractManagement Update or Destroy event
+    /// @param network The magic of the network that emitted the notification
+    /// @param notification The notification JSON ({"contract", "eventname", "state"})
+    /// @return True if an entry was invalidated
+    bool onNotification(uint32_t network, const nlohmann::json& notification);
+    
+    /// Drop all cached entries
+    void clear();
+    
+    /// Get the hit/miss counters and entry counts
+    Stats getStats() const;
+    
+    /// Load cached entries from a file and write them back there on flush()
+    /// @param path The cache file
+    /// @param maxAge A file last written longer ago than this is ignored
+    void setPersistencePath(const std::string& path,
+                            std::chrono::seconds maxAge = std::chrono::hours(24));
+    
+    /// Write the cache to the persistence file, if one is set and entries changed.
+    /// If the write fails, the changes stay pending for the next flush.
+    void flush();
+    
+    /// Serialize the completed entries
+    nlohmann::json toJson() const;
+    
+    /// Add the entries of a serialized cache
+    /// @param json The output of toJson()
+    void loadJson(const nlohmann::json& json);
+    
+    /// Get the process-wide cache. SmartContract does not use it unless
+    /// passed to setMetadataCache().
+    static SharedPtr<ContractMetadataCache> shared();
+};
+
+} // namespace epicchaincpp
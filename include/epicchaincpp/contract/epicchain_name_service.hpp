@@ -14,7 +14,7 @@ public:
     
     /// Constructor
     /// @param client The RPC client
-    explicit NeoNameService(const SharedPtr<NeoRpcClient>& client);
+    explicit NeoNameService(const SharedPtr<EpicChainRpcClient>& client);
     
     /// Destructor
     ~NeoNameService() = default;
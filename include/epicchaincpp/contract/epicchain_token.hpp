@@ -12,7 +12,7 @@ public:
     
     /// Constructor
     /// @param client The RPC client
-    explicit EpicChainToken(const SharedPtr<NeoRpcClient>& client);
+    explicit EpicChainToken(const SharedPtr<EpicChainRpcClient>& client);
     
     /// Destructor
     ~EpicChainToken() = default;
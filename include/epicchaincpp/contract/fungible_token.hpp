@@ -2,6 +2,7 @@
 
 #include "epicchaincpp/contract/smart_contract.hpp"
 #include <string>
+#include <vector>
 
 namespace epicchaincpp {
 
@@ -16,7 +17,7 @@ public:
     /// Constructor
     /// @param scriptHash The token contract script hash
     /// @param client The RPC client
-    FungibleToken(const Hash160& scriptHash, const SharedPtr<NeoRpcClient>& client);
+    FungibleToken(const Hash160& scriptHash, const SharedPtr<EpicChainRpcClient>& client);
     
     /// Destructor
     virtual ~FungibleToken() = default;
@@ -38,6 +39,13 @@ public:
     /// @return The balance
     int64_t getBalanceOf(const std::string& address);
     
+    /// Get the balances of many addresses in batched invocations
+    /// @param addresses The addresses
+    /// @param batchSize Addresses per invokescript
+    /// @return The balances, in the order of addresses
+    std::vector<int64_t> getBalancesOf(const std::vector<std::string>& addresses,
+                                       size_t batchSize = DEFAULT_BATCH_SIZE);
+    
     /// Transfer tokens
     /// @param from The sender account
     /// @param to The recipient address
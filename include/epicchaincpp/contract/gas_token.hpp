@@ -12,7 +12,7 @@ public:
     
     /// Constructor
     /// @param client The RPC client
-    explicit EpicPulseToken(const SharedPtr<NeoRpcClient>& client);
+    explicit EpicPulseToken(const SharedPtr<EpicChainRpcClient>& client);
     
     /// Destructor
     ~EpicPulseToken() = default;
@@ -3,24 +3,136 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <functional>
+#include <future>
+#include <iterator>
 #include <nlohmann/json.hpp>
 #include "epicchaincpp/types/types.hpp"
 
 namespace epicchaincpp {
 
 // Forward declarations
-class NeoRpcClient;
+class EpicChainRpcClient;
+class Hash160;
+
+/// One page of results fetched from the node
+struct IteratorPage {
+    /// The stack items (or storage entries) in this page
+    std::vector<nlohmann::json> items;
+    
+    /// Whether the node has more items after this page
+    bool hasMore = false;
+};
+
+/// Pull-based stream over a paged RPC result, such as a session iterator or
+/// a findstorage scan. Items are consumed one at a time, so the full result
+/// never has to be held in memory. While the caller works through a page, the
+/// next one is fetched in the background.
+///
+/// The stream is single-pass. Reaching the end, calling close() or destroying
+/// the stream releases the server-side resources (e.g. terminates the session).
+class ItemStream {
+public:
+    /// Fetches the next page. Called sequentially, never concurrently.
+    using PageFetcher = std::function<IteratorPage()>;
+    
+    /// Input iterator over the remaining items of a stream
+    class iterator {
+    private:
+        ItemStream* stream_;
+        nlohmann::json current_;
+        
+        void advance();
+        
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = nlohmann::json;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const nlohmann::json*;
+        using reference = const nlohmann::json&;
+        
+        /// Construct the end iterator
+        iterator() : stream_(nullptr) {}
+        
+        /// Construct an iterator positioned at the stream's next item
+        explicit iterator(ItemStream* stream);
+        
+        reference operator*() const { return current_; }
+        pointer operator->() const { return &current_; }
+        iterator& operator++();
+        iterator operator++(int);
+        bool operator==(const iterator& other) const { return stream_ == other.stream_; }
+        bool operator!=(const iterator& other) const { return stream_ != other.stream_; }
+    };
+    
+    /// Constructor
+    /// @param fetcher Fetches successive pages
+    /// @param onClose Called once when the stream is closed, e.g. to terminate the session
+    /// @param prefetch Whether to fetch the next page in the background
+    explicit ItemStream(PageFetcher fetcher,
+                        std::function<void()> onClose = nullptr,
+                        bool prefetch = true);
+    
+    /// Constructor for a result that was returned in full, without paging
+    /// @param items The items
+    explicit ItemStream(std::vector<nlohmann::json> items);
+    
+    /// Destructor. Closes the stream.
+    ~ItemStream();
+    
+    ItemStream(const ItemStream&) = delete;
+    ItemStream& operator=(const ItemStream&) = delete;
+    
+    /// Get the next item
+    /// @param item Receives the item
+    /// @return False when the stream is exhausted
+    bool next(nlohmann::json& item);
+    
+    /// Read up to count items
+    /// @param count The maximum number of items (0 for all remaining)
+    /// @return The items read
+    std::vector<nlohmann::json> take(size_t count = 0);
+    
+    /// Check whether the stream has been closed
+    bool isClosed() const { return closed_; }
+    
+    /// Stop the stream and release server-side resources. Waits for an
+    /// in-flight prefetch before terminating the session. Safe to call twice.
+    void close();
+    
+    /// Iterate over the remaining items
+    iterator begin() { return iterator(this); }
+    iterator end() { return iterator(); }
+    
+private:
+    PageFetcher fetcher_;
+    std::function<void()> onClose_;
+    bool prefetch_;
+    std::vector<nlohmann::json> page_;
+    size_t position_;
+    bool hasMore_;
+    bool closed_;
+    std::future<IteratorPage> pending_;
+    
+    /// Replace the current page with the next one
+    /// @return False when there are no more pages
+    bool loadNextPage();
+};
 
 /// Iterator for traversing contract storage or results
 class Iterator {
 private:
     std::string sessionId_;
     std::string iteratorId_;
-    SharedPtr<NeoRpcClient> client_;
+    SharedPtr<EpicChainRpcClient> client_;
     size_t count_;
     bool traversed_;
     
 public:
+    /// Default number of items per traverseiterator call, matching the
+    /// node's default MaxIteratorResultItems
+    static constexpr size_t DEFAULT_PAGE_SIZE = 100;
+    
     /// Constructor
     /// @param sessionId The RPC session ID
     /// @param iteratorId The iterator ID
@@ -28,7 +140,7 @@ public:
     /// @param count The number of items
     Iterator(const std::string& sessionId,
              const std::string& iteratorId,
-             const SharedPtr<NeoRpcClient>& client,
+             const SharedPtr<EpicChainRpcClient>& client,
              size_t count = 0);
     
     /// Destructor
@@ -54,6 +166,50 @@ public:
     /// Terminate the iterator
     void terminate();
     
+    /// Stream the iterator's items page by page. The stream takes over the
+    /// session: it terminates it when done, and this iterator can no longer
+    /// be traversed.
+    /// @param pageSize Items per traverseiterator call (0 uses the count given at construction,
+    ///                 or DEFAULT_PAGE_SIZE)
+    /// @param prefetch Whether to fetch the next page in the background
+    /// @return The item stream
+    SharedPtr<ItemStream> stream(size_t pageSize = 0, bool prefetch = true);
+    
+    /// Build the page fetcher behind stream(). The node caps each page at its
+    /// MaxIteratorResultItems, which may be below pageSize, so a short first
+    /// page does not end the stream. Later pages end it when they are empty or
+    /// shorter than the first.
+    /// @param traverse Calls traverseiterator with a page size
+    /// @param pageSize Items requested per call
+    /// @return The page fetcher
+    static ItemStream::PageFetcher makePageFetcher(std::function<nlohmann::json(uint32_t)> traverse,
+                                                   size_t pageSize);
+    
+    /// Stream the first stack item of an invokefunction/invokescript result.
+    /// Handles an iterator returned in a session, an iterator expanded inline
+    /// by a node with sessions disabled, and a plain Array.
+    /// @param result The invocation result
+    /// @param client The RPC client the invocation was made with
+    /// @param pageSize Items per traverseiterator call
+    /// @param prefetch Whether to fetch the next page in the background
+    /// @return The item stream
+    static SharedPtr<ItemStream> fromInvokeResult(const nlohmann::json& result,
+                                                  const SharedPtr<EpicChainRpcClient>& client,
+                                                  size_t pageSize = DEFAULT_PAGE_SIZE,
+                                                  bool prefetch = true);
+    
+    /// Stream the storage entries of a contract whose keys start with a prefix,
+    /// following the node's findstorage pagination
+    /// @param client The RPC client
+    /// @param scriptHash The contract script hash
+    /// @param prefix The key prefix
+    /// @param prefetch Whether to fetch the next page in the background
+    /// @return Stream of {"key", "value"} entries, both Base64 encoded
+    static SharedPtr<ItemStream> findStorage(const SharedPtr<EpicChainRpcClient>& client,
+                                             const Hash160& scriptHash,
+                                             const Bytes& prefix,
+                                             bool prefetch = true);
+    
 private:
     /// Ensure session is valid
     void ensureNotTraversed();
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include "epicchaincpp/types/types.hpp"
+#include "epicchaincpp/types/hash160.hpp"
+#include "epicchaincpp/types/contract_parameter.hpp"
+
+namespace epicchaincpp {
+
+// Forward declarations
+class EpicChainRpcClient;
+
+/// A read queued in a MultiCall
+struct MultiCallEntry {
+    Hash160 scriptHash;
+    std::string method;
+    std::vector<ContractParameter> params;
+};
+
+/// Results of a MultiCall, one stack item per call in the order the calls were added
+class MultiCallResult {
+private:
+    std::vector<nlohmann::json> items_;
+
+public:
+    /// Constructor
+    /// @param items The stack items, one per call
+    explicit MultiCallResult(std::vector<nlohmann::json> items);
+    
+    /// Get the number of results
+    size_t size() const { return items_.size(); }
+    
+    /// Get all raw stack items
+    const std::vector<nlohmann::json>& getItems() const { return items_; }
+    
+    /// Get the raw stack item of a call
+    /// @param index The index returned by MultiCall::add
+    /// @return The stack item JSON
+    const nlohmann::json& getItem(size_t index) const;
+    
+    /// Decode a Boolean (or Integer) result
+    bool getBoolean(size_t index) const;
+    
+    /// Decode an Integer (or Boolean) result
+    int64_t getInteger(size_t index) const;
+    
+    /// Decode a ByteString or Buffer result
+    Bytes getByteArray(size_t index) const;
+    
+    /// Decode a ByteString or Buffer result as UTF-8 text
+    std::string getString(size_t index) const;
+    
+    /// Decode a 20-byte ByteString result, as returned for UInt160 values
+    Hash160 getHash160(size_t index) const;
+};
+
+/// Aggregates many read-only contract calls, possibly to different contracts,
+/// into a single invokescript. Each batch of calls is compiled into one
+/// script whose results are packed into an array, so N reads cost one RPC
+/// round-trip instead of N.
+///
+/// Any call that faults aborts its whole batch, so only queue reads that are
+/// expected to succeed.
+class MultiCall {
+private:
+    SharedPtr<EpicChainRpcClient> client_;
+    std::vector<MultiCallEntry> calls_;
+    size_t batchSize_;
+
+public:
+    /// Default calls per invokescript, bounded by the VM's stack size limit
+    static constexpr size_t DEFAULT_BATCH_SIZE = 200;
+    
+    /// Constructor
+    /// @param client The RPC client
+    /// @param batchSize Calls per invokescript
+    explicit MultiCall(const SharedPtr<EpicChainRpcClient>& client, size_t batchSize = DEFAULT_BATCH_SIZE);
+    
+    /// Queue a call
+    /// @param scriptHash The contract script hash
+    /// @param method The method name
+    /// @param params The parameters
+    /// @return The index of the call's result
+    size_t add(const Hash160& scriptHash, const std::string& method,
+               const std::vector<ContractParameter>& params = {});
+    
+    /// Get the number of queued calls
+    size_t size() const { return calls_.size(); }
+    
+    /// Remove all queued calls
+    void clear() { calls_.clear(); }
+    
+    /// Compile the queued calls, one script per batch
+    /// @return The scripts
+    std::vector<Bytes> buildScripts() const;
+    
+    /// Run all queued calls
+    /// @return One result per call
+    MultiCallResult execute() const;
+};
+
+} // namespace epicchaincpp
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "epicchaincpp/contract/smart_contract.hpp"
+#include "epicchaincpp/contract/iterator.hpp"
 #include <string>
 #include <vector>
 
@@ -14,10 +15,13 @@ protected:
     mutable bool metadataLoaded_;
     
 public:
+    /// Default tokens per invokescript when reading properties
+    static constexpr size_t PROPERTIES_BATCH_SIZE = 50;
+    
     /// Constructor
     /// @param scriptHash The NFT contract script hash
     /// @param client The RPC client
-    NonFungibleToken(const Hash160& scriptHash, const SharedPtr<NeoRpcClient>& client);
+    NonFungibleToken(const Hash160& scriptHash, const SharedPtr<EpicChainRpcClient>& client);
     
     /// Destructor
     virtual ~NonFungibleToken() = default;
@@ -44,20 +48,64 @@ public:
     /// @return List of token IDs
     std::vector<std::string> getTokensOf(const std::string& address);
     
+    /// Stream the tokens owned by an address without loading them all at once
+    /// @param address The address
+    /// @param pageSize Tokens per traverseiterator call
+    /// @param prefetch Whether to fetch the next page in the background
+    /// @return Stream of token ID stack items
+    SharedPtr<ItemStream> streamTokensOf(const std::string& address,
+                                         size_t pageSize = Iterator::DEFAULT_PAGE_SIZE,
+                                         bool prefetch = true);
+    
+    /// Get up to maxItems tokens owned by an address in a single invocation,
+    /// draining the iterator inside the VM
+    /// @param address The address
+    /// @param maxItems The maximum number of tokens
+    /// @return List of token IDs
+    std::vector<std::string> listTokensOf(const std::string& address, int maxItems = DEFAULT_UNWRAP_ITEMS);
+    
     /// Get owner of a token
     /// @param tokenId The token ID
     /// @return The owner address
     std::string getOwnerOf(const std::string& tokenId);
     
+    /// Get the owners of many tokens in batched invocations
+    /// @param tokenIds The token IDs
+    /// @param batchSize Tokens per invokescript
+    /// @return The owners, in the order of tokenIds
+    std::vector<std::string> getOwnersOf(const std::vector<std::string>& tokenIds,
+                                         size_t batchSize = DEFAULT_BATCH_SIZE);
+    
     /// Get token properties/metadata
     /// @param tokenId The token ID
     /// @return The token properties
     nlohmann::json getProperties(const std::string& tokenId);
     
+    /// Get the properties of many tokens in batched invocations
+    /// @param tokenIds The token IDs
+    /// @param batchSize Tokens per invokescript. Every map entry counts
+    ///                  towards the VM's stack size limit, hence the smaller default.
+    /// @return The properties stack item of each token, in the order of tokenIds
+    std::vector<nlohmann::json> getProperties(const std::vector<std::string>& tokenIds,
+                                              size_t batchSize = PROPERTIES_BATCH_SIZE);
+    
     /// Get all tokens
     /// @return List of all token IDs
     std::vector<std::string> getAllTokens();
     
+    /// Get up to maxItems tokens of the collection in a single invocation,
+    /// draining the iterator inside the VM
+    /// @param maxItems The maximum number of tokens
+    /// @return List of token IDs
+    std::vector<std::string> listAllTokens(int maxItems = DEFAULT_UNWRAP_ITEMS);
+    
+    /// Stream all tokens of the collection without loading them all at once
+    /// @param pageSize Tokens per traverseiterator call
+    /// @param prefetch Whether to fetch the next page in the background
+    /// @return Stream of token ID stack items
+    SharedPtr<ItemStream> streamAllTokens(size_t pageSize = Iterator::DEFAULT_PAGE_SIZE,
+                                          bool prefetch = true);
+    
     /// Transfer NFT
     /// @param from The sender account
     /// @param to The recipient address
@@ -13,10 +13,10 @@ public:
     static const std::string NAME;
     
     /// Constructor
-    explicit PolicyContract(const SharedPtr<NeoRpcClient>& client);
+    explicit PolicyContract(const SharedPtr<EpicChainRpcClient>& client);
     
     /// Create instance
-    static SharedPtr<PolicyContract> create(const SharedPtr<NeoRpcClient>& client);
+    static SharedPtr<PolicyContract> create(const SharedPtr<EpicChainRpcClient>& client);
     
     /// Get fee per byte
     /// @return The fee per byte
@@ -21,10 +21,10 @@ public:
     };
     
     /// Constructor
-    explicit RoleManagement(const SharedPtr<NeoRpcClient>& client);
+    explicit RoleManagement(const SharedPtr<EpicChainRpcClient>& client);
     
     /// Create instance
-    static SharedPtr<RoleManagement> create(const SharedPtr<NeoRpcClient>& client);
+    static SharedPtr<RoleManagement> create(const SharedPtr<EpicChainRpcClient>& client);
     
     /// Get designated nodes by role
     /// @param role The role
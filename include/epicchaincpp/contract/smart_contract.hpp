@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <functional>
 #include <nlohmann/json.hpp>
 #include "epicchaincpp/types/types.hpp"
 #include "epicchaincpp/types/hash160.hpp"
@@ -10,22 +11,34 @@
 namespace epicchaincpp {
 
 // Forward declarations
-class NeoRpcClient;
+class EpicChainRpcClient;
 class TransactionBuilder;
 class ContractParameter;
 class Account;
+class ItemStream;
+class ContractMetadataCache;
+struct ContractMetadata;
+struct TokenMetadata;
 
 /// Base class for smart contract interactions
 class SmartContract {
 protected:
     Hash160 scriptHash_;
-    SharedPtr<NeoRpcClient> client_;
+    SharedPtr<EpicChainRpcClient> client_;
+    SharedPtr<ContractMetadataCache> metadataCache_;
+    uint32_t metadataNetwork_;
     
 public:
+    /// Default calls per invokescript in invokeMany
+    static constexpr size_t DEFAULT_BATCH_SIZE = 200;
+    
+    /// Default item limit in invokeAndUnwrapIterator
+    static constexpr int DEFAULT_UNWRAP_ITEMS = 1000;
+    
     /// Constructor
     /// @param scriptHash The contract script hash
     /// @param client The RPC client
-    SmartContract(const Hash160& scriptHash, const SharedPtr<NeoRpcClient>& client);
+    SmartContract(const Hash160& scriptHash, const SharedPtr<EpicChainRpcClient>& client);
     
     /// Destructor
     virtual ~SmartContract() = default;
@@ -34,10 +47,24 @@ public:
     const Hash160& getScriptHash() const { return scriptHash_; }
     
     /// Get the RPC client
-    const SharedPtr<NeoRpcClient>& getClient() const { return client_; }
+    const SharedPtr<EpicChainRpcClient>& getClient() const { return client_; }
     
     /// Set the RPC client
-    void setClient(const SharedPtr<NeoRpcClient>& client) { client_ = client; }
+    void setClient(const SharedPtr<EpicChainRpcClient>& client) { client_ = client; }
+    
+    /// Set the metadata cache used for the manifest, NEF and token metadata.
+    /// No cache is used by default; nullptr disables caching again. The cache
+    /// is only invalidated through its own invalidate()/onNotification().
+    /// @param cache The cache, e.g. ContractMetadataCache::shared()
+    /// @param network The magic of the network the RPC client talks to
+    void setMetadataCache(const SharedPtr<ContractMetadataCache>& cache, uint32_t network) {
+        metadataCache_ = cache;
+        metadataNetwork_ = network;
+    }
+    
+    /// Get the contract's deployment state, from the metadata cache if possible
+    /// @return The contract state
+    SharedPtr<const ContractMetadata> getContractMetadata();
     
     /// Invoke a contract method (read-only)
     /// @param method The method name
@@ -45,6 +72,25 @@ public:
     /// @return The invocation result
     nlohmann::json invokeFunction(const std::string& method, const std::vector<ContractParameter>& params = {});
     
+    /// Invoke the same method once per parameter list, batching many calls
+    /// into each invokescript. Results are packed into one array per batch.
+    /// @param method The method name
+    /// @param calls The parameters of each call
+    /// @param batchSize Calls per invokescript; bounded by the VM's stack size limit
+    /// @return The first stack item of each call, in the order of calls
+    std::vector<nlohmann::json> invokeMany(const std::string& method,
+                                           const std::vector<std::vector<ContractParameter>>& calls,
+                                           size_t batchSize = DEFAULT_BATCH_SIZE);
+    
+    /// Invoke a method that returns an iterator and drain it inside the VM
+    /// @param method The method name
+    /// @param params The parameters
+    /// @param maxItems The maximum number of items to return
+    /// @return The iterator values
+    std::vector<nlohmann::json> invokeAndUnwrapIterator(const std::string& method,
+                                                        const std::vector<ContractParameter>& params,
+                                                        int maxItems = DEFAULT_UNWRAP_ITEMS);
+    
     /// Build invocation transaction
     /// @param method The method name
     /// @param params The parameters
@@ -86,7 +132,24 @@ public:
     /// @return List of contract events
     std::vector<nlohmann::json> getEvents();
     
+    /// Stream the contract's storage entries whose keys start with a prefix.
+    /// Pages are fetched from the node as the stream is consumed.
+    /// @param prefix The key prefix (empty for all entries)
+    /// @param prefetch Whether to fetch the next page in the background
+    /// @return Stream of {"key", "value"} entries, both Base64 encoded
+    SharedPtr<ItemStream> findStorage(const Bytes& prefix, bool prefetch = true);
+    
 protected:
+    /// Get the token metadata from the metadata cache, running fetch() on a miss
+    /// @param fetch Fetches the metadata
+    /// @return The token metadata
+    SharedPtr<const TokenMetadata> getTokenMetadata(const std::function<TokenMetadata()>& fetch);
+    
+    /// Run a script and return the stack of a HALTed invocation
+    /// @param script The script
+    /// @return The result stack
+    nlohmann::json invokeScriptStack(const Bytes& script);
+    
     /// Convert parameters to JSON for RPC
     nlohmann::json paramsToJson(const std::vector<ContractParameter>& params);
 };
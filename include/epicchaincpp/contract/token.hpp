@@ -11,7 +11,7 @@ public:
     /// Constructor
     /// @param scriptHash The contract script hash
     /// @param client The RPC client
-    Token(const Hash160& scriptHash, const SharedPtr<NeoRpcClient>& client);
+    Token(const Hash160& scriptHash, const SharedPtr<EpicChainRpcClient>& client);
     
     /// Destructor
     virtual ~Token() = default;
@@ -19,6 +19,13 @@ class ECPrivateKey {
 private:
     std::array<uint8_t, NeoConstants::PRIVATE_KEY_SIZE> key_;
     
+    /// OpenSSL key and derived public key, built on first use and shared by copies
+    class OpenSSLKey;
+    mutable SharedPtr<const OpenSSLKey> openSSLKey_;
+    
+    /// Get the cached OpenSSL key, building it if needed (thread-safe)
+    const OpenSSLKey& openSSLKey() const;
+    
 public:
     /// Generate a random private key
     static ECPrivateKey generate();
@@ -35,6 +42,10 @@ public:
     /// @param hex The hex-encoded private key
     explicit ECPrivateKey(const std::string& hex);
     
+    ECPrivateKey(const ECPrivateKey& other);
+    ECPrivateKey& operator=(const ECPrivateKey& other);
+    ~ECPrivateKey();
+    
     /// Get the private key bytes
     /// @return The private key as bytes
     Bytes getBytes() const;
@@ -43,7 +54,7 @@ public:
     /// @return The hex-encoded private key
     std::string toHex() const;
     
-    /// Derive the public key
+    /// Derive the public key. The key is derived once and then cached.
     /// @return The corresponding public key
     SharedPtr<ECPublicKey> getPublicKey() const;
     
@@ -51,6 +62,11 @@ public:
     /// @param message The message to sign
     /// @return The signature
     SharedPtr<ECDSASignature> sign(const Bytes& message) const;
+    
+    /// Sign a precomputed 32-byte message digest
+    /// @param hash The digest to sign
+    /// @return The signature
+    SharedPtr<ECDSASignature> signHash(const Bytes& hash) const;
 };
 
 /// Represents an EC public key
@@ -161,7 +177,8 @@ public:
     std::string getAddress() const;
 };
 
-/// Represents an EC key pair (private and public key)
+/// Represents an EC key pair (private and public key).
+/// The OpenSSL key and public key are derived once and reused by every sign() call.
 class ECKeyPair {
 private:
     SharedPtr<ECPrivateKey> privateKey_;
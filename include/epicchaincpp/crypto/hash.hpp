@@ -1,11 +1,27 @@
 #pragma once
 
+#include <array>
+#include <cstring>
 #include <string>
+#include <vector>
 #include "epicchaincpp/types/types.hpp"
+#include "epicchaincpp/serialization/binary_writer.hpp"
+
+typedef struct evp_md_ctx_st EVP_MD_CTX;
 
 namespace epicchaincpp {
 
+/// A SHA256 or Keccak256 digest held inline
+using Digest256 = std::array<uint8_t, 32>;
+
+/// A RIPEMD160 digest held inline
+using Digest160 = std::array<uint8_t, 20>;
+
 /// Hash utilities for cryptographic operations
+///
+/// The Bytes overloads return a new vector; the pointer/length overloads write
+/// into a caller-provided array and never touch the heap. Both reuse digest
+/// contexts kept per thread.
 class HashUtils {
 public:
     /// Compute SHA256 hash
@@ -33,6 +49,74 @@ public:
     /// @return The Keccak256 hash (32 bytes)
     static Bytes keccak256(const Bytes& data);
     
+    /// Compute SHA256 hash into a fixed-size digest
+    /// @param data The data to hash
+    /// @param length The number of bytes to hash
+    /// @param out Receives the hash
+    static void sha256(const uint8_t* data, size_t length, Digest256& out);
+    
+    /// Compute double SHA256 hash into a fixed-size digest
+    /// @param data The data to hash
+    /// @param length The number of bytes to hash
+    /// @param out Receives the hash
+    static void doubleSha256(const uint8_t* data, size_t length, Digest256& out);
+    
+    /// Compute RIPEMD160 hash into a fixed-size digest
+    /// @param data The data to hash
+    /// @param length The number of bytes to hash
+    /// @param out Receives the hash
+    static void ripemd160(const uint8_t* data, size_t length, Digest160& out);
+    
+    /// Compute SHA256 then RIPEMD160 hash into a fixed-size digest
+    /// @param data The data to hash
+    /// @param length The number of bytes to hash
+    /// @param out Receives the hash
+    static void sha256ThenRipemd160(const uint8_t* data, size_t length, Digest160& out);
+    
+    /// Compute Keccak256 hash into a fixed-size digest
+    /// @param data The data to hash
+    /// @param length The number of bytes to hash
+    /// @param out Receives the hash
+    static void keccak256(const uint8_t* data, size_t length, Digest256& out);
+    
+    /// Implementations of the batch hashes
+    enum class HashKernel {
+        Auto,    ///< The fastest one this CPU supports
+        Scalar,  ///< One message at a time through OpenSSL
+        ShaNi,   ///< x86 SHA extensions
+        Avx2,    ///< 8 messages side by side
+        Avx512   ///< 16 messages side by side
+    };
+    
+    /// Compute the SHA256 hashes of many messages at once
+    /// @param inputs The messages to hash
+    /// @param outputs Receives one hash per message
+    /// @param count The number of messages
+    /// @param kernel The implementation to use
+    /// @throws IllegalArgumentException if the kernel is not supported on this CPU
+    static void sha256Many(const ByteSpan* inputs, Digest256* outputs, size_t count,
+                           HashKernel kernel = HashKernel::Auto);
+    
+    /// Compute the SHA256 hashes of many messages at once
+    /// @param inputs The messages to hash
+    /// @return One hash per message
+    static std::vector<Digest256> sha256Many(const std::vector<ByteSpan>& inputs);
+    
+    /// Compute SHA256 then RIPEMD160 of many messages at once
+    /// @param inputs The messages to hash
+    /// @param outputs Receives one hash per message
+    /// @param count The number of messages
+    /// @param kernel The implementation to use for SHA256; RIPEMD160 uses the widest vector unit available
+    /// @throws IllegalArgumentException if the kernel is not supported on this CPU
+    static void hash160Many(const ByteSpan* inputs, Digest160* outputs, size_t count,
+                            HashKernel kernel = HashKernel::Auto);
+    
+    /// Check whether a batch kernel can run on this CPU
+    static bool isKernelSupported(HashKernel kernel);
+    
+    /// Get the kernel that HashKernel::Auto selects
+    static HashKernel preferredKernel();
+    
     /// Compute HMAC-SHA256
     /// @param key The HMAC key
     /// @param data The data to authenticate
@@ -40,4 +124,56 @@ public:
     static Bytes hmacSha256(const Bytes& key, const Bytes& data);
 };
 
-} // namespace epicchaincpp
\ No newline at end of file
+/// Incremental SHA256, for hashing data that arrives in pieces.
+///
+/// The digest context is borrowed from a per-thread pool and returned on
+/// destruction, so hashers can be created freely without allocating. Small
+/// updates are gathered inline before reaching OpenSSL, which makes the hasher
+/// cheap to use as the sink of a BinaryWriter, one field at a time.
+class Sha256Hasher : public BinarySink {
+private:
+    EVP_MD_CTX* ctx_;
+    std::array<uint8_t, 128> pending_;
+    size_t pendingSize_ = 0;
+    bool finished_ = false;
+    
+    void restart();
+    void updateLarge(const uint8_t* data, size_t length);
+    
+public:
+    Sha256Hasher();
+    ~Sha256Hasher() override;
+    
+    Sha256Hasher(const Sha256Hasher&) = delete;
+    Sha256Hasher& operator=(const Sha256Hasher&) = delete;
+    
+    /// Append data to the hash
+    /// @param data The data to append
+    /// @param length The number of bytes to append
+    void update(const uint8_t* data, size_t length) {
+        if (finished_) {
+            restart();
+        }
+        if (length < pending_.size() && pendingSize_ + length <= pending_.size()) {
+            if (length > 0) {
+                std::memcpy(pending_.data() + pendingSize_, data, length);
+                pendingSize_ += length;
+            }
+        } else {
+            updateLarge(data, length);
+        }
+    }
+    void update(const Bytes& data) { update(data.data(), data.size()); }
+    
+    void write(const uint8_t* data, size_t length) override { update(data, length); }
+    
+    /// Finish the hash and start over
+    /// @param out Receives the hash
+    void final(Digest256& out);
+    
+    /// Finish the hash and start over
+    /// @return The hash
+    Digest256 final();
+};
+
+} // namespace epicchaincpp
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include "epicchaincpp/types/types.hpp"
+
+namespace epicchaincpp {
+
+// Forward declarations
+class ECDSASignature;
+class ECPublicKey;
+class ThreadPool;
+
+/// A signature check queued in a SignatureBatchVerifier
+struct SignatureBatchItem {
+    /// SHA-256 digest of the signed message
+    Bytes messageHash;
+    SharedPtr<ECDSASignature> signature;
+    SharedPtr<ECPublicKey> publicKey;
+};
+
+/// Outcome of a batch verification
+struct SignatureBatchResult {
+    /// Per-item result, in the order the items were added
+    std::vector<bool> valid;
+    
+    /// Indices of the items that failed, in ascending order
+    std::vector<size_t> failed;
+    
+    /// Check whether every signature in the batch was valid
+    bool allValid() const { return failed.empty(); }
+};
+
+/// Verifies many ECDSA signatures at once, e.g. all witnesses of a block.
+/// Items are checked in parallel on a thread pool. Each worker thread keeps
+/// its own cache of parsed OpenSSL public keys, so keys that sign many items
+/// (consensus nodes, hot wallets) are decoded once per thread.
+class SignatureBatchVerifier {
+private:
+    SharedPtr<ThreadPool> pool_;
+    std::vector<SignatureBatchItem> items_;
+
+public:
+    /// Constructor using the process-wide thread pool
+    SignatureBatchVerifier();
+    
+    /// Constructor with a dedicated thread pool
+    /// @param pool The pool to verify on
+    explicit SignatureBatchVerifier(const SharedPtr<ThreadPool>& pool);
+    
+    /// Queue a signature check
+    /// @param messageHash SHA-256 digest of the signed message (32 bytes)
+    /// @param signature The signature
+    /// @param publicKey The public key expected to have signed
+    /// @return The index of the item in the batch
+    size_t add(const Bytes& messageHash, const SharedPtr<ECDSASignature>& signature,
+               const SharedPtr<ECPublicKey>& publicKey);
+    
+    /// Get the number of queued items
+    size_t size() const { return items_.size(); }
+    
+    /// Remove all queued items
+    void clear() { items_.clear(); }
+    
+    /// Verify every queued item. Malformed items count as failures.
+    /// @return Which items passed and which failed
+    SignatureBatchResult verify() const;
+    
+    /// Verify one signature on the calling thread, using its cached key state
+    /// @param messageHash SHA-256 digest of the signed message (32 bytes)
+    /// @param signature The signature
+    /// @param publicKey The public key
+    /// @return True if the signature is valid
+    static bool verifyHash(const Bytes& messageHash, const SharedPtr<ECDSASignature>& signature,
+                           const SharedPtr<ECPublicKey>& publicKey);
+};
+
+} // namespace epicchaincpp
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <functional>
 #include "epicchaincpp/types/types.hpp"
 #include "epicchaincpp/crypto/scrypt_params.hpp"
 
@@ -9,6 +11,69 @@ namespace epicchaincpp {
 // Forward declaration
 class ECKeyPair;
 
+/// Progress of a bulk XEP-2 operation, reported after each key
+struct XEP2BulkProgress {
+    /// Keys finished so far, successfully or not
+    size_t completed = 0;
+    
+    /// Keys that failed so far
+    size_t failed = 0;
+    
+    /// Keys in the batch
+    size_t total = 0;
+    
+    /// Scrypt derivations allowed to run at once
+    size_t concurrency = 0;
+    
+    /// Seconds since the batch started
+    double elapsedSeconds = 0;
+};
+
+/// Limits for bulk XEP-2 operations. Each scrypt derivation holds about
+/// XEP2::scryptMemory(params) bytes while it runs, so the number running at
+/// once is capped by both the thread count and the memory limit.
+struct XEP2BulkOptions {
+    /// Derivations to run at once; 0 uses the hardware concurrency
+    size_t threads = 0;
+    
+    /// Upper bound on the scrypt memory of all derivations running at once, in bytes.
+    /// At least one derivation always runs.
+    size_t memoryLimit = 256 * 1024 * 1024;
+    
+    /// Called after each key, one call at a time, from whichever thread finished it
+    std::function<void(const XEP2BulkProgress&)> onProgress;
+};
+
+/// Outcome of decrypting one key in a batch
+struct XEP2DecryptResult {
+    /// The decrypted private key; empty on failure
+    Bytes privateKey;
+    
+    /// Why decryption failed; empty on success
+    std::string error;
+    
+    /// Seconds spent on this key
+    double seconds = 0;
+    
+    /// Check whether the key was decrypted
+    bool succeeded() const { return error.empty(); }
+};
+
+/// Outcome of encrypting one key in a batch
+struct XEP2EncryptResult {
+    /// The XEP-2 encrypted key; empty on failure
+    std::string xep2;
+    
+    /// Why encryption failed; empty on success
+    std::string error;
+    
+    /// Seconds spent on this key
+    double seconds = 0;
+    
+    /// Check whether the key was encrypted
+    bool succeeded() const { return error.empty(); }
+};
+
 /// XEP-2 (Neo Enhancement Proposal 2) encryption/decryption for private keys
 class XEP2 {
 public:
@@ -40,6 +105,42 @@ public:
     /// @return The decrypted key pair
     static ECKeyPair decryptToKeyPair(const std::string& xep2, const std::string& password, const ScryptParams& params = ScryptParams::getDefault());
     
+    /// Decrypt many XEP-2 keys with the same password, running the scrypt
+    /// derivations in parallel within the limits of options. A key that fails
+    /// is reported in its result without affecting the rest of the batch.
+    /// @param keys The XEP-2 encrypted strings
+    /// @param password The password to use for decryption
+    /// @param params The scrypt parameters
+    /// @param options Thread, memory and progress settings
+    /// @return One result per key, in input order
+    static std::vector<XEP2DecryptResult> decryptAll(const std::vector<std::string>& keys, const std::string& password,
+                                                     const ScryptParams& params = ScryptParams::getDefault(),
+                                                     const XEP2BulkOptions& options = XEP2BulkOptions());
+    
+    /// Encrypt many private keys with the same password, running the scrypt
+    /// derivations in parallel within the limits of options. A key that fails
+    /// is reported in its result without affecting the rest of the batch.
+    /// @param privateKeys The 32-byte private keys
+    /// @param password The password to use for encryption
+    /// @param params The scrypt parameters
+    /// @param options Thread, memory and progress settings
+    /// @return One result per key, in input order
+    static std::vector<XEP2EncryptResult> encryptAll(const std::vector<Bytes>& privateKeys, const std::string& password,
+                                                     const ScryptParams& params = ScryptParams::getDefault(),
+                                                     const XEP2BulkOptions& options = XEP2BulkOptions());
+    
+    /// Get the memory one scrypt derivation needs
+    /// @param params The scrypt parameters
+    /// @return The size in bytes
+    static size_t scryptMemory(const ScryptParams& params);
+    
+    /// Get the number of derivations a bulk operation runs at once
+    /// @param count The number of keys
+    /// @param params The scrypt parameters
+    /// @param options Thread and memory settings
+    /// @return The concurrency, at least 1
+    static size_t bulkConcurrency(size_t count, const ScryptParams& params, const XEP2BulkOptions& options);
+    
     /// Validate a XEP-2 string format
     /// @param xep2 The XEP-2 string to validate
     /// @return True if valid format, false otherwise
@@ -55,6 +156,12 @@ private:
     static constexpr uint8_t XEP2_PREFIX_2 = 0x42;
     static constexpr uint8_t XEP2_FLAG = 0xE0;
     static constexpr size_t XEP2_ENCRYPTED_SIZE = 39;
+    
+    /// Validate and decode a XEP-2 string in one pass
+    /// @param xep2 The XEP-2 string
+    /// @param encrypted Receives the XEP2_ENCRYPTED_SIZE decoded bytes
+    /// @return False if the string is not a valid XEP-2 key
+    static bool tryDecode(const std::string& xep2, uint8_t* encrypted);
 };
 
 } // namespace epicchaincpp
\ No newline at end of file
@@ -41,6 +41,9 @@ public:
     /// The maximum number of attributes that a transaction can have.
     static constexpr int MAX_TRANSACTION_ATTRIBUTES = 16;
     
+    /// The maximum number of signers that a transaction can have.
+    static constexpr int MAX_SIGNERS = 16;
+    
     /// The maximum number of contracts or groups a signer scope can contain.
     static constexpr int MAX_SIGNER_SUBITEMS = 16;
     
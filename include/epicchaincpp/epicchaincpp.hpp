@@ -52,8 +52,9 @@
 
 // Protocol/RPC
 #include "epicchaincpp/protocol/neo_cpp.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
 #include "epicchaincpp/protocol/http_service.hpp"
+#include "epicchaincpp/protocol/subscription_client.hpp"
 #include "epicchaincpp/protocol/response_types_impl.hpp"
 #include "epicchaincpp/protocol/stack_item.hpp"
 
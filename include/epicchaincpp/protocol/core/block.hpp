@@ -0,0 +1,109 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include "epicchaincpp/types/types.hpp"
+#include "epicchaincpp/types/hash160.hpp"
+#include "epicchaincpp/types/hash256.hpp"
+#include "epicchaincpp/serialization/epicchain_serializable.hpp"
+
+namespace epicchaincpp {
+
+// Forward declarations
+class Witness;
+class Transaction;
+class BinaryWriter;
+class BinaryReader;
+
+/// Represents an EpicChain block header as serialized on the wire
+class Header : public NeoSerializable {
+private:
+    uint32_t version_;
+    Hash256 previousHash_;
+    Hash256 merkleRoot_;
+    uint64_t timestamp_;
+    uint64_t nonce_;
+    uint32_t index_;
+    uint8_t primaryIndex_;
+    Hash160 nextConsensus_;
+    SharedPtr<Witness> witness_;
+    
+    mutable Hash256 hash_;
+    mutable bool hashCalculated_;
+    
+public:
+    /// Constructor
+    Header();
+    
+    /// Destructor
+    ~Header() = default;
+    
+    // Getters
+    uint32_t getVersion() const { return version_; }
+    const Hash256& getPreviousHash() const { return previousHash_; }
+    const Hash256& getMerkleRoot() const { return merkleRoot_; }
+    uint64_t getTimestamp() const { return timestamp_; }
+    uint64_t getNonce() const { return nonce_; }
+    uint32_t getIndex() const { return index_; }
+    uint8_t getPrimaryIndex() const { return primaryIndex_; }
+    const Hash160& getNextConsensus() const { return nextConsensus_; }
+    const SharedPtr<Witness>& getWitness() const { return witness_; }
+    
+    /// Get the block hash (SHA-256 of the unsigned header)
+    /// @return The block hash
+    const Hash256& getHash() const;
+    
+    // NeoSerializable interface
+    size_t getSize() const override;
+    void serialize(BinaryWriter& writer) const override;
+    static SharedPtr<Header> deserialize(BinaryReader& reader);
+    
+    /// Serialize the header without its witness
+    void serializeUnsigned(BinaryWriter& writer) const;
+    
+    /// Size of the header without its witness in bytes
+    static constexpr size_t UNSIGNED_SIZE = 4 + 32 + 32 + 8 + 8 + 4 + 1 + 20;
+};
+
+/// Represents an EpicChain block decoded from its binary form
+/// Lets callers fetch non-verbose (base64) blocks, which are far smaller
+/// than verbose JSON, and decode them natively.
+class Block : public NeoSerializable {
+private:
+    SharedPtr<Header> header_;
+    std::vector<SharedPtr<Transaction>> transactions_;
+    
+public:
+    /// Constructor
+    Block();
+    
+    /// Destructor
+    ~Block() = default;
+    
+    /// Get the block header
+    const SharedPtr<Header>& getHeader() const { return header_; }
+    
+    /// Get the transactions
+    const std::vector<SharedPtr<Transaction>>& getTransactions() const { return transactions_; }
+    
+    /// Get the block hash
+    const Hash256& getHash() const { return header_->getHash(); }
+    
+    /// Get the block index
+    uint32_t getIndex() const { return header_->getIndex(); }
+    
+    // NeoSerializable interface
+    size_t getSize() const override;
+    void serialize(BinaryWriter& writer) const override;
+    static SharedPtr<Block> deserialize(BinaryReader& reader);
+    
+    /// Decode a block from the base64 string returned by getblock with verbose=false
+    /// @param base64 The base64-encoded block
+    /// @return The decoded block
+    static SharedPtr<Block> fromBase64(const std::string& base64);
+    
+    /// Maximum number of transactions in a block
+    static constexpr uint64_t MAX_TRANSACTIONS_PER_BLOCK = 0xFFFF;
+};
+
+} // namespace epicchaincpp
@@ -13,7 +13,7 @@
 namespace epicchaincpp {
 
 // Forward declarations
-class NeoRpcClient;
+class EpicChainRpcClient;
 class HttpService;
 class BlockPolling;
 class Signer;
@@ -47,7 +47,7 @@ class StackItem;
 /// Main Neo blockchain interface
 class Neo {
 protected:
-    SharedPtr<NeoRpcClient> rpcClient_;
+    SharedPtr<EpicChainRpcClient> rpcClient_;
     SharedPtr<HttpService> httpService_;
     SharedPtr<BlockPolling> blockPolling_;
     std::string rpcUrl_;
@@ -64,7 +64,7 @@ public:
     virtual ~Neo() = default;
     
     /// Get RPC client
-    SharedPtr<NeoRpcClient> getRpcClient() const { return rpcClient_; }
+    SharedPtr<EpicChainRpcClient> getRpcClient() const { return rpcClient_; }
     
     /// Get HTTP service
     SharedPtr<HttpService> getHttpService() const { return httpService_; }
@@ -5,66 +5,215 @@
 #include <thread>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <vector>
+#include <nlohmann/json.hpp>
 #include "epicchaincpp/types/types.hpp"
 
 namespace epicchaincpp {
 
 // Forward declaration
-class NeoRpcClient;
+class EpicChainRpcClient;
 
-/// Block polling service for monitoring new blocks
+/// A block delivered to BlockPolling subscribers
+struct BlockEvent {
+    uint32_t index = 0;
+    
+    /// The verbose getblock result, if BlockPollingConfig::fetchBlocks is set
+    nlohmann::json block;
+    
+    /// getapplicationlog results for the block (OnPersist/PostPersist) followed
+    /// by one per transaction, if BlockPollingConfig::fetchApplicationLogs is set
+    std::vector<nlohmann::json> applicationLogs;
+    
+    /// When the poller first saw the block
+    std::chrono::steady_clock::time_point observedAt;
+};
+
+/// BlockPolling settings
+struct BlockPollingConfig {
+    /// Expected time between blocks, used until enough blocks have been seen
+    /// to measure it
+    std::chrono::milliseconds expectedBlockTime{15000};
+    
+    /// Shortest wait between polls, used once the next block is due
+    std::chrono::milliseconds minPollInterval{100};
+    
+    /// Longest wait between polls
+    std::chrono::milliseconds maxPollInterval{1000};
+    
+    /// Blocks fetched but not yet delivered. When the queue is full the poller
+    /// stops fetching until subscribers catch up.
+    size_t queueCapacity = 64;
+    
+    /// Fetch each block for subscribers
+    bool fetchBlocks = false;
+    
+    /// Fetch the application logs of each block and its transactions.
+    /// Implies fetchBlocks, since the transaction hashes come from the block.
+    bool fetchApplicationLogs = false;
+};
+
+/// Delivery statistics
+struct BlockPollingMetrics {
+    /// Latest chain height seen by the poller
+    uint32_t chainHeight = 0;
+    
+    /// Last block index delivered to subscribers
+    uint32_t deliveredHeight = 0;
+    
+    /// Blocks the subscribers are behind the chain
+    uint32_t lagBlocks = 0;
+    
+    /// Blocks waiting in the dispatch queue
+    size_t queueDepth = 0;
+    
+    /// Time from first seeing the last delivered block to its subscribers returning
+    std::chrono::milliseconds lastDeliveryLatency{0};
+    
+    /// Current estimate of the time between blocks
+    std::chrono::milliseconds estimatedBlockTime{0};
+    
+    uint64_t polls = 0;
+    uint64_t errors = 0;
+    uint64_t delivered = 0;
+};
+
+/// Block polling service for monitoring new blocks.
+///
+/// Every block height is delivered once and in order, even when several
+/// blocks land between two polls. A poller thread fetches new heights (and
+/// optionally the blocks and their application logs) into a bounded queue;
+/// a dispatcher thread hands them to the subscribers. Polls are scheduled
+/// from the measured block time: the poller waits until the next block is
+/// due and then polls at the minimum interval until it arrives.
 class BlockPolling {
+public:
+    using IndexCallback = std::function<void(uint32_t)>;
+    using BlockCallback = std::function<void(const BlockEvent&)>;
+
 private:
-    SharedPtr<NeoRpcClient> rpcClient_;
-    std::vector<std::function<void(uint32_t)>> callbacks_;
+    SharedPtr<EpicChainRpcClient> rpcClient_;
+    BlockPollingConfig config_;
+    
+    std::mutex subscribersMutex_;
+    std::vector<std::pair<size_t, BlockCallback>> subscribers_;
+    size_t nextSubscriptionId_;
+    
+    mutable std::mutex queueMutex_;
+    std::condition_variable queueNotEmpty_;
+    std::condition_variable queueNotFull_;
+    std::condition_variable wakeUp_;
+    std::deque<BlockEvent> queue_;
+    
     std::atomic<bool> running_;
     std::atomic<uint32_t> lastBlockIndex_;
+    bool hasDelivered_;
+    
+    // Poller position: the next index to fetch, and the first index of the run
+    bool hasNextIndex_;
+    uint32_t nextIndex_;
+    uint32_t firstIndex_;
+    
     std::unique_ptr<std::thread> pollingThread_;
-    std::chrono::milliseconds pollInterval_;
+    std::unique_ptr<std::thread> dispatchThread_;
+    
+    mutable std::mutex metricsMutex_;
+    BlockPollingMetrics metrics_;
     
+    // Block time measurement
+    bool hasSeenHeight_;
+    bool arrivalObserved_;
+    uint32_t seenHeight_;
+    std::chrono::steady_clock::time_point lastBlockSeenAt_;
+
 public:
     /// Constructor
     /// @param rpcClient The RPC client
-    /// @param pollInterval The polling interval in milliseconds
-    explicit BlockPolling(const SharedPtr<NeoRpcClient>& rpcClient, 
+    /// @param pollInterval The longest wait between polls
+    explicit BlockPolling(const SharedPtr<EpicChainRpcClient>& rpcClient,
                          std::chrono::milliseconds pollInterval = std::chrono::milliseconds(1000));
     
+    /// Constructor with full settings
+    /// @param rpcClient The RPC client
+    /// @param config The settings
+    BlockPolling(const SharedPtr<EpicChainRpcClient>& rpcClient, const BlockPollingConfig& config);
+    
     /// Destructor
     ~BlockPolling();
     
-    /// Start polling
+    /// Start polling. Delivery starts at the current chain tip, or where a
+    /// previous run stopped.
     void start();
     
-    /// Stop polling
+    /// Start polling, delivering every block from a given index on
+    /// @param startIndex The first block index to deliver
+    void start(uint32_t startIndex);
+    
+    /// Stop polling. Undelivered blocks are dropped and fetched again by
+    /// the next start().
     void stop();
     
     /// Check if polling is running
     /// @return True if polling
     bool isRunning() const { return running_; }
     
-    /// Subscribe to block updates
+    /// Subscribe to block indices. Safe to call while polling.
+    /// @param callback The callback function
+    /// @return Subscription ID for unsubscribe()
+    size_t subscribe(IndexCallback callback);
+    
+    /// Subscribe to blocks, with the data selected in the config. Safe to call while polling.
     /// @param callback The callback function
-    void subscribe(std::function<void(uint32_t)> callback);
+    /// @return Subscription ID for unsubscribe()
+    size_t subscribeBlocks(BlockCallback callback);
+    
+    /// Remove a subscription
+    /// @param subscriptionId The ID returned by subscribe()
+    void unsubscribe(size_t subscriptionId);
     
     /// Clear all subscriptions
     void clearSubscriptions();
     
-    /// Get last block index
+    /// Get last block index delivered to subscribers
     /// @return The last block index
     uint32_t getLastBlockIndex() const { return lastBlockIndex_; }
     
-    /// Set poll interval
+    /// Set the longest wait between polls. Safe to call while polling.
+    /// The shortest wait is lowered to match if it exceeds the new interval.
     /// @param interval The interval in milliseconds
-    void setPollInterval(std::chrono::milliseconds interval) { pollInterval_ = interval; }
+    /// @throws IllegalArgumentException if the interval is not positive
+    void setPollInterval(std::chrono::milliseconds interval);
     
+    /// Get the delivery statistics
+    /// @return The metrics
+    BlockPollingMetrics getMetrics() const;
+
 private:
     /// Polling loop
     void pollLoop();
     
+    /// Dispatch loop
+    void dispatchLoop();
+    
+    /// Fetch new heights up to the tip into the queue
+    /// @return True if heights up to the tip remain to be fetched
+    bool pollOnce();
+    
+    /// Build the event for one block index
+    BlockEvent fetchEvent(uint32_t index, std::chrono::steady_clock::time_point observedAt);
+    
+    /// Record the chain tip in the metrics and the block time estimate
+    void recordTip(uint32_t tip, std::chrono::steady_clock::time_point now);
+    
+    /// Time to wait before the next poll; call with queueMutex_ held
+    std::chrono::milliseconds nextPollDelay() const;
+    
     /// Notify subscribers
-    /// @param blockIndex The new block index
-    void notifySubscribers(uint32_t blockIndex);
+    /// @param event The block
+    void notifySubscribers(const BlockEvent& event);
 };
 
-} // namespace epicchaincpp
\ No newline at end of file
+} // namespace epicchaincpp
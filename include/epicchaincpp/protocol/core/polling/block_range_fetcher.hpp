@@ -0,0 +1,121 @@
+#pragma once
+
+#include <memory>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <map>
+#include <vector>
+#include <exception>
+#include "epicchaincpp/types/types.hpp"
+
+namespace epicchaincpp {
+
+// Forward declarations
+class EpicChainRpcClient;
+class EpicChainGetBlockResponse;
+
+/// Block range fetcher settings
+struct BlockRangeFetcherConfig {
+    /// Number of concurrent download workers
+    size_t workers = 8;
+    
+    /// Maximum number of blocks fetched ahead of the next one to deliver
+    size_t reorderBufferSize = 256;
+    
+    /// Whether to request verbose (JSON) blocks
+    bool verbose = true;
+    
+    /// Attempts per height before the fetch fails
+    uint32_t maxAttempts = 5;
+    
+    /// Delay before the first retry; doubled on each further retry
+    std::chrono::milliseconds initialBackoff{200};
+    
+    /// Upper bound for the retry delay
+    std::chrono::milliseconds maxBackoff{10000};
+};
+
+/// Block range fetcher throughput metrics
+struct BlockRangeMetrics {
+    /// Blocks delivered to the consumer
+    uint64_t blocks = 0;
+    
+    /// Serialized size of the delivered blocks, as reported by the node
+    uint64_t bytes = 0;
+    
+    /// Failed attempts that were retried
+    uint64_t retries = 0;
+    
+    /// Time since the fetch started
+    double elapsedSeconds = 0.0;
+    
+    double blocksPerSecond() const { return elapsedSeconds > 0 ? blocks / elapsedSeconds : 0.0; }
+    double bytesPerSecond() const { return elapsedSeconds > 0 ? bytes / elapsedSeconds : 0.0; }
+};
+
+/// Downloads a range of blocks with concurrent workers for historical sync.
+/// Blocks are fetched out of order but delivered strictly in height order
+/// through a bounded reorder buffer, so memory stays bounded however far
+/// the workers could otherwise run ahead of a slow consumer.
+class BlockRangeFetcher {
+public:
+    using BlockCallback = std::function<void(uint32_t index, const SharedPtr<EpicChainGetBlockResponse>& block)>;
+    
+private:
+    SharedPtr<EpicChainRpcClient> rpcClient_;
+    BlockRangeFetcherConfig config_;
+    
+    mutable std::mutex mutex_;
+    std::condition_variable workAvailable_;
+    std::condition_variable blockReady_;
+    std::map<uint32_t, SharedPtr<EpicChainGetBlockResponse>> buffer_;
+    uint32_t nextToFetch_;
+    uint32_t nextToDeliver_;
+    uint32_t end_;
+    std::exception_ptr error_;
+    std::atomic<bool> cancelled_;
+    
+    std::atomic<uint64_t> blocks_;
+    std::atomic<uint64_t> bytes_;
+    std::atomic<uint64_t> retries_;
+    std::chrono::steady_clock::time_point startTime_;
+    
+public:
+    /// Constructor
+    /// @param rpcClient The RPC client
+    /// @param config The fetcher settings
+    explicit BlockRangeFetcher(const SharedPtr<EpicChainRpcClient>& rpcClient,
+                               const BlockRangeFetcherConfig& config = BlockRangeFetcherConfig());
+    
+    /// Fetch blocks [start, end) and deliver them in height order
+    /// Blocks until the range is delivered, the fetch is cancelled, or it fails.
+    /// The consumer runs on the calling thread.
+    /// @param start The first block index
+    /// @param end One past the last block index
+    /// @param consumer Invoked once per block, in ascending height order
+    /// @throws The last error for a height that ran out of attempts, or the consumer's exception
+    void fetch(uint32_t start, uint32_t end, const BlockCallback& consumer);
+    
+    /// Stop an ongoing fetch; blocks already delivered stay delivered
+    void cancel();
+    
+    /// Get throughput metrics of the current or last fetch
+    /// @return The metrics
+    BlockRangeMetrics getMetrics() const;
+    
+private:
+    /// Worker loop claiming heights inside the reorder window
+    void workerLoop();
+    
+    /// Fetch one height, retrying with exponential backoff
+    SharedPtr<EpicChainGetBlockResponse> fetchWithRetry(uint32_t index);
+    
+    /// Record a failure and wake every thread so the fetch unwinds
+    void fail(std::exception_ptr error);
+};
+
+} // namespace epicchaincpp
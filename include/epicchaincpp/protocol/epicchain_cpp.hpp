@@ -4,7 +4,7 @@
 #include <memory>
 #include <chrono>
 #include "epicchaincpp/types/hash160.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
 #include "epicchaincpp/protocol/http_service.hpp"
 
 namespace epicchaincpp {
@@ -43,7 +43,7 @@ class EpicChainCpp {
 private:
     EpicChainCppConfig config_;
     SharedPtr<HttpService> httpService_;
-    SharedPtr<NeoRpcClient> rpcClient_;
+    SharedPtr<EpicChainRpcClient> rpcClient_;
     
 public:
     /// Constructor with configuration and HTTP service
@@ -101,11 +101,11 @@ public:
     
     /// Get the underlying RPC client
     /// @return The RPC client
-    SharedPtr<NeoRpcClient> getRpcClient() { return rpcClient_; }
+    SharedPtr<EpicChainRpcClient> getRpcClient() { return rpcClient_; }
     
     /// Get the underlying RPC client (const version)
     /// @return The RPC client
-    SharedPtr<const NeoRpcClient> getRpcClient() const { return rpcClient_; }
+    SharedPtr<const EpicChainRpcClient> getRpcClient() const { return rpcClient_; }
     
     // Convenience methods that delegate to RPC client
     
@@ -121,24 +121,24 @@ public:
     /// @param hash The block hash
     /// @param verbose Whether to return verbose data
     /// @return The block information
-    SharedPtr<NeoGetBlockResponse> getBlock(const Hash256& hash, bool verbose = true);
+    SharedPtr<EpicChainGetBlockResponse> getBlock(const Hash256& hash, bool verbose = true);
     
     /// Get a block by its index
     /// @param index The block index
     /// @param verbose Whether to return verbose data
     /// @return The block information
-    SharedPtr<NeoGetBlockResponse> getBlock(uint32_t index, bool verbose = true);
+    SharedPtr<EpicChainGetBlockResponse> getBlock(uint32_t index, bool verbose = true);
     
     /// Get transaction by its hash
     /// @param txId The transaction ID
     /// @param verbose Whether to return verbose data
     /// @return The transaction information
-    SharedPtr<NeoGetRawTransactionResponse> getTransaction(const Hash256& txId, bool verbose = true);
+    SharedPtr<EpicChainGetRawTransactionResponse> getTransaction(const Hash256& txId, bool verbose = true);
     
     /// Get contract state
     /// @param scriptHash The contract script hash
     /// @return The contract state
-    SharedPtr<NeoGetContractStateResponse> getContractState(const Hash160& scriptHash);
+    SharedPtr<EpicChainGetContractStateResponse> getContractState(const Hash160& scriptHash);
     
     /// Get XEP-17 balances for an address
     /// @param address The address to query
@@ -151,7 +151,7 @@ public:
     /// @param params The parameters
     /// @param signers The signers (optional)
     /// @return The invocation result
-    SharedPtr<NeoInvokeResultResponse> invokeFunction(const Hash160& scriptHash,
+    SharedPtr<EpicChainInvokeResultResponse> invokeFunction(const Hash160& scriptHash,
                                                       const std::string& method,
                                                       const nlohmann::json& params = nlohmann::json::array(),
                                                       const nlohmann::json& signers = nlohmann::json::array());
@@ -168,7 +168,7 @@ public:
     
     /// Get the version information
     /// @return Version information
-    SharedPtr<NeoGetVersionResponse> getVersion();
+    SharedPtr<EpicChainGetVersionResponse> getVersion();
 };
 
 } // namespace epicchaincpp
\ No newline at end of file
@@ -4,10 +4,15 @@
 #include <memory>
 #include <vector>
 #include <functional>
+#include <future>
+#include <atomic>
+#include <exception>
 #include <nlohmann/json.hpp>
 #include "epicchaincpp/types/types.hpp"
 #include "epicchaincpp/types/hash256.hpp"
 #include "epicchaincpp/types/hash160.hpp"
+#include "epicchaincpp/protocol/rpc_batcher.hpp"
+#include "epicchaincpp/protocol/rpc_response_sax.hpp"
 
 namespace epicchaincpp {
 
@@ -31,9 +36,13 @@ class EpicChainRpcClient {
 private:
     std::string url_;
     SharedPtr<HttpService> httpService_;
-    int requestId_;
+    std::atomic<int> requestId_;
+    SharedPtr<RpcBatcher> batcher_;
     
 public:
+    /// Callback for async requests; exactly one of result or error is set
+    using RpcCallback = std::function<void(const nlohmann::json& result, std::exception_ptr error)>;
+    
     /// Constructor
     /// @param url The RPC endpoint URL
     explicit EpicChainRpcClient(const std::string& url);
@@ -47,6 +56,9 @@ public:
     /// Set the RPC URL
     void setUrl(const std::string& url) { url_ = url; }
     
+    /// Get the underlying HTTP service
+    SharedPtr<HttpService> getHttpService() const { return httpService_; }
+    
     // Node methods
     
     /// Get node version information
@@ -147,6 +159,13 @@ public:
     /// @return Storage entries
     nlohmann::json findStorage(const Hash160& scriptHash, const std::string& prefix);
     
+    /// Find storage values, continuing a paged scan
+    /// @param scriptHash The contract script hash
+    /// @param prefix The key prefix (Base64)
+    /// @param start Index to resume from, taken from the previous page's "next"
+    /// @return One page: {"truncated", "next", "results"}
+    nlohmann::json findStorage(const Hash160& scriptHash, const std::string& prefix, int start);
+    
     // Invocation methods
     
     /// Invoke contract function (read-only)
@@ -270,7 +289,129 @@ public:
     /// @return The responses
     std::vector<nlohmann::json> sendBatch(const std::vector<std::pair<std::string, nlohmann::json>>& requests);
     
+    // Streaming methods
+    //
+    // These parse the response while it downloads and hand the elements of
+    // large result arrays to a callback instead of keeping them, so memory
+    // stays bounded by one element. They bypass auto-batching.
+    
+    /// Send raw JSON-RPC request, streaming selected result arrays
+    /// @param method The RPC method name
+    /// @param params The parameters
+    /// @param streamedPaths Result arrays to stream, e.g. "tx" (see RpcResponseSax)
+    /// @param onElement Called with each element of a streamed array
+    /// @return The result, with the streamed arrays empty
+    nlohmann::json sendRequestStreamed(const std::string& method, const nlohmann::json& params,
+                                       const std::vector<std::string>& streamedPaths,
+                                       const RpcResponseSax::ElementCallback& onElement);
+    
+    /// Get a verbose block, streaming its transactions
+    /// @param index The block index
+    /// @param onTransaction Called with each transaction, in block order
+    /// @return The block header fields; getTransactions() is empty
+    SharedPtr<EpicChainGetBlockResponse> getBlockStreamed(uint32_t index,
+                                                          const std::function<void(nlohmann::json&&)>& onTransaction);
+    
+    /// Get an application log, streaming its notifications
+    /// @param hash The transaction or block hash
+    /// @param onNotification Called with each notification, in execution order
+    /// @return The log, with the executions' notifications empty
+    SharedPtr<EpicChainGetApplicationLogResponse> getApplicationLogStreamed(const Hash256& hash,
+                                                                            const std::function<void(nlohmann::json&&)>& onNotification);
+    
+    // Auto-batching
+    
+    /// Coalesce individual calls into JSON-RPC batches
+    /// Calls issued from any thread within the configured window are sent as
+    /// one batch request and their results routed back to each caller.
+    /// sendBatch is unaffected and always sends its batch directly.
+    /// @param config The batching settings
+    void enableAutoBatching(const RpcBatchConfig& config = RpcBatchConfig());
+    
+    /// Send every call as its own request again
+    /// Calls already queued are still delivered through their batch.
+    void disableAutoBatching();
+    
+    /// Check whether auto-batching is enabled
+    /// @return True if calls are being coalesced
+    bool isAutoBatchingEnabled() const;
+    
+    /// Get auto-batching statistics
+    /// @return The statistics, or zeros if auto-batching is disabled
+    RpcBatchStats getBatchStats() const;
+    
+    // Async methods
+    //
+    // These return immediately; requests are multiplexed by the HttpService
+    // event loop, so hundreds can be outstanding without a thread per request.
+    // Results are parsed on the event-loop thread.
+    
+    /// Send raw JSON-RPC request asynchronously
+    /// @param method The RPC method name
+    /// @param params The parameters
+    /// @param callback Invoked on the event-loop thread with the result or the failure
+    void sendRequestAsync(const std::string& method, const nlohmann::json& params, RpcCallback callback);
+    
+    /// Send raw JSON-RPC request asynchronously
+    /// @param method The RPC method name
+    /// @param params The parameters
+    /// @return Future holding the result
+    std::future<nlohmann::json> sendRequestAsync(const std::string& method, const nlohmann::json& params = nlohmann::json::array());
+    
+    /// Get block count asynchronously
+    /// @return Future holding the current block count
+    std::future<uint32_t> getBlockCountAsync();
+    
+    /// Get block by hash asynchronously
+    /// @param hash The block hash
+    /// @param verbose Whether to return verbose data
+    /// @return Future holding the block information
+    std::future<SharedPtr<EpicChainGetBlockResponse>> getBlockAsync(const Hash256& hash, bool verbose = true);
+    
+    /// Get block by index asynchronously
+    /// @param index The block index
+    /// @param verbose Whether to return verbose data
+    /// @return Future holding the block information
+    std::future<SharedPtr<EpicChainGetBlockResponse>> getBlockAsync(uint32_t index, bool verbose = true);
+    
+    /// Get raw transaction asynchronously
+    /// @param txId The transaction ID
+    /// @param verbose Whether to return verbose data
+    /// @return Future holding the transaction information
+    std::future<SharedPtr<EpicChainGetRawTransactionResponse>> getRawTransactionAsync(const Hash256& txId, bool verbose = true);
+    
+    /// Get application log asynchronously
+    /// @param txId The transaction ID
+    /// @return Future holding the application log
+    std::future<SharedPtr<EpicChainGetApplicationLogResponse>> getApplicationLogAsync(const Hash256& txId);
+    
+    /// Invoke contract function (read-only) asynchronously
+    /// @param scriptHash The contract script hash
+    /// @param method The method name
+    /// @param params The parameters
+    /// @param signers Optional signers
+    /// @return Future holding the invocation result
+    std::future<SharedPtr<EpicChainInvokeResultResponse>> invokeFunctionAsync(const Hash160& scriptHash,
+                                                                         const std::string& method,
+                                                                         const nlohmann::json& params = nlohmann::json::array(),
+                                                                         const nlohmann::json& signers = nlohmann::json::array());
+    
+    /// Invoke script (read-only) asynchronously
+    /// @param script The script to invoke
+    /// @param signers Optional signers
+    /// @return Future holding the invocation result
+    std::future<SharedPtr<EpicChainInvokeResultResponse>> invokeScriptAsync(const Bytes& script,
+                                                                       const nlohmann::json& signers = nlohmann::json::array());
+    
+    /// Send raw transaction asynchronously
+    /// @param transaction The transaction to send
+    /// @return Future holding the transaction hash
+    std::future<Hash256> sendRawTransactionAsync(const SharedPtr<Transaction>& transaction);
+    
 private:
+    /// Post a single request, through the batcher when auto-batching is enabled
+    nlohmann::json post(const nlohmann::json& request);
+    
     /// Generate next request ID
     int getNextRequestId();
     
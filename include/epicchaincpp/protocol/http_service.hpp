@@ -4,7 +4,13 @@
 #include <unordered_map>
 #include <functional>
 #include <memory>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <exception>
 #include <nlohmann/json.hpp>
+#include "epicchaincpp/types/types.hpp"
 
 namespace epicchaincpp {
 
@@ -18,15 +24,65 @@ struct HttpResponse {
     bool isSuccess() const { return statusCode >= 200 && statusCode < 300; }
 };
 
+/// Connection pool settings for HttpService
+struct HttpPoolConfig {
+    /// Maximum number of requests in flight to a single host (0 = unlimited).
+    /// Callers beyond the limit wait for a connection to be released.
+    size_t maxConnectionsPerHost = 8;
+    
+    /// Pooled connections idle for longer than this are closed instead of reused
+    std::chrono::seconds idleTimeout{60};
+    
+    /// Share the connection, DNS and TLS session caches between all pooled handles
+    bool shareConnections = true;
+    
+    /// Negotiate HTTP/2 for async requests so they are multiplexed over few connections
+    bool multiplex = true;
+};
+
+/// Connection pool statistics
+struct HttpPoolStats {
+    /// Total number of requests performed
+    uint64_t requests = 0;
+    
+    /// Requests served by an already initialized pooled handle
+    uint64_t handleHits = 0;
+    
+    /// Number of new TCP connections that had to be opened
+    uint64_t newConnections = 0;
+    
+    /// Fraction of requests that reused an existing connection
+    double reuseRatio() const {
+        if (requests == 0 || newConnections >= requests) return 0.0;
+        return static_cast<double>(requests - newConnections) / static_cast<double>(requests);
+    }
+};
+
 /// HTTP service for making requests
+/// Requests are performed on pooled, keep-alive connections so consecutive
+/// calls to the same node skip the TCP and TLS handshakes.
+/// Async requests are driven by a single event-loop thread on the CURL multi
+/// interface, so many requests can be in flight without a thread per request.
 class HttpService {
 private:
+    class ConnectionPool;
+    class AsyncEngine;
+    
     std::string baseUrl_;
+    UniquePtr<ConnectionPool> pool_;
+    UniquePtr<AsyncEngine> async_;
+    std::once_flag asyncInit_;
+    
+    /// Get the event loop, starting it on first use
+    AsyncEngine& asyncEngine();
     
 public:
     using Headers = std::unordered_map<std::string, std::string>;
     using ResponseCallback = std::function<void(const HttpResponse&)>;
     
+    /// Callback for async JSON requests; exactly one of response or error is set
+    using JsonCallback = std::function<void(const nlohmann::json& response, std::exception_ptr error)>;
+    
     /// Constructor
     explicit HttpService(const std::string& baseUrl);
     
@@ -44,6 +100,23 @@ public:
     /// @param headers The headers to set
     void setDefaultHeaders(const Headers& headers);
     
+    /// Configure the connection pool
+    /// Idle connections are dropped so the new settings apply to every later request,
+    /// including async requests already queued but not yet started.
+    /// @param config The pool settings
+    void setPoolConfig(const HttpPoolConfig& config);
+    
+    /// Get the connection pool settings
+    /// @return The pool settings
+    HttpPoolConfig getPoolConfig() const;
+    
+    /// Get connection pool statistics
+    /// @return A snapshot of the pool counters
+    HttpPoolStats getPoolStats() const;
+    
+    /// Reset connection pool statistics
+    void resetPoolStats();
+    
     /// Perform GET request
     /// @param url The URL
     /// @param headers Optional additional headers
@@ -63,6 +136,14 @@ public:
     /// @return The JSON response
     nlohmann::json post(const nlohmann::json& data, const std::string& endpoint = "");
     
+    /// Perform JSON-RPC POST request, parsing the response as it downloads
+    /// The body is fed to the handler chunk by chunk and never held in full,
+    /// so handlers that keep only what they need bound memory for large results.
+    /// @param data The JSON data
+    /// @param handler SAX handler receiving the response, e.g. RpcResponseSax
+    /// @param endpoint Optional endpoint (default empty)
+    void post(const nlohmann::json& data, nlohmann::json_sax<nlohmann::json>& handler, const std::string& endpoint = "");
+    
     /// Perform JSON GET request
     /// @param endpoint The endpoint
     /// @return The JSON response
@@ -93,6 +174,28 @@ public:
     /// @param callback The response callback
     /// @param headers Optional additional headers
     void postAsync(const std::string& url, const std::string& body, ResponseCallback callback, const Headers& headers = {});
+    
+    /// Perform async JSON-RPC POST request
+    /// The callback runs on the event-loop thread and should return quickly.
+    /// @param data The JSON data
+    /// @param callback Invoked with the parsed response or the failure
+    /// @param endpoint Optional endpoint (default empty)
+    void postAsync(const nlohmann::json& data, JsonCallback callback, const std::string& endpoint = "");
+    
+    /// Perform async JSON-RPC POST request
+    /// @param data The JSON data
+    /// @param endpoint Optional endpoint (default empty)
+    /// @return Future holding the parsed response
+    std::future<nlohmann::json> postAsync(const nlohmann::json& data, const std::string& endpoint = "");
+    
+    /// Get the number of async requests queued or in flight
+    /// @return The number of pending async requests
+    size_t getPendingAsyncRequests() const;
+    
+    /// Check whether the caller is running on this service's event-loop thread,
+    /// i.e. inside an async callback, where waiting on another async request would deadlock
+    /// @return True on the event-loop thread
+    bool isEventLoopThread() const;
 };
 
 } // namespace epicchaincpp
\ No newline at end of file
@@ -12,6 +12,8 @@ namespace epicchaincpp {
 
 // Forward declarations
 class StackItem;
+class Block;
+class Transaction;
 using StackItemPtr = std::shared_ptr<StackItem>;
 
 /// Version response
@@ -72,6 +74,10 @@ public:
     bool hasNextBlockHash() const { return hasNextBlockHash_; }
     const nlohmann::json& getRawJson() const { return rawJson_; }
     
+    /// Get the natively decoded block
+    /// Only set for non-verbose responses; verbose responses keep transactions as JSON.
+    const SharedPtr<Block>& getBlock() const { return block_; }
+    
 private:
     Hash256 hash_;
     int size_ = 0;
@@ -87,6 +93,7 @@ private:
     Hash256 nextBlockHash_;
     bool hasNextBlockHash_ = false;
     nlohmann::json rawJson_;
+    SharedPtr<Block> block_;
 };
 
 /// Raw transaction response
@@ -111,6 +118,10 @@ public:
     uint64_t getBlockTime() const { return blockTime_; }
     const nlohmann::json& getRawJson() const { return rawJson_; }
     
+    /// Get the natively decoded transaction
+    /// Only set for non-verbose responses.
+    const SharedPtr<Transaction>& getTransaction() const { return transaction_; }
+    
 private:
     Hash256 hash_;
     int size_ = 0;
@@ -128,6 +139,7 @@ private:
     int confirmations_ = 0;
     uint64_t blockTime_ = 0;
     nlohmann::json rawJson_;
+    SharedPtr<Transaction> transaction_;
 };
 
 /// Application log response
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <nlohmann/json.hpp>
+#include "epicchaincpp/types/types.hpp"
+#include "epicchaincpp/protocol/http_service.hpp"
+
+namespace epicchaincpp {
+
+/// Auto-batching settings
+struct RpcBatchConfig {
+    /// Longest time a request waits for others to join its batch
+    std::chrono::microseconds maxDelay{2000};
+    
+    /// A batch is sent as soon as it holds this many requests
+    size_t maxBatchSize = 100;
+};
+
+/// Auto-batching statistics
+struct RpcBatchStats {
+    /// Individual requests submitted
+    uint64_t requests = 0;
+    
+    /// JSON-RPC batches sent
+    uint64_t batches = 0;
+    
+    /// Average number of requests per batch
+    double averageBatchSize() const {
+        return batches == 0 ? 0.0 : static_cast<double>(requests) / static_cast<double>(batches);
+    }
+};
+
+/// Coalesces individual JSON-RPC requests into batches.
+/// Requests submitted from any thread within a short window are sent as one
+/// JSON-RPC array; responses are matched back to each caller by request id.
+class RpcBatcher {
+private:
+    struct Pending {
+        nlohmann::json request;
+        HttpService::JsonCallback callback;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+    
+    SharedPtr<HttpService> httpService_;
+    RpcBatchConfig config_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Pending> pending_;
+    bool running_;
+    std::thread flusher_;
+    std::atomic<uint64_t> requests_{0};
+    std::atomic<uint64_t> batches_{0};
+    
+public:
+    /// Constructor
+    /// @param httpService The HTTP service batches are posted through
+    /// @param config The batching settings
+    RpcBatcher(const SharedPtr<HttpService>& httpService, const RpcBatchConfig& config = RpcBatchConfig());
+    
+    /// Destructor; sends any requests still waiting for their window
+    ~RpcBatcher();
+    
+    RpcBatcher(const RpcBatcher&) = delete;
+    RpcBatcher& operator=(const RpcBatcher&) = delete;
+    
+    /// Get the batching settings
+    const RpcBatchConfig& getConfig() const { return config_; }
+    
+    /// Queue a request for the next batch
+    /// The callback receives the response object carrying the request's id,
+    /// and runs on the HTTP event-loop thread.
+    /// @param request A complete JSON-RPC request object with a unique id
+    /// @param callback Invoked with the response or the failure
+    void submit(const nlohmann::json& request, HttpService::JsonCallback callback);
+    
+    /// Queue a request for the next batch
+    /// @param request A complete JSON-RPC request object with a unique id
+    /// @return Future holding the response object
+    std::future<nlohmann::json> submit(const nlohmann::json& request);
+    
+    /// Queue a request and wait for its response
+    /// Called from the event-loop thread (inside an async callback) the request
+    /// is sent on its own instead, since the batch could never be delivered.
+    /// @param request A complete JSON-RPC request object with a unique id
+    /// @return The response object
+    nlohmann::json call(const nlohmann::json& request);
+    
+    /// Get batching statistics
+    RpcBatchStats getStats() const;
+    
+private:
+    /// Collect requests into batches and send them
+    void flushLoop();
+    
+    /// Send one batch and route the responses
+    void send(std::vector<Pending> batch);
+};
+
+} // namespace epicchaincpp
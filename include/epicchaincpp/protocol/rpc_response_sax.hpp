@@ -0,0 +1,99 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace epicchaincpp {
+
+/// SAX handler assembling a JSON-RPC response as it is parsed.
+///
+/// Arrays of the result named by a streamed path are not kept: each of their
+/// elements is built on its own and handed to the callback as soon as its
+/// closing token is read, then discarded. The result keeps every other member,
+/// with streamed arrays left empty, so peak memory is bounded by the largest
+/// element rather than by the whole response.
+///
+/// Paths are object keys below the result joined with '/', ignoring array
+/// levels: "tx" streams the transactions of a verbose block, and
+/// "executions/notifications" the notifications of every execution in an
+/// application log.
+class RpcResponseSax : public nlohmann::json_sax<nlohmann::json> {
+public:
+    /// Receives one element of a streamed array, with the array's path
+    using ElementCallback = std::function<void(const std::string& path, nlohmann::json&& element)>;
+
+private:
+    /// Builds one JSON value from SAX events
+    class Builder {
+    public:
+        nlohmann::json root;
+        
+        void value(nlohmann::json&& value);
+        void key(const std::string& key);
+        void open(nlohmann::json&& container);
+        void close();
+        
+        size_t depth() const { return stack_.size(); }
+        bool inObject() const { return !stack_.empty() && stack_.back()->is_object(); }
+        void reset();
+    
+    private:
+        std::vector<nlohmann::json*> stack_;
+        nlohmann::json* slot_ = nullptr;
+        
+        nlohmann::json* insert(nlohmann::json&& value);
+    };
+    
+    std::vector<std::string> streamedPaths_;
+    ElementCallback onElement_;
+    
+    Builder response_;
+    std::vector<std::string> names_;
+    std::string currentKey_;
+    
+    // Set while inside a streamed array
+    bool streaming_ = false;
+    std::string streamPath_;
+    Builder element_;
+    size_t streamedElements_ = 0;
+    
+    void value(nlohmann::json&& value);
+    void emitIfComplete();
+    std::string pathOf(const std::string& name) const;
+
+public:
+    /// Constructor
+    /// @param streamedPaths Result arrays to stream instead of keeping
+    /// @param onElement Called with each element of a streamed array
+    explicit RpcResponseSax(std::vector<std::string> streamedPaths = {}, ElementCallback onElement = nullptr);
+    
+    /// Get the response assembled so far
+    nlohmann::json& getResponse() { return response_.root; }
+    
+    /// Take the result out of the response
+    /// @return The result, with streamed arrays empty
+    /// @throws RpcException if the response holds an error or no result
+    nlohmann::json takeResult();
+    
+    /// Get the number of elements handed to the callback
+    size_t getStreamedElements() const { return streamedElements_; }
+    
+    bool null() override;
+    bool boolean(bool value) override;
+    bool number_integer(number_integer_t value) override;
+    bool number_unsigned(number_unsigned_t value) override;
+    bool number_float(number_float_t value, const string_t& text) override;
+    bool string(string_t& value) override;
+    bool binary(binary_t& value) override;
+    bool start_object(std::size_t elements) override;
+    bool key(string_t& key) override;
+    bool end_object() override;
+    bool start_array(std::size_t elements) override;
+    bool end_array() override;
+    bool parse_error(std::size_t position, const std::string& lastToken,
+                     const nlohmann::detail::exception& error) override;
+};
+
+} // namespace epicchaincpp
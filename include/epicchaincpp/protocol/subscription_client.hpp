@@ -0,0 +1,250 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "epicchaincpp/types/types.hpp"
+#include "epicchaincpp/types/hash160.hpp"
+#include "epicchaincpp/types/hash256.hpp"
+
+namespace epicchaincpp {
+
+// Forward declaration
+class EpicChainRpcClient;
+
+/// Events offered by the node's WebSocket subscription interface
+enum class SubscriptionEvent {
+    BlockAdded,
+    TransactionAdded,
+    NotificationFromExecution,
+    TransactionExecuted
+};
+
+/// Get the wire name of an event, e.g. "block_added"
+std::string subscriptionEventName(SubscriptionEvent event);
+
+/// A block was added to the chain
+struct BlockAddedEvent {
+    uint32_t index = 0;
+    Hash256 hash;
+    
+    /// The block, in getblock verbose format
+    nlohmann::json block;
+};
+
+/// A transaction entered the memory pool
+struct TransactionAddedEvent {
+    Hash256 hash;
+    
+    /// The transaction, in getrawtransaction verbose format
+    nlohmann::json transaction;
+};
+
+/// A contract emitted a notification while a block or transaction executed
+struct ExecutionNotificationEvent {
+    /// The transaction, or the block for OnPersist/PostPersist
+    Hash256 container;
+    Hash160 contract;
+    std::string eventName;
+    
+    /// The notification state stack item
+    nlohmann::json state;
+};
+
+/// A transaction or block script finished executing
+struct TransactionExecutedEvent {
+    Hash256 container;
+    std::string vmState;
+    
+    /// The execution, in getapplicationlog format
+    nlohmann::json execution;
+};
+
+/// Server-side filter for block_added
+struct BlockFilter {
+    /// Only blocks produced by this validator index
+    std::optional<int> primary;
+};
+
+/// Server-side filter for transaction_added
+struct TransactionFilter {
+    std::optional<Hash160> sender;
+    
+    /// Only transactions with this account among their signers
+    std::optional<Hash160> signer;
+};
+
+/// Server-side filter for notification_from_execution
+struct NotificationFilter {
+    std::optional<Hash160> contract;
+    
+    /// The event name, e.g. "Transfer"
+    std::optional<std::string> name;
+};
+
+/// Server-side filter for transaction_executed
+struct ExecutionFilter {
+    /// "HALT" or "FAULT"
+    std::optional<std::string> vmState;
+    std::optional<Hash256> container;
+};
+
+/// SubscriptionClient settings
+struct SubscriptionClientConfig {
+    /// Timeout for connecting and for subscription requests
+    std::chrono::milliseconds requestTimeout{10000};
+    
+    /// First wait before reconnecting; doubled after every failed attempt
+    std::chrono::milliseconds reconnectDelay{500};
+    
+    /// Longest wait before reconnecting
+    std::chrono::milliseconds maxReconnectDelay{30000};
+};
+
+/// Client for the node's WebSocket subscription interface (the /ws endpoint).
+///
+/// Subscriptions are filtered on the server, so only matching events are
+/// sent, and dispatched to typed callbacks on the client's receive thread.
+/// When the connection drops, the client reconnects with backoff and
+/// subscribes again. With an RPC client for catch-up, it also resumes from
+/// the last block seen: blocks missed while disconnected, and their
+/// notifications and executions, are fetched over RPC and delivered in order
+/// before live events, so no block is skipped or repeated. Memory pool
+/// events missed while disconnected cannot be recovered.
+class SubscriptionClient {
+public:
+    using BlockCallback = std::function<void(const BlockAddedEvent&)>;
+    using TransactionCallback = std::function<void(const TransactionAddedEvent&)>;
+    using NotificationCallback = std::function<void(const ExecutionNotificationEvent&)>;
+    using ExecutionCallback = std::function<void(const TransactionExecutedEvent&)>;
+    using ErrorCallback = std::function<void(const std::string&)>;
+
+private:
+    class Connection;
+    
+    struct Subscription {
+        SubscriptionEvent event;
+        nlohmann::json filter;
+        std::function<bool(const nlohmann::json&)> matches;
+        std::function<void(const nlohmann::json&)> handler;
+        std::string serverId;
+    };
+    
+    std::string url_;
+    SharedPtr<EpicChainRpcClient> rpcClient_;
+    SubscriptionClientConfig config_;
+    
+    std::mutex mutex_;
+    std::condition_variable wakeUp_;
+    std::map<size_t, Subscription> subscriptions_;
+    size_t nextSubscriptionId_;
+    
+    // Requests queued by other threads for the receive thread to send
+    std::deque<nlohmann::json> outbox_;
+    std::map<int, size_t> pendingSubscribes_;
+    int nextRequestId_;
+    
+    ErrorCallback errorCallback_;
+    
+    std::atomic<bool> running_;
+    std::atomic<bool> connected_;
+    std::atomic<uint32_t> nextBlockIndex_;
+    std::atomic<bool> hasNextBlock_;
+    std::unique_ptr<std::thread> thread_;
+    
+    // Events received after a catch-up, held until their block is known
+    bool holdingEvents_;
+    std::vector<std::pair<SubscriptionEvent, nlohmann::json>> heldEvents_;
+    
+    size_t addSubscription(SubscriptionEvent event, nlohmann::json filter,
+                           std::function<bool(const nlohmann::json&)> matches,
+                           std::function<void(const nlohmann::json&)> handler);
+    
+    void run();
+    void session(Connection& connection);
+    void subscribeAll(Connection& connection);
+    void sendQueued(Connection& connection);
+    void catchUp();
+    void handleMessage(const nlohmann::json& message);
+    void handleEvent(SubscriptionEvent event, const nlohmann::json& payload);
+    void dispatch(SubscriptionEvent event, const nlohmann::json& payload);
+    void reportError(const std::string& message);
+    nlohmann::json makeRequest(const std::string& method, const nlohmann::json& params);
+
+public:
+    /// Constructor
+    /// @param url The subscription endpoint, e.g. "ws://localhost:20332/ws" or "wss://..."
+    /// @param rpcClient Optional RPC client used to catch up on blocks missed while disconnected
+    /// @param config The settings
+    explicit SubscriptionClient(const std::string& url, const SharedPtr<EpicChainRpcClient>& rpcClient = nullptr,
+                                const SubscriptionClientConfig& config = SubscriptionClientConfig());
+    
+    /// Destructor
+    ~SubscriptionClient();
+    
+    SubscriptionClient(const SubscriptionClient&) = delete;
+    SubscriptionClient& operator=(const SubscriptionClient&) = delete;
+    
+    /// Connect and keep the subscriptions alive until stop()
+    void start();
+    
+    /// Connect, first delivering every block from a given index on. Requires an RPC client.
+    /// @param startIndex The first block index to deliver
+    void start(uint32_t startIndex);
+    
+    /// Disconnect and stop reconnecting
+    void stop();
+    
+    /// Check if the client is running
+    bool isRunning() const { return running_; }
+    
+    /// Check if the connection is currently established
+    bool isConnected() const { return connected_; }
+    
+    /// Subscribe to new blocks. Safe to call while running.
+    /// @param callback The callback
+    /// @param filter The server-side filter
+    /// @return Subscription ID for unsubscribe()
+    size_t subscribeBlocks(BlockCallback callback, const BlockFilter& filter = BlockFilter());
+    
+    /// Subscribe to transactions entering the memory pool
+    /// @param callback The callback
+    /// @param filter The server-side filter
+    /// @return Subscription ID for unsubscribe()
+    size_t subscribeTransactions(TransactionCallback callback, const TransactionFilter& filter = TransactionFilter());
+    
+    /// Subscribe to contract notifications
+    /// @param callback The callback
+    /// @param filter The server-side filter
+    /// @return Subscription ID for unsubscribe()
+    size_t subscribeNotifications(NotificationCallback callback, const NotificationFilter& filter = NotificationFilter());
+    
+    /// Subscribe to executions of transactions and blocks
+    /// @param callback The callback
+    /// @param filter The server-side filter
+    /// @return Subscription ID for unsubscribe()
+    size_t subscribeExecutions(ExecutionCallback callback, const ExecutionFilter& filter = ExecutionFilter());
+    
+    /// Remove a subscription
+    /// @param subscriptionId The ID returned by a subscribe method
+    void unsubscribe(size_t subscriptionId);
+    
+    /// Set a callback for connection and subscription errors
+    /// @param callback The callback, called on the receive thread
+    void setErrorCallback(ErrorCallback callback);
+    
+    /// Get the index of the last block delivered
+    /// @return The last block index, or 0 if none was delivered
+    uint32_t getLastBlockIndex() const { return hasNextBlock_ && nextBlockIndex_ > 0 ? nextBlockIndex_ - 1 : 0; }
+};
+
+} // namespace epicchaincpp
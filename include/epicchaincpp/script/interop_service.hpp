@@ -2,9 +2,75 @@
 
 #include <string>
 #include <cstdint>
+#include <cstddef>
 
 namespace epicchaincpp {
 
+/// Well-known interop services, in the order of InteropService::DESCRIPTORS
+enum class InteropId : uint8_t {
+    SYSTEM_BINARY_ATOI,
+    SYSTEM_BINARY_BASE58_DECODE,
+    SYSTEM_BINARY_BASE58_ENCODE,
+    SYSTEM_BINARY_BASE64_DECODE,
+    SYSTEM_BINARY_BASE64_ENCODE,
+    SYSTEM_BINARY_DESERIALIZE,
+    SYSTEM_BINARY_ITOA,
+    SYSTEM_BINARY_SERIALIZE,
+    
+    SYSTEM_CONTRACT_CALL,
+    SYSTEM_CONTRACT_CALL_NATIVE,
+    SYSTEM_CONTRACT_CREATE,
+    SYSTEM_CONTRACT_CREATE_MULTISIG_ACCOUNT,
+    SYSTEM_CONTRACT_CREATE_STANDARD_ACCOUNT,
+    SYSTEM_CONTRACT_DESTROY,
+    SYSTEM_CONTRACT_GET_CALL_FLAGS,
+    SYSTEM_CONTRACT_NATIVE_ON_PERSIST,
+    SYSTEM_CONTRACT_NATIVE_POST_PERSIST,
+    SYSTEM_CONTRACT_UPDATE,
+    
+    SYSTEM_CRYPTO_CHECK_MULTISIG,
+    SYSTEM_CRYPTO_CHECK_SIG,
+    SYSTEM_CRYPTO_SHA256,
+    SYSTEM_CRYPTO_RIPEMD160,
+    
+    SYSTEM_ITERATOR_NEXT,
+    SYSTEM_ITERATOR_VALUE,
+    
+    SYSTEM_RUNTIME_BURN_GAS,
+    SYSTEM_RUNTIME_CHECK_WITNESS,
+    SYSTEM_RUNTIME_GAS_LEFT,
+    SYSTEM_RUNTIME_GET_CALLING_SCRIPT_HASH,
+    SYSTEM_RUNTIME_GET_ENTRY_SCRIPT_HASH,
+    SYSTEM_RUNTIME_GET_EXECUTING_SCRIPT_HASH,
+    SYSTEM_RUNTIME_GET_INVOCATION_COUNTER,
+    SYSTEM_RUNTIME_GET_NETWORK,
+    SYSTEM_RUNTIME_GET_NOTIFICATIONS,
+    SYSTEM_RUNTIME_GET_RANDOM,
+    SYSTEM_RUNTIME_GET_TIME,
+    SYSTEM_RUNTIME_GET_TRIGGER,
+    SYSTEM_RUNTIME_LOG,
+    SYSTEM_RUNTIME_NOTIFY,
+    SYSTEM_RUNTIME_PLATFORM,
+    
+    SYSTEM_STORAGE_AS_READONLY,
+    SYSTEM_STORAGE_DELETE,
+    SYSTEM_STORAGE_FIND,
+    SYSTEM_STORAGE_GET,
+    SYSTEM_STORAGE_GET_CONTEXT,
+    SYSTEM_STORAGE_GET_READONLY_CONTEXT,
+    SYSTEM_STORAGE_PUT,
+    
+    COUNT
+};
+
+/// A well-known interop service with its precomputed SYSCALL hash
+struct InteropDescriptor {
+    InteropId id;
+    const char* name;
+    /// First 4 bytes of SHA-256(name), read little-endian
+    uint32_t hash;
+};
+
 /// Neo VM interop service definitions
 class InteropService {
 public:
@@ -61,10 +127,96 @@ public:
     static const std::string SYSTEM_STORAGE_GET_READONLY_CONTEXT;
     static const std::string SYSTEM_STORAGE_PUT;
     
-    /// Get the hash of an interop service
+    /// Descriptors of the well-known services, indexed by InteropId
+    static constexpr InteropDescriptor DESCRIPTORS[] = {
+        {InteropId::SYSTEM_BINARY_ATOI, "System.Binary.Atoi", 0xeb40381c},
+        {InteropId::SYSTEM_BINARY_BASE58_DECODE, "System.Binary.Base58Decode", 0x3792f76d},
+        {InteropId::SYSTEM_BINARY_BASE58_ENCODE, "System.Binary.Base58Encode", 0x67b0573f},
+        {InteropId::SYSTEM_BINARY_BASE64_DECODE, "System.Binary.Base64Decode", 0xc384a3db},
+        {InteropId::SYSTEM_BINARY_BASE64_ENCODE, "System.Binary.Base64Encode", 0x7653bfac},
+        {InteropId::SYSTEM_BINARY_DESERIALIZE, "System.Binary.Deserialize", 0xdfd07c52},
+        {InteropId::SYSTEM_BINARY_ITOA, "System.Binary.Itoa", 0x7dbae37b},
+        {InteropId::SYSTEM_BINARY_SERIALIZE, "System.Binary.Serialize", 0x24011c3f},
+        
+        {InteropId::SYSTEM_CONTRACT_CALL, "System.Contract.Call", 0x525b7d62},
+        {InteropId::SYSTEM_CONTRACT_CALL_NATIVE, "System.Contract.CallNative", 0x677bf71a},
+        {InteropId::SYSTEM_CONTRACT_CREATE, "System.Contract.Create", 0x852c35ce},
+        {InteropId::SYSTEM_CONTRACT_CREATE_MULTISIG_ACCOUNT, "System.Contract.CreateMultisigAccount", 0x09e9336a},
+        {InteropId::SYSTEM_CONTRACT_CREATE_STANDARD_ACCOUNT, "System.Contract.CreateStandardAccount", 0x028799cf},
+        {InteropId::SYSTEM_CONTRACT_DESTROY, "System.Contract.Destroy", 0xf01d9fc6},
+        {InteropId::SYSTEM_CONTRACT_GET_CALL_FLAGS, "System.Contract.GetCallFlags", 0x813ada95},
+        {InteropId::SYSTEM_CONTRACT_NATIVE_ON_PERSIST, "System.Contract.NativeOnPersist", 0x93bcdb2e},
+        {InteropId::SYSTEM_CONTRACT_NATIVE_POST_PERSIST, "System.Contract.NativePostPersist", 0x165da144},
+        {InteropId::SYSTEM_CONTRACT_UPDATE, "System.Contract.Update", 0x1d33c631},
+        
+        {InteropId::SYSTEM_CRYPTO_CHECK_MULTISIG, "System.Crypto.CheckMultiSig", 0x65c4dadf},
+        {InteropId::SYSTEM_CRYPTO_CHECK_SIG, "System.Crypto.CheckSig", 0x27b3e756},
+        {InteropId::SYSTEM_CRYPTO_SHA256, "System.Crypto.SHA256", 0xbabf5630},
+        {InteropId::SYSTEM_CRYPTO_RIPEMD160, "System.Crypto.RIPEMD160", 0x4b509598},
+        
+        {InteropId::SYSTEM_ITERATOR_NEXT, "System.Iterator.Next", 0x9ced089c},
+        {InteropId::SYSTEM_ITERATOR_VALUE, "System.Iterator.Value", 0x1dbf54f3},
+        
+        {InteropId::SYSTEM_RUNTIME_BURN_GAS, "System.Runtime.BurnGas", 0xbc8c5ac3},
+        {InteropId::SYSTEM_RUNTIME_CHECK_WITNESS, "System.Runtime.CheckWitness", 0x8cec27f8},
+        {InteropId::SYSTEM_RUNTIME_GAS_LEFT, "System.Runtime.GasLeft", 0xced88814},
+        {InteropId::SYSTEM_RUNTIME_GET_CALLING_SCRIPT_HASH, "System.Runtime.GetCallingScriptHash", 0x3c6e5339},
+        {InteropId::SYSTEM_RUNTIME_GET_ENTRY_SCRIPT_HASH, "System.Runtime.GetEntryScriptHash", 0x38e2b4f9},
+        {InteropId::SYSTEM_RUNTIME_GET_EXECUTING_SCRIPT_HASH, "System.Runtime.GetExecutingScriptHash", 0x74a8fedb},
+        {InteropId::SYSTEM_RUNTIME_GET_INVOCATION_COUNTER, "System.Runtime.GetInvocationCounter", 0x43112784},
+        {InteropId::SYSTEM_RUNTIME_GET_NETWORK, "System.Runtime.GetNetwork", 0xe0a0fbc5},
+        {InteropId::SYSTEM_RUNTIME_GET_NOTIFICATIONS, "System.Runtime.GetNotifications", 0xf1354327},
+        {InteropId::SYSTEM_RUNTIME_GET_RANDOM, "System.Runtime.GetRandom", 0x28a9de6b},
+        {InteropId::SYSTEM_RUNTIME_GET_TIME, "System.Runtime.GetTime", 0x0388c3b7},
+        {InteropId::SYSTEM_RUNTIME_GET_TRIGGER, "System.Runtime.GetTrigger", 0xa0387de9},
+        {InteropId::SYSTEM_RUNTIME_LOG, "System.Runtime.Log", 0x9647e7cf},
+        {InteropId::SYSTEM_RUNTIME_NOTIFY, "System.Runtime.Notify", 0x616f0195},
+        {InteropId::SYSTEM_RUNTIME_PLATFORM, "System.Runtime.Platform", 0xf6fc79b2},
+        
+        {InteropId::SYSTEM_STORAGE_AS_READONLY, "System.Storage.AsReadOnly", 0xe9bf4c76},
+        {InteropId::SYSTEM_STORAGE_DELETE, "System.Storage.Delete", 0xedc5582f},
+        {InteropId::SYSTEM_STORAGE_FIND, "System.Storage.Find", 0x9ab830df},
+        {InteropId::SYSTEM_STORAGE_GET, "System.Storage.Get", 0x31e85d92},
+        {InteropId::SYSTEM_STORAGE_GET_CONTEXT, "System.Storage.GetContext", 0xce67f69b},
+        {InteropId::SYSTEM_STORAGE_GET_READONLY_CONTEXT, "System.Storage.GetReadOnlyContext", 0xe26bb4f6},
+        {InteropId::SYSTEM_STORAGE_PUT, "System.Storage.Put", 0x84183fe6},
+    };
+    
+    /// Get the hash of a well-known interop service
+    /// @param id The service
+    /// @return The service hash
+    static constexpr uint32_t getHash(InteropId id) {
+        return DESCRIPTORS[static_cast<size_t>(id)].hash;
+    }
+    
+    /// Get the name of a well-known interop service
+    /// @param id The service
+    /// @return The service name
+    static constexpr const char* getName(InteropId id) {
+        return DESCRIPTORS[static_cast<size_t>(id)].name;
+    }
+    
+    /// Get the hash of an interop service. Well-known names are looked up in
+    /// DESCRIPTORS; other names are hashed once and cached.
     /// @param service The service name
     /// @return The service hash
     static uint32_t getHash(const std::string& service);
+    
+    /// Hash an interop service name without any lookup
+    /// @param service The service name
+    /// @return The first 4 bytes of SHA-256(service), read little-endian
+    static uint32_t computeHash(const std::string& service);
 };
 
+static_assert(sizeof(InteropService::DESCRIPTORS) / sizeof(InteropDescriptor) == static_cast<size_t>(InteropId::COUNT),
+              "Every InteropId needs a descriptor");
+static_assert([]() {
+    for (size_t i = 0; i < static_cast<size_t>(InteropId::COUNT); ++i) {
+        if (static_cast<size_t>(InteropService::DESCRIPTORS[i].id) != i) {
+            return false;
+        }
+    }
+    return true;
+}(), "InteropService::DESCRIPTORS must be in InteropId order");
+
 } // namespace epicchaincpp
\ No newline at end of file
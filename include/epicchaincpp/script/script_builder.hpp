@@ -6,6 +6,7 @@
 #include <map>
 #include "epicchaincpp/types/types.hpp"
 #include "epicchaincpp/script/op_code.hpp"
+#include "epicchaincpp/script/interop_service.hpp"
 
 namespace epicchaincpp {
 
@@ -89,11 +90,29 @@ public:
     /// @return Reference to this builder
     ScriptBuilder& callContract(const Hash160& scriptHash, const std::string& method, const std::vector<ContractParameter>& parameters);
     
+    /// Call a contract method that returns an iterator and drain the iterator
+    /// inside the VM, leaving an array of at most maxItems values on the stack.
+    /// The whole result comes back from a single invokescript, with no RPC
+    /// session to hold open or page through.
+    /// @param scriptHash The contract script hash
+    /// @param method The method name
+    /// @param parameters The parameters
+    /// @param maxItems The maximum number of items to collect
+    /// @return Reference to this builder
+    ScriptBuilder& callContractAndUnwrapIterator(const Hash160& scriptHash, const std::string& method,
+                                                 const std::vector<ContractParameter>& parameters,
+                                                 int maxItems);
+    
     /// Emit a SYSCALL
     /// @param interopService The interop service name
     /// @return Reference to this builder
     ScriptBuilder& emitSysCall(const std::string& interopService);
     
+    /// Emit a SYSCALL to a well-known interop service, using its precomputed hash
+    /// @param interopService The interop service
+    /// @return Reference to this builder
+    ScriptBuilder& emitSysCall(InteropId interopService);
+    
     /// Emit a JMP instruction
     /// @param offset The jump offset
     /// @return Reference to this builder
@@ -135,8 +154,8 @@ private:
     /// Emit push data with appropriate opcode
     void emitPushData(const Bytes& data);
     
-    /// Get the hash of an interop service
-    uint32_t getInteropServiceHash(const std::string& method);
+    /// Emit a SYSCALL with the given interop service hash
+    ScriptBuilder& emitSysCallHash(uint32_t hash);
 };
 
 } // namespace epicchaincpp
\ No newline at end of file
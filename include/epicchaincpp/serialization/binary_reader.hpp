@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include <stdexcept>
 #include "epicchaincpp/types/types.hpp"
@@ -32,6 +33,11 @@ public:
     Bytes readBytes(size_t count);
     void readBytes(uint8_t* buffer, size_t count);
     
+    /// Read bytes without copying
+    /// @param count The number of bytes to read
+    /// @return A view into the reader's buffer, valid as long as that buffer is
+    ByteSpan readSpan(size_t count);
+    
     /// Read integers (little-endian)
     int8_t readInt8();
     uint8_t readUInt8();
@@ -48,12 +54,25 @@ public:
     /// Read variable length bytes
     Bytes readVarBytes();
     
+    /// Read variable length bytes without copying
+    /// @return A view into the reader's buffer, valid as long as that buffer is
+    ByteSpan readVarSpan();
+    
     /// Read variable length string
     std::string readVarString();
     
+    /// Read variable length string without copying
+    /// @return A view into the reader's buffer, valid as long as that buffer is
+    std::string_view readVarStringView();
+    
     /// Read fixed length string
     std::string readFixedString(size_t length);
     
+    /// Read fixed length string without copying, stopping at the first null byte
+    /// @param length The number of bytes consumed from the reader
+    /// @return A view into the reader's buffer, valid as long as that buffer is
+    std::string_view readFixedStringView(size_t length);
+    
     /// Read a deserializable object
     template<typename T>
     T readSerializable() {
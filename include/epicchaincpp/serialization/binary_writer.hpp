@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <array>
 #include <string>
 #include <cstdint>
 #include <cstring>
@@ -9,15 +10,52 @@
 
 namespace epicchaincpp {
 
-/// Binary writer for Neo serialization
+/// Destination for the bytes of a BinaryWriter that are consumed as they are
+/// written rather than stored, such as an incremental hash.
+class BinarySink {
+public:
+    virtual ~BinarySink() = default;
+    
+    /// Consume the next bytes
+    virtual void write(const uint8_t* data, size_t length) = 0;
+};
+
+/// Binary writer for Neo serialization.
+/// Writes into a growable heap buffer (default), an output stream, a
+/// caller-provided fixed-capacity buffer such as a stack array, or a sink.
 class BinaryWriter {
 private:
     std::vector<uint8_t> buffer_;
     std::ostream* stream_;
+    BinarySink* sink_;
+    uint8_t* fixed_;
+    size_t fixedCapacity_;
+    size_t fixedSize_;
+    
+    /// Make room for count more bytes and return where they go (heap and fixed modes)
+    uint8_t* grow(size_t count);
+    
+    /// Write a fixed-width integer in little-endian order
+    template<typename T>
+    void writeLittleEndian(T value);
     
 public:
-    BinaryWriter() : stream_(nullptr) {}
-    explicit BinaryWriter(std::ostream& stream) : stream_(&stream) {}
+    BinaryWriter() : stream_(nullptr), sink_(nullptr), fixed_(nullptr), fixedCapacity_(0), fixedSize_(0) {}
+    explicit BinaryWriter(std::ostream& stream)
+        : stream_(&stream), sink_(nullptr), fixed_(nullptr), fixedCapacity_(0), fixedSize_(0) {}
+    
+    /// Hand every write to a sink; nothing is stored
+    /// @param sink The destination, which must outlive the writer
+    explicit BinaryWriter(BinarySink& sink)
+        : stream_(nullptr), sink_(&sink), fixed_(nullptr), fixedCapacity_(0), fixedSize_(0) {}
+    
+    /// Write into a fixed-capacity buffer owned by the caller; never allocates.
+    /// Writing past the capacity throws SerializationException.
+    /// @param buffer The destination buffer, which must outlive the writer
+    /// @param capacity The size of the destination buffer
+    BinaryWriter(uint8_t* buffer, size_t capacity)
+        : stream_(nullptr), sink_(nullptr), fixed_(buffer), fixedCapacity_(capacity), fixedSize_(0) {}
+    
     ~BinaryWriter() = default;
     
     /// Write a single byte
@@ -67,17 +105,46 @@ public:
         }
     }
     
-    /// Get the written bytes
-    const Bytes& toArray() const { return buffer_; }
+    /// Get the written bytes (heap mode only)
+    /// @throws IllegalStateException in fixed-buffer mode; use view() instead
+    const Bytes& toArray() const;
+    
+    /// Move the written bytes out of the writer, leaving it empty (heap mode only)
+    /// @throws IllegalStateException in fixed-buffer mode; use view() instead
+    Bytes release();
+    
+    /// Get a view of the written bytes (heap and fixed modes)
+    ByteSpan view() const { return fixed_ ? ByteSpan(fixed_, fixedSize_) : ByteSpan(buffer_); }
     
     /// Get the current size of the buffer
-    size_t size() const { return buffer_.size(); }
+    size_t size() const { return fixed_ ? fixedSize_ : buffer_.size(); }
     
     /// Clear the buffer
-    void clear() { buffer_.clear(); }
+    void clear() { buffer_.clear(); fixedSize_ = 0; }
+    
+    /// Reserve capacity (no effect in fixed-buffer mode)
+    void reserve(size_t capacity) { if (!fixed_) buffer_.reserve(capacity); }
+    
+    /// Get the encoded size of a variable length integer
+    /// @param value The value to encode
+    /// @return 1, 3, 5 or 9
+    static size_t getVarSize(uint64_t value) {
+        return value < 0xFD ? 1 : value <= 0xFFFF ? 3 : value <= 0xFFFFFFFF ? 5 : 9;
+    }
+};
+
+/// BinaryWriter backed by an inline buffer of N bytes, for serializing small
+/// objects (signers, witnesses, headers) without touching the heap.
+template<size_t N>
+class FixedBinaryWriter : public BinaryWriter {
+private:
+    std::array<uint8_t, N> storage_;
+    
+public:
+    FixedBinaryWriter() : BinaryWriter(storage_.data(), N) {}
     
-    /// Reserve capacity
-    void reserve(size_t capacity) { buffer_.reserve(capacity); }
+    FixedBinaryWriter(const FixedBinaryWriter&) = delete;
+    FixedBinaryWriter& operator=(const FixedBinaryWriter&) = delete;
 };
 
 } // namespace epicchaincpp
\ No newline at end of file
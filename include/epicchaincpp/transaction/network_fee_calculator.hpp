@@ -0,0 +1,112 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include "epicchaincpp/types/types.hpp"
+
+namespace epicchaincpp {
+
+// Forward declarations
+class Transaction;
+class EpicChainRpcClient;
+
+/// Computes the network fee of a transaction locally, without the
+/// calculatenetworkfee RPC. The fee is the transaction size, including the
+/// witnesses it will carry, times the fee per byte, plus the execution cost
+/// of each signer's verification script times the execution fee factor.
+/// Only standard signature and multi-signature verification scripts, ending
+/// in System.Crypto.CheckSig or CheckMultiSig, can be priced offline.
+class NetworkFeeCalculator {
+public:
+    /// VM prices used by verification scripts, before the execution fee factor
+    static constexpr int64_t PUSHDATA1_PRICE = 1 << 3;
+    static constexpr int64_t PUSHINT_PRICE = 1 << 0;
+    static constexpr int64_t SYSCALL_PRICE = 0;
+    static constexpr int64_t CHECK_SIG_PRICE = 1 << 15;
+    
+    /// Size of one signature push in an invocation script (PUSHDATA1 64 <signature>)
+    static constexpr size_t SIGNATURE_PUSH_SIZE = 66;
+    
+    /// Policy values the fee depends on
+    struct Policy {
+        int64_t feePerByte;
+        int32_t execFeeFactor;
+    };
+    
+    /// Shape of a standard verification script
+    struct VerificationScriptInfo {
+        bool multiSig;
+        /// Required signatures
+        int m;
+        /// Public keys
+        int n;
+    };
+    
+private:
+    SharedPtr<EpicChainRpcClient> client_;
+    std::chrono::steady_clock::duration refreshInterval_;
+    
+    mutable std::mutex mutex_;
+    Policy policy_;
+    std::chrono::steady_clock::time_point fetchedAt_;
+    bool fetched_;
+
+public:
+    /// Constructor with fixed policy values; never contacts a node
+    /// @param feePerByte The fee per transaction byte
+    /// @param execFeeFactor The execution fee factor
+    NetworkFeeCalculator(int64_t feePerByte, int32_t execFeeFactor);
+    
+    /// Constructor reading the policy values from the PolicyContract
+    /// @param client The RPC client
+    /// @param refreshInterval How long fetched policy values are reused
+    explicit NetworkFeeCalculator(const SharedPtr<EpicChainRpcClient>& client,
+                                  std::chrono::steady_clock::duration refreshInterval = std::chrono::minutes(1));
+    
+    /// Get the policy values, fetching them if the cached ones are stale
+    /// @return The policy values
+    Policy getPolicy();
+    
+    /// Set how long fetched policy values are reused
+    /// @param refreshInterval The refresh interval
+    void setRefreshInterval(std::chrono::steady_clock::duration refreshInterval);
+    
+    /// Drop the cached policy values so the next call fetches them again
+    void invalidate();
+    
+    /// Calculate the network fee of a transaction
+    /// @param transaction The transaction; existing witnesses are ignored
+    /// @param verificationScripts The verification script of each signer, in signer order
+    /// @return The network fee
+    int64_t calculate(const Transaction& transaction, const std::vector<Bytes>& verificationScripts);
+    
+    /// Calculate the network fee of a transaction with the given policy values
+    /// @param transaction The transaction; existing witnesses are ignored
+    /// @param verificationScripts The verification script of each signer, in signer order
+    /// @param policy The policy values
+    /// @return The network fee
+    static int64_t calculate(const Transaction& transaction, const std::vector<Bytes>& verificationScripts,
+                             const Policy& policy);
+    
+    /// Recognize a standard signature or multi-signature verification script
+    /// @param script The verification script
+    /// @param info Receives the script shape
+    /// @return True if the script is standard
+    static bool parseVerificationScript(const Bytes& script, VerificationScriptInfo& info);
+    
+    /// Get the execution cost of a signature verification script
+    /// @return The cost, before the execution fee factor
+    static int64_t signatureContractCost();
+    
+    /// Get the execution cost of an m-of-n multi-signature verification script
+    /// @param m Required signatures
+    /// @param n Public keys
+    /// @return The cost, before the execution fee factor
+    static int64_t multiSignatureContractCost(int m, int n);
+    
+private:
+    Policy fetchPolicy() const;
+};
+
+} // namespace epicchaincpp
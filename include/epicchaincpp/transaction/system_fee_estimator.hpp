@@ -0,0 +1,90 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "epicchaincpp/types/types.hpp"
+
+namespace epicchaincpp {
+
+// Forward declarations
+class Signer;
+
+/// Memoizes system fees of invocation scripts, so transactions that share a
+/// script shape (e.g. NEP-17 transfers with different amounts and recipients)
+/// need one invokescript call instead of one each.
+///
+/// Entries are keyed by the script with its call argument operands removed,
+/// plus the signer scopes. They expire after a TTL and are all dropped when a
+/// new block is reported through onNewBlock(), e.g. from BlockPolling.
+class SystemFeeEstimator {
+public:
+    /// Cache counters
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+        size_t entries;
+    };
+    
+private:
+    struct Entry {
+        int64_t systemFee;
+        std::chrono::steady_clock::time_point expiresAt;
+    };
+    
+    std::chrono::steady_clock::duration ttl_;
+    size_t maxEntries_;
+    
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    uint32_t lastBlockIndex_;
+    bool hasBlockIndex_;
+    uint64_t hits_;
+    uint64_t misses_;
+
+public:
+    /// Constructor
+    /// @param ttl How long an estimate is reused
+    /// @param maxEntries Bound on cached script shapes
+    explicit SystemFeeEstimator(std::chrono::steady_clock::duration ttl = std::chrono::seconds(60),
+                                size_t maxEntries = 1024);
+    
+    /// Get the system fee of a script, running estimate() on a miss
+    /// @param script The invocation script
+    /// @param signers The transaction signers
+    /// @param estimate Computes the system fee, typically through invokescript
+    /// @return The system fee
+    int64_t getSystemFee(const Bytes& script, const std::vector<SharedPtr<Signer>>& signers,
+                         const std::function<int64_t()>& estimate);
+    
+    /// Report the current block height. Cached fees are dropped when it advances.
+    /// @param blockIndex The latest block index
+    void onNewBlock(uint32_t blockIndex);
+    
+    /// Drop all cached fees
+    void clear();
+    
+    /// Get the hit/miss counters and the number of cached entries
+    /// @return The statistics
+    Stats getStats() const;
+    
+    /// Get the cache key of a script and its signers
+    /// @param script The invocation script
+    /// @param signers The transaction signers
+    /// @return The key
+    static std::string makeKey(const Bytes& script, const std::vector<SharedPtr<Signer>>& signers);
+    
+    /// Remove the operands of the argument pushes of each contract call. The
+    /// method and contract hash pushes are always kept, as are all opcodes, so
+    /// scripts that differ in call structure, contract, method or push widths
+    /// still differ. A script that cannot be decoded, or that makes syscalls
+    /// other than System.Contract.Call, is returned unchanged.
+    /// @param script The invocation script
+    /// @return The normalized script
+    static Bytes normalizeScript(const Bytes& script);
+};
+
+} // namespace epicchaincpp
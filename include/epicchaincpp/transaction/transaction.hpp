@@ -72,7 +72,7 @@ public:
     /// @param account The account to sign with
     void sign(const SharedPtr<Account>& account);
     
-    /// Get transaction hash
+    /// Get transaction hash, in the node's display order like Header::getHash
     /// @return The transaction hash
     const Hash256& getHash() const;
     
@@ -84,6 +84,12 @@ public:
     /// @return The calculated hash
     Hash256 calculateHash() const;
     
+    /// Calculate the hashes of many transactions at once, using the batch hash
+    /// kernels, and cache them so that getHash() returns without hashing.
+    /// Transactions whose hash is already cached are skipped.
+    /// @param transactions The transactions, e.g. those of a block
+    static void calculateHashes(const std::vector<SharedPtr<Transaction>>& transactions);
+    
     /// Get the data to be signed for witnesses
     /// @return The signing data
     Bytes getHashData() const;
@@ -104,6 +110,9 @@ public:
     /// Serialize unsigned transaction (without witnesses)
     void serializeUnsigned(BinaryWriter& writer) const;
     
+    /// Size of the unsigned transaction, computed without serializing it
+    size_t getUnsignedSize() const;
+    
 private:
     /// Generate a random nonce for the transaction
     static uint32_t generateNonce();
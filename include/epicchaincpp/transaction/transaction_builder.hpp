@@ -15,16 +15,20 @@ namespace epicchaincpp {
 class Transaction;
 class Signer;
 class Witness;
-class NeoRpcClient;
+class EpicChainRpcClient;
 class Account;
 class ContractParameter;
+class NetworkFeeCalculator;
+class SystemFeeEstimator;
 
 /// Builder class for constructing Neo transactions
 class TransactionBuilder {
 private:
     SharedPtr<Transaction> transaction_;
-    SharedPtr<NeoRpcClient> client_;
+    SharedPtr<EpicChainRpcClient> client_;
     std::vector<SharedPtr<Account>> signingAccounts_;
+    SharedPtr<NetworkFeeCalculator> networkFeeCalculator_;
+    SharedPtr<SystemFeeEstimator> systemFeeEstimator_;
     
     // High priority flag
     bool isHighPriority_ = false;
@@ -40,7 +44,7 @@ private:
 public:
     /// Constructor
     /// @param client The RPC client to use for blockchain queries
-    explicit TransactionBuilder(const SharedPtr<NeoRpcClient>& client = nullptr);
+    explicit TransactionBuilder(const SharedPtr<EpicChainRpcClient>& client = nullptr);
     
     // For testing purposes
     template<typename T>
@@ -54,7 +58,20 @@ public:
     /// Set the RPC client
     /// @param client The RPC client
     /// @return Reference to this builder
-    TransactionBuilder& setClient(const SharedPtr<NeoRpcClient>& client);
+    TransactionBuilder& setClient(const SharedPtr<EpicChainRpcClient>& client);
+    
+    /// Calculate network fees locally instead of through the calculatenetworkfee RPC.
+    /// Every signer then needs a signing account. Transactions with a non-standard
+    /// verification script still go through the RPC.
+    /// @param calculator The calculator, or nullptr to use the RPC again
+    /// @return Reference to this builder
+    TransactionBuilder& setNetworkFeeCalculator(const SharedPtr<NetworkFeeCalculator>& calculator);
+    
+    /// Reuse system fees of earlier transactions with the same script shape.
+    /// The estimator can be shared between builders.
+    /// @param estimator The estimator, or nullptr to invoke every script
+    /// @return Reference to this builder
+    TransactionBuilder& setSystemFeeEstimator(const SharedPtr<SystemFeeEstimator>& estimator);
     
     /// Set the nonce (random value)
     /// @param nonce The nonce value
@@ -179,7 +196,7 @@ public:
     
     /// Call invoke script
     /// @return The invoke script response
-    SharedPtr<NeoInvokeResultResponse> callInvokeScript();
+    SharedPtr<EpicChainInvokeResultResponse> callInvokeScript();
     
     /// Handle case when sender cannot cover fees with a consumer
     /// @param consumer The consumer function
@@ -260,10 +277,13 @@ private:
     /// Check if signers contain multi-sig with committee member
     bool signersContainMultiSigWithCommitteeMember(const std::vector<Hash160>& committee);
     
-    /// Get system fee for script
+    /// Get system fee for script, from the estimator if one is set
     int64_t getSystemFeeForScript();
     
-    /// Calculate network fee using RPC
+    /// Get system fee for script using RPC
+    int64_t invokeSystemFeeForScript();
+    
+    /// Calculate network fee, locally if a calculator is set and otherwise using RPC
     int64_t calcNetworkFee();
     
     /// Get sender'sEpicPulsebalance
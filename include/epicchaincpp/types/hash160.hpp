@@ -94,6 +94,16 @@ public:
     /// @return The script hash
     static Hash160 fromPublicKeys(const std::vector<SharedPtr<ECPublicKey>>& pubKeys, int signingThreshold);
     
+    /// Creates the script hashes of many scripts at once, using the batch hash kernels.
+    /// @param scripts The scripts to calculate the script hashes for
+    /// @return One script hash per script
+    static std::vector<Hash160> fromScripts(const std::vector<Bytes>& scripts);
+    
+    /// Creates the single-signature script hash of each of many public keys at once.
+    /// @param encodedPublicKeys The encoded public keys
+    /// @return One script hash per public key
+    static std::vector<Hash160> fromEachPublicKey(const std::vector<Bytes>& encodedPublicKeys);
+    
     // NeoSerializable interface
     size_t getSize() const override;
     void serialize(BinaryWriter& writer) const override;
@@ -11,6 +11,29 @@ namespace epicchaincpp {
 using Byte = uint8_t;
 using Bytes = std::vector<uint8_t>;
 
+/// Non-owning view over a contiguous run of bytes.
+/// The view is only valid while the underlying buffer is alive and unchanged.
+class ByteSpan {
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    
+public:
+    constexpr ByteSpan() = default;
+    constexpr ByteSpan(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+    ByteSpan(const Bytes& bytes) : data_(bytes.data()), size_(bytes.size()) {}
+    
+    constexpr const uint8_t* data() const { return data_; }
+    constexpr size_t size() const { return size_; }
+    constexpr bool empty() const { return size_ == 0; }
+    constexpr const uint8_t* begin() const { return data_; }
+    constexpr const uint8_t* end() const { return data_ + size_; }
+    constexpr uint8_t operator[](size_t index) const { return data_[index]; }
+    
+    /// Copy the viewed bytes into an owning vector
+    Bytes toBytes() const { return Bytes(begin(), end()); }
+};
+
 // Smart pointer aliases for common usage
 template<typename T>
 using SharedPtr = std::shared_ptr<T>;
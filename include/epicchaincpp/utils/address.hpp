@@ -13,11 +13,22 @@ public:
     /// @return The EpicChain address
     static std::string scriptHashToAddress(const Bytes& scriptHash);
     
+    /// Convert a script hash to an address
+    /// @param scriptHash The 20 byte script hash in big-endian order
+    /// @return The EpicChain address
+    static std::string scriptHashToAddress(const uint8_t* scriptHash);
+    
     /// Convert an address to a script hash
     /// @param address The EpicChain address
     /// @return The script hash in big-endian order
     static Bytes addressToScriptHash(const std::string& address);
     
+    /// Validate an address and convert it to a script hash in one pass
+    /// @param address The EpicChain address
+    /// @param scriptHash Receives the 20 byte script hash in big-endian order
+    /// @return False if the address is invalid
+    static bool tryAddressToScriptHash(const std::string& address, uint8_t* scriptHash);
+    
     /// Validate a EpicChain address
     /// @param address The address to validate
     /// @return True if valid, false otherwise
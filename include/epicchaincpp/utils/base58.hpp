@@ -29,15 +29,41 @@ public:
     /// @return The decoded bytes
     static Bytes decodeCheck(const std::string& encoded);
     
+    /// Encode bytes to Base58 string
+    /// @param data The data to encode
+    /// @param length The number of bytes
+    /// @return The Base58 encoded string
+    static std::string encode(const uint8_t* data, size_t length);
+    
+    /// Encode bytes to Base58Check string (includes checksum)
+    /// @param data The data to encode
+    /// @param length The number of bytes
+    /// @return The Base58Check encoded string
+    static std::string encodeCheck(const uint8_t* data, size_t length);
+    
+    /// Decode a Base58 string that must hold exactly length bytes
+    /// @param encoded The Base58 encoded string
+    /// @param out Receives the decoded bytes
+    /// @param length The expected number of bytes
+    /// @return False if the string is invalid or decodes to another length
+    static bool tryDecode(const std::string& encoded, uint8_t* out, size_t length);
+    
+    /// Decode and verify a Base58Check string that must hold exactly length bytes
+    /// @param encoded The Base58Check encoded string
+    /// @param out Receives the decoded bytes without the checksum
+    /// @param length The expected number of bytes without the checksum
+    /// @return False if the string is invalid, decodes to another length or fails the checksum
+    static bool tryDecodeCheck(const std::string& encoded, uint8_t* out, size_t length);
+    
 private:
     static const char* ALPHABET;
     static const int BASE;
     
     /// Calculate checksum for Base58Check
-    static Bytes calculateChecksum(const Bytes& data);
+    static void calculateChecksum(const uint8_t* data, size_t length, uint8_t* checksum);
     
     /// Verify checksum for Base58Check
-    static bool verifyChecksum(const Bytes& dataWithChecksum);
+    static bool verifyChecksum(const uint8_t* dataWithChecksum, size_t length);
 };
 
 } // namespace epicchaincpp
\ No newline at end of file
@@ -19,6 +19,20 @@ public:
     /// @return The decoded bytes
     static Bytes decode(const std::string& hex);
     
+    /// Encode bytes to hexadecimal into a caller buffer
+    /// @param data The data to encode
+    /// @param length The number of bytes
+    /// @param out Receives 2 * length characters, not null terminated
+    /// @param uppercase Whether to use uppercase letters
+    static void encode(const uint8_t* data, size_t length, char* out, bool uppercase = false);
+    
+    /// Decode hexadecimal characters into a caller buffer
+    /// @param hex The hex characters (without 0x prefix)
+    /// @param length The number of characters
+    /// @param out Receives length / 2 bytes
+    /// @return False if the length is odd or a character is not hex
+    static bool tryDecode(const char* hex, size_t length, uint8_t* out);
+    
     /// Check if a string is valid hexadecimal
     /// @param str The string to check
     /// @return True if valid hex, false otherwise
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include "epicchaincpp/types/types.hpp"
+
+namespace epicchaincpp {
+
+/// Fixed-size pool of worker threads for CPU-bound batch work
+class ThreadPool {
+private:
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stopping_;
+    
+    void enqueue(std::function<void()> task);
+    void workerLoop();
+    
+public:
+    /// Constructor
+    /// @param threads Number of worker threads; 0 uses the hardware concurrency
+    explicit ThreadPool(size_t threads = 0);
+    
+    /// Destructor. Runs the tasks already queued, then joins the workers.
+    ~ThreadPool();
+    
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    
+    /// Get the number of worker threads
+    size_t size() const { return workers_.size(); }
+    
+    /// Run a task on the pool
+    /// @param task The callable to run
+    /// @return A future for the task's result
+    template<typename F>
+    std::future<std::invoke_result_t<std::decay_t<F>>> submit(F&& task) {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        std::future<Result> future = packaged->get_future();
+        enqueue([packaged]() { (*packaged)(); });
+        return future;
+    }
+    
+    /// Call fn(i) for every i in [0, count) and wait for all calls to finish.
+    /// The calling thread takes part, so this is safe to call from a pool task.
+    /// Once a call throws no further indices are started, and the first
+    /// exception is rethrown.
+    /// @param count The number of indices
+    /// @param fn The function to call
+    void parallelFor(size_t count, const std::function<void(size_t)>& fn);
+    
+    /// Get a process-wide pool sized to the hardware
+    static ThreadPool& shared();
+    
+    /// Get the number of hardware threads (at least 1)
+    static size_t hardwareConcurrency();
+};
+
+} // namespace epicchaincpp
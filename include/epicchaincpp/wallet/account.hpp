@@ -42,6 +42,14 @@ public:
     /// @param label Optional label for the account
     Account(const std::string& xep2, const std::string& password, const std::string& label = "");
     
+    /// Create a locked account from a XEP-2 encrypted key whose script hash is
+    /// already known, without decrypting it. The key is checked against the
+    /// script hash when the account is unlocked.
+    /// @param xep2 The XEP-2 encrypted private key
+    /// @param scriptHash The script hash of the account
+    /// @param label Optional label for the account
+    Account(const std::string& xep2, const Hash160& scriptHash, const std::string& label = "");
+    
     /// Create multi-signature account
     /// @param publicKeys The public keys
     /// @param signingThreshold The minimum number of signatures required
@@ -74,6 +82,11 @@ public:
     /// @return True if successfully unlocked
     bool unlock(const std::string& password);
     
+    /// Unlock the account with a key pair already decrypted from its encrypted key
+    /// @param keyPair The decrypted key pair
+    /// @return True if successfully unlocked; false if the key pair does not belong to the account
+    bool unlock(const SharedPtr<ECKeyPair>& keyPair);
+    
     /// Check if account is locked
     /// @return True if locked
     bool isLocked() const { return isLocked_; }
@@ -123,6 +136,13 @@ public:
     /// @param label Optional label for the account
     /// @return The imported account
     static SharedPtr<Account> fromXEP2(const std::string& xep2, const std::string& password, const std::string& label = "");
+    
+    /// Import a locked account from XEP-2 without decrypting it
+    /// @param xep2 The XEP-2 encrypted private key
+    /// @param scriptHash The script hash of the account
+    /// @param label Optional label for the account
+    /// @return The locked account
+    static SharedPtr<Account> fromXEP2(const std::string& xep2, const Hash160& scriptHash, const std::string& label = "");
 };
 
 } // namespace epicchaincpp
\ No newline at end of file
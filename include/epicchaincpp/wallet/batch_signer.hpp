@@ -0,0 +1,58 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include "epicchaincpp/types/types.hpp"
+
+namespace epicchaincpp {
+
+// Forward declarations
+class Transaction;
+class Wallet;
+class ThreadPool;
+
+/// Outcome of signing one transaction in a batch
+struct BatchSignResult {
+    /// The transaction, signed in place when signing succeeded
+    SharedPtr<Transaction> transaction;
+    
+    /// Why signing failed; empty on success
+    std::string error;
+    
+    /// Check whether the transaction was signed
+    bool succeeded() const { return error.empty(); }
+};
+
+/// Signs many transactions with the accounts of a wallet, in parallel.
+/// Every signer of a transaction must have an unlocked single-signature
+/// account in the wallet; witnesses are added in signer order. A transaction
+/// that cannot be fully signed is left untouched and reported with an error,
+/// without affecting the rest of the batch.
+class BatchSigner {
+private:
+    SharedPtr<Wallet> wallet_;
+    SharedPtr<ThreadPool> pool_;
+
+public:
+    /// Constructor using the process-wide thread pool
+    /// @param wallet The wallet holding the signing accounts
+    explicit BatchSigner(const SharedPtr<Wallet>& wallet);
+    
+    /// Constructor with a dedicated thread pool
+    /// @param wallet The wallet holding the signing accounts
+    /// @param pool The pool to sign on
+    BatchSigner(const SharedPtr<Wallet>& wallet, const SharedPtr<ThreadPool>& pool);
+    
+    /// Sign transactions in place
+    /// @param transactions The unsigned transactions
+    /// @return One result per transaction, in input order
+    std::vector<BatchSignResult> sign(const std::vector<SharedPtr<Transaction>>& transactions) const;
+    
+    /// Sign copies of transactions
+    /// @param transactions The unsigned transactions
+    /// @return One result per transaction, in input order, holding the signed copy
+    std::vector<BatchSignResult> sign(const std::vector<Transaction>& transactions) const;
+};
+
+} // namespace epicchaincpp
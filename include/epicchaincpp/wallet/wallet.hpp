@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include "epicchaincpp/types/types.hpp"
 #include "epicchaincpp/types/hash160.hpp"
+#include "epicchaincpp/crypto/xep2.hpp"
 
 namespace epicchaincpp {
 
@@ -13,6 +14,21 @@ namespace epicchaincpp {
 class Account;
 class Transaction;
 
+/// Settings for loading a wallet with XEP-2 encrypted accounts
+struct WalletLoadOptions {
+    /// Skip decryption while loading and take each account's address from the
+    /// file. The keys are decrypted, and checked against those addresses, when
+    /// the accounts are first unlocked.
+    bool decryptOnFirstUse = false;
+    
+    /// Keep the keys decrypted while loading, returning the accounts unlocked.
+    /// Has no effect with decryptOnFirstUse.
+    bool keepDecryptedKeys = false;
+    
+    /// Thread, memory and progress settings for decrypting the keys
+    XEP2BulkOptions xep2;
+};
+
 /// Represents a Neo wallet
 class Wallet {
 protected:
@@ -117,12 +133,33 @@ public:
     /// @param password Optional password for encryption
     virtual void save(const std::string& filepath, const std::string& password = "") const;
     
+    /// Save wallet to file, encrypting the unlocked accounts in parallel
+    /// @param filepath The file path to save to
+    /// @param password Password for encryption
+    /// @param options Thread, memory and progress settings for the encryption
+    void save(const std::string& filepath, const std::string& password, const XEP2BulkOptions& options) const;
+    
     /// Load wallet from file
     /// @param filepath The file path to load from
     /// @param password Optional password for decryption
     /// @return The loaded wallet
     static SharedPtr<Wallet> load(const std::string& filepath, const std::string& password = "");
     
+    /// Load wallet from file, decrypting the XEP-2 accounts in parallel or, if
+    /// options ask for it, not until they are unlocked
+    /// @param filepath The file path to load from
+    /// @param password Password for decryption
+    /// @param options Decryption settings
+    /// @return The loaded wallet
+    static SharedPtr<Wallet> load(const std::string& filepath, const std::string& password, const WalletLoadOptions& options);
+    
+    /// Unlock every locked account that has an encrypted key, decrypting the
+    /// keys in parallel. Accounts the password does not open stay locked.
+    /// @param password The password to use for decryption
+    /// @param options Thread, memory and progress settings
+    /// @return The number of accounts unlocked
+    size_t unlockAll(const std::string& password, const XEP2BulkOptions& options = XEP2BulkOptions());
+    
 protected:
     /// Update internal indices after adding/removing accounts
     void updateIndices();
@@ -1,7 +1,7 @@
 #include "epicchaincpp/contract/contract_management.hpp"
 #include "epicchaincpp/contract/nef_file.hpp"
 #include "epicchaincpp/contract/contract_manifest.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
 #include "epicchaincpp/types/contract_parameter.hpp"
 #include "epicchaincpp/transaction/transaction_builder.hpp"
 #include "epicchaincpp/exceptions.hpp"
@@ -11,11 +11,11 @@ namespace epicchaincpp {
 const Hash160 ContractManagement::SCRIPT_HASH = Hash160("0xfffdc93764dbaddd97c48f252a53ea4643faa3fd");
 const std::string ContractManagement::NAME = "ContractManagement";
 
-ContractManagement::ContractManagement(const SharedPtr<NeoRpcClient>& client)
+ContractManagement::ContractManagement(const SharedPtr<EpicChainRpcClient>& client)
     : SmartContract(SCRIPT_HASH, client) {
 }
 
-SharedPtr<ContractManagement> ContractManagement::create(const SharedPtr<NeoRpcClient>& client) {
+SharedPtr<ContractManagement> ContractManagement::create(const SharedPtr<EpicChainRpcClient>& client) {
     return std::make_shared<ContractManagement>(client);
 }
 
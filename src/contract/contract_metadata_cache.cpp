@@ -0,0 +1,293 @@
+#include "epicchaincpp/contract/contract_metadata_cache.hpp"
+#include "epicchaincpp/contract/contract_management.hpp"
+#include "epicchaincpp/utils/base64.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+namespace epicchaincpp {
+
+namespace {
+
+/// Check whether a shared future holds a value rather than an error or nothing yet
+template<typename T>
+bool hasValue(const std::shared_future<T>& future) {
+    if (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return false;
+    }
+    try {
+        return future.get() != nullptr;
+    } catch (...) {
+        return false;
+    }
+}
+
+/// Wrap a value in an already completed future
+template<typename T>
+std::shared_future<SharedPtr<const T>> readyFuture(T value) {
+    std::promise<SharedPtr<const T>> promise;
+    promise.set_value(std::make_shared<const T>(std::move(value)));
+    return promise.get_future().share();
+}
+
+int64_t unixSeconds() {
+    return std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+ContractMetadataCache::ContractMetadataCache()
+    : hits_(0), misses_(0), maxPersistedAge_(0), changes_(0), flushedChanges_(0) {
+}
+
+ContractMetadataCache::~ContractMetadataCache() {
+    try {
+        flush();
+    } catch (...) {
+        // Ignore errors during destruction
+    }
+}
+
+template<typename T>
+SharedPtr<const T> ContractMetadataCache::getOrFetch(
+    std::map<Key, std::shared_future<SharedPtr<const T>>>& entries,
+    const Key& key, const std::function<T()>& fetch) {
+    std::promise<SharedPtr<const T>> promise;
+    std::shared_future<SharedPtr<const T>> future;
+    bool owner = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries.find(key);
+        if (it != entries.end()) {
+            future = it->second;
+            ++hits_;
+        } else {
+            future = promise.get_future().share();
+            entries.emplace(key, future);
+            owner = true;
+            ++misses_;
+        }
+    }
+    
+    if (owner) {
+        // Fetch outside the lock; other callers for this contract wait on the future
+        try {
+            promise.set_value(std::make_shared<const T>(fetch()));
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++changes_;
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = entries.find(key);
+            // Only drop a failed entry; it may have been invalidated and refetched meanwhile
+            if (it != entries.end() &&
+                it->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready &&
+                !hasValue(it->second)) {
+                entries.erase(it);
+            }
+        }
+    }
+    return future.get();
+}
+
+SharedPtr<const ContractMetadata> ContractMetadataCache::getContractMetadata(uint32_t network, const Hash160& scriptHash,
+                                                                             const MetadataFetcher& fetch) {
+    return getOrFetch(contracts_, Key(network, scriptHash), fetch);
+}
+
+SharedPtr<const TokenMetadata> ContractMetadataCache::getTokenMetadata(uint32_t network, const Hash160& scriptHash,
+                                                                       const TokenFetcher& fetch) {
+    return getOrFetch(tokens_, Key(network, scriptHash), fetch);
+}
+
+void ContractMetadataCache::invalidate(uint32_t network, const Hash160& scriptHash) {
+    Key key(network, scriptHash);
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t erased = contracts_.erase(key) + tokens_.erase(key);
+    if (erased > 0) {
+        ++changes_;
+    }
+}
+
+bool ContractMetadataCache::onNotification(uint32_t network, const nlohmann::json& notification) {
+    if (!notification.is_object() || !notification.contains("contract") || !notification.contains("eventname")) {
+        return false;
+    }
+    std::string event = notification["eventname"].get<std::string>();
+    if (event != "Update" && event != "Destroy") {
+        return false;
+    }
+    if (Hash160(notification["contract"].get<std::string>()) != ContractManagement::SCRIPT_HASH) {
+        return false;
+    }
+    
+    // The event state is [Hash160], as a stack item or a bare array
+    const nlohmann::json* state = notification.contains("state") ? &notification["state"] : nullptr;
+    if (state && state->is_object() && state->contains("value")) {
+        state = &(*state)["value"];
+    }
+    if (!state || !state->is_array() || state->empty() || !(*state)[0].contains("value")) {
+        return false;
+    }
+    
+    Bytes hash = Base64::decode((*state)[0]["value"].get<std::string>());
+    if (hash.size() != 20) {
+        return false;
+    }
+    // Stack items hold UInt160 values in little-endian order
+    std::reverse(hash.begin(), hash.end());
+    invalidate(network, Hash160(hash));
+    return true;
+}
+
+void ContractMetadataCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    contracts_.clear();
+    tokens_.clear();
+    ++changes_;
+}
+
+ContractMetadataCache::Stats ContractMetadataCache::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return {hits_, misses_, contracts_.size(), tokens_.size()};
+}
+
+void ContractMetadataCache::setPersistencePath(const std::string& path, std::chrono::seconds maxAge) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        persistencePath_ = path;
+        maxPersistedAge_ = maxAge;
+    }
+    load();
+}
+
+void ContractMetadataCache::load() {
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        path = persistencePath_;
+    }
+    
+    std::ifstream file(path);
+    if (!file) {
+        return;
+    }
+    
+    nlohmann::json json;
+    try {
+        file >> json;
+    } catch (const nlohmann::json::exception&) {
+        // A corrupt cache file is rebuilt from the node
+        return;
+    }
+    
+    int64_t savedAt = json.value("savedAt", static_cast<int64_t>(0));
+    if (unixSeconds() - savedAt > maxPersistedAge_.count()) {
+        return;
+    }
+    loadJson(json);
+}
+
+void ContractMetadataCache::flush() {
+    std::string path;
+    uint64_t changes;
+    nlohmann::json json;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (persistencePath_.empty() || changes_ == flushedChanges_) {
+            return;
+        }
+        path = persistencePath_;
+        changes = changes_;
+    }
+    json = toJson();
+    json["savedAt"] = unixSeconds();
+    
+    // Write a temporary file and rename it, so readers never see a partial cache
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::trunc);
+        if (!file) {
+            throw RuntimeException("Cannot write contract metadata cache: " + temporary);
+        }
+        file << json.dump();
+        if (!file) {
+            throw RuntimeException("Cannot write contract metadata cache: " + temporary);
+        }
+    }
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        throw RuntimeException("Cannot replace contract metadata cache: " + path);
+    }
+    
+    // Only a written file counts; a failed write leaves the changes pending, and
+    // changes made while writing are picked up by the next flush
+    std::lock_guard<std::mutex> lock(mutex_);
+    flushedChanges_ = std::max(flushedChanges_, changes);
+}
+
+nlohmann::json ContractMetadataCache::toJson() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // {"networks": {"<magic>": {"contracts": {...}, "tokens": {...}}}}
+    nlohmann::json networks = nlohmann::json::object();
+    for (const auto& [key, future] : contracts_) {
+        if (hasValue(future)) {
+            const auto& metadata = *future.get();
+            networks[std::to_string(key.first)]["contracts"][key.second.toString()] = {
+                {"id", metadata.id},
+                {"updatecounter", metadata.updateCounter},
+                {"nef", metadata.nef},
+                {"manifest", metadata.manifest}
+            };
+        }
+    }
+    
+    for (const auto& [key, future] : tokens_) {
+        if (hasValue(future)) {
+            const auto& metadata = *future.get();
+            networks[std::to_string(key.first)]["tokens"][key.second.toString()] = {
+                {"symbol", metadata.symbol},
+                {"decimals", metadata.decimals}
+            };
+        }
+    }
+    
+    return {{"networks", networks}};
+}
+
+void ContractMetadataCache::loadJson(const nlohmann::json& json) {
+    if (!json.contains("networks") || !json["networks"].is_object()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& [magic, entries] : json["networks"].items()) {
+        uint32_t network = static_cast<uint32_t>(std::stoul(magic));
+        if (entries.contains("contracts") && entries["contracts"].is_object()) {
+            for (const auto& [key, value] : entries["contracts"].items()) {
+                ContractMetadata metadata;
+                metadata.id = value.value("id", 0);
+                metadata.updateCounter = value.value("updatecounter", 0u);
+                metadata.nef = value.value("nef", "");
+                metadata.manifest = value.value("manifest", nlohmann::json::object());
+                contracts_.emplace(Key(network, Hash160(key)), readyFuture(std::move(metadata)));
+            }
+        }
+        if (entries.contains("tokens") && entries["tokens"].is_object()) {
+            for (const auto& [key, value] : entries["tokens"].items()) {
+                TokenMetadata metadata;
+                metadata.symbol = value.value("symbol", "");
+                metadata.decimals = value.value("decimals", 0);
+                tokens_.emplace(Key(network, Hash160(key)), readyFuture(std::move(metadata)));
+            }
+        }
+    }
+}
+
+SharedPtr<ContractMetadataCache> ContractMetadataCache::shared() {
+    static SharedPtr<ContractMetadataCache> cache = std::make_shared<ContractMetadataCache>();
+    return cache;
+}
+
+} // namespace epicchaincpp
@@ -1,5 +1,5 @@
 #include "epicchaincpp/contract/neo_name_service.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
 #include "epicchaincpp/types/contract_parameter.hpp"
 #include "epicchaincpp/utils/address.hpp"
 #include "epicchaincpp/transaction/transaction_builder.hpp"
@@ -10,7 +10,7 @@ namespace epicchaincpp {
 
 const Hash160 NeoNameService::SCRIPT_HASH = Hash160("0x50ac1c37690cc2cfc594472833cf57505d5f46de");
 
-NeoNameService::NeoNameService(const SharedPtr<NeoRpcClient>& client)
+NeoNameService::NeoNameService(const SharedPtr<EpicChainRpcClient>& client)
     : SmartContract(SCRIPT_HASH, client) {
 }
 
@@ -1,5 +1,5 @@
 #include "epicchaincpp/contract/epicchain_token.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
 #include "epicchaincpp/types/contract_parameter.hpp"
 #include "epicchaincpp/transaction/transaction_builder.hpp"
 #include "epicchaincpp/wallet/account.hpp"
@@ -11,7 +11,7 @@ namespace epicchaincpp {
 
 const Hash160 EpicChainToken::SCRIPT_HASH = Hash160("0xef4073a0f2b305a38ec4050e4d3d28bc40ea63f5");
 
-EpicChainToken::EpicChainToken(const SharedPtr<NeoRpcClient>& client)
+EpicChainToken::EpicChainToken(const SharedPtr<EpicChainRpcClient>& client)
     : FungibleToken(SCRIPT_HASH, client) {
 }
 
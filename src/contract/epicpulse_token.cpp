@@ -1,5 +1,5 @@
 #include "epicchaincpp/contract/gas_token.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
 #include "epicchaincpp/types/contract_parameter.hpp"
 #include "epicchaincpp/wallet/account.hpp"
 #include "epicchaincpp/utils/address.hpp"
@@ -9,7 +9,7 @@ namespace epicchaincpp {
 
 const Hash160 EpicPulseToken::SCRIPT_HASH = Hash160("0xd2a4cff31913016155e38e474a2c06d08be276cf");
 
-EpicPulseToken::EpicPulseToken(const SharedPtr<NeoRpcClient>& client)
+EpicPulseToken::EpicPulseToken(const SharedPtr<EpicChainRpcClient>& client)
     : FungibleToken(SCRIPT_HASH, client) {
 }
 
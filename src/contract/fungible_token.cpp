@@ -1,5 +1,7 @@
 #include "epicchaincpp/contract/fungible_token.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/contract/multi_call.hpp"
+#include "epicchaincpp/contract/contract_metadata_cache.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
 #include "epicchaincpp/types/contract_parameter.hpp"
 #include "epicchaincpp/wallet/account.hpp"
 #include "epicchaincpp/transaction/transaction_builder.hpp"
@@ -9,7 +11,7 @@
 
 namespace epicchaincpp {
 
-FungibleToken::FungibleToken(const Hash160& scriptHash, const SharedPtr<NeoRpcClient>& client)
+FungibleToken::FungibleToken(const Hash160& scriptHash, const SharedPtr<EpicChainRpcClient>& client)
     : SmartContract(scriptHash, client), decimals_(0), metadataLoaded_(false) {
 }
 
@@ -43,6 +45,23 @@ int64_t FungibleToken::getBalanceOf(const std::string& address) {
     return result["stack"][0]["value"].get<int64_t>();
 }
 
+std::vector<int64_t> FungibleToken::getBalancesOf(const std::vector<std::string>& addresses, size_t batchSize) {
+    std::vector<std::vector<ContractParameter>> calls;
+    calls.reserve(addresses.size());
+    for (const auto& address : addresses) {
+        calls.push_back({ContractParameter::hash160(Hash160(AddressUtils::addressToScriptHash(address)))});
+    }
+    
+    std::vector<int64_t> balances;
+    balances.reserve(addresses.size());
+    for (const auto& item : invokeMany("balanceOf", calls, batchSize)) {
+        // Integers are serialized as decimal strings by the node
+        const auto& value = item["value"];
+        balances.push_back(value.is_string() ? std::stoll(value.get<std::string>()) : value.get<int64_t>());
+    }
+    return balances;
+}
+
 SharedPtr<TransactionBuilder> FungibleToken::transfer(const SharedPtr<Account>& from, 
                                                       const std::string& to, 
                                                       int64_t amount,
@@ -97,16 +116,25 @@ double FungibleToken::fromSmallestUnit(int64_t amount) {
 
 void FungibleToken::loadMetadata() {
     try {
-        auto symbolResult = invokeFunction("symbol");
-        symbol_ = symbolResult["stack"][0]["value"].get<std::string>();
-        
-        auto decimalsResult = invokeFunction("decimals");
-        decimals_ = decimalsResult["stack"][0]["value"].get<int>();
+        auto metadata = getTokenMetadata([this]() {
+            // One round-trip for both values
+            MultiCall multiCall(client_);
+            size_t symbolIndex = multiCall.add(scriptHash_, "symbol");
+            size_t decimalsIndex = multiCall.add(scriptHash_, "decimals");
+            auto results = multiCall.execute();
+            
+            TokenMetadata token;
+            token.symbol = results.getString(symbolIndex);
+            token.decimals = static_cast<int>(results.getInteger(decimalsIndex));
+            return token;
+        });
         
+        symbol_ = metadata->symbol;
+        decimals_ = metadata->decimals;
         metadataLoaded_ = true;
     } catch (const std::exception& e) {
         throw IllegalStateException("Failed to load token metadata: " + std::string(e.what()));
     }
 }
 
-} // namespace epicchaincpp
\ No newline at end of file
+} // namespace epicchaincpp
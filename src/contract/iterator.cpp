@@ -1,12 +1,147 @@
 #include "epicchaincpp/contract/iterator.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
+#include "epicchaincpp/types/hash160.hpp"
+#include "epicchaincpp/utils/base64.hpp"
 #include "epicchaincpp/exceptions.hpp"
 
 namespace epicchaincpp {
 
+namespace {
+
+/// Extract the stack items from a traverseiterator result
+std::vector<nlohmann::json> parseTraverseResult(const nlohmann::json& result) {
+    const nlohmann::json* items = nullptr;
+    if (result.is_array()) {
+        items = &result;
+    } else if (result.is_object() && result.contains("stack") && result["stack"].is_array()) {
+        items = &result["stack"];
+    }
+    
+    std::vector<nlohmann::json> values;
+    if (items) {
+        values.reserve(items->size());
+        for (const auto& item : *items) {
+            values.push_back(item);
+        }
+    }
+    return values;
+}
+
+} // namespace
+
+// ItemStream
+
+ItemStream::ItemStream(PageFetcher fetcher, std::function<void()> onClose, bool prefetch)
+    : fetcher_(std::move(fetcher)), onClose_(std::move(onClose)), prefetch_(prefetch),
+      position_(0), hasMore_(true), closed_(false) {
+    if (!fetcher_) {
+        throw IllegalArgumentException("Page fetcher cannot be null");
+    }
+}
+
+ItemStream::ItemStream(std::vector<nlohmann::json> items)
+    : prefetch_(false), page_(std::move(items)), position_(0), hasMore_(false), closed_(false) {
+}
+
+ItemStream::~ItemStream() {
+    close();
+}
+
+bool ItemStream::next(nlohmann::json& item) {
+    if (closed_) {
+        return false;
+    }
+    while (position_ >= page_.size()) {
+        if (!loadNextPage()) {
+            close();
+            return false;
+        }
+    }
+    item = std::move(page_[position_++]);
+    return true;
+}
+
+std::vector<nlohmann::json> ItemStream::take(size_t count) {
+    std::vector<nlohmann::json> items;
+    nlohmann::json item;
+    while ((count == 0 || items.size() < count) && next(item)) {
+        items.push_back(std::move(item));
+    }
+    return items;
+}
+
+void ItemStream::close() {
+    if (closed_) {
+        return;
+    }
+    closed_ = true;
+    hasMore_ = false;
+    page_.clear();
+    position_ = 0;
+    
+    // The prefetch still uses the session, so let it finish first
+    if (pending_.valid()) {
+        try {
+            pending_.get();
+        } catch (...) {
+            // The page is discarded anyway
+        }
+    }
+    
+    if (onClose_) {
+        try {
+            onClose_();
+        } catch (...) {
+            // Best effort
+        }
+        onClose_ = nullptr;
+    }
+}
+
+bool ItemStream::loadNextPage() {
+    if (!hasMore_) {
+        return false;
+    }
+    
+    // A failed fetch propagates to the caller; the next call retries it
+    IteratorPage page = pending_.valid() ? pending_.get() : fetcher_();
+    page_ = std::move(page.items);
+    position_ = 0;
+    hasMore_ = page.hasMore;
+    
+    if (hasMore_ && prefetch_) {
+        pending_ = std::async(std::launch::async, [this]() { return fetcher_(); });
+    }
+    return true;
+}
+
+ItemStream::iterator::iterator(ItemStream* stream)
+    : stream_(stream) {
+    advance();
+}
+
+void ItemStream::iterator::advance() {
+    if (stream_ && !stream_->next(current_)) {
+        stream_ = nullptr;
+    }
+}
+
+ItemStream::iterator& ItemStream::iterator::operator++() {
+    advance();
+    return *this;
+}
+
+ItemStream::iterator ItemStream::iterator::operator++(int) {
+    iterator previous(*this);
+    advance();
+    return previous;
+}
+
+// Iterator
+
 Iterator::Iterator(const std::string& sessionId,
                    const std::string& iteratorId,
-                   const SharedPtr<NeoRpcClient>& client,
+                   const SharedPtr<EpicChainRpcClient>& client,
                    size_t count)
     : sessionId_(sessionId), iteratorId_(iteratorId), client_(client), count_(count), traversed_(false) {
     if (!client) {
@@ -35,14 +170,7 @@ std::vector<nlohmann::json> Iterator::traverse(size_t count) {
     auto result = client_->traverseIterator(sessionId_, iteratorId_, count);
     traversed_ = true;
     
-    std::vector<nlohmann::json> values;
-    if (!result.is_null() && result.contains("result") && result["result"].contains("stack")) {
-        for (const auto& item : result["result"]["stack"]) {
-            values.push_back(item);
-        }
-    }
-    
-    return values;
+    return parseTraverseResult(result);
 }
 
 void Iterator::terminate() {
@@ -56,6 +184,103 @@ void Iterator::terminate() {
     }
 }
 
+SharedPtr<ItemStream> Iterator::stream(size_t pageSize, bool prefetch) {
+    ensureNotTraversed();
+    
+    if (pageSize == 0) {
+        pageSize = count_ > 0 ? count_ : DEFAULT_PAGE_SIZE;
+    }
+    
+    // The stream owns the session from here on
+    traversed_ = true;
+    
+    auto client = client_;
+    auto sessionId = sessionId_;
+    auto iteratorId = iteratorId_;
+    auto traverse = [client, sessionId, iteratorId](uint32_t count) {
+        return client->traverseIterator(sessionId, iteratorId, count);
+    };
+    auto onClose = [client, sessionId]() {
+        client->terminateSession(sessionId);
+    };
+    return std::make_shared<ItemStream>(makePageFetcher(traverse, pageSize), onClose, prefetch);
+}
+
+ItemStream::PageFetcher Iterator::makePageFetcher(std::function<nlohmann::json(uint32_t)> traverse,
+                                                  size_t pageSize) {
+    // Pages are fetched one after another, so the page limit needs no locking
+    return [traverse = std::move(traverse), pageSize, pageLimit = size_t(0)]() mutable {
+        IteratorPage page;
+        page.items = parseTraverseResult(traverse(static_cast<uint32_t>(pageSize)));
+        
+        if (page.items.empty()) {
+            page.hasMore = false;
+        } else if (pageLimit == 0) {
+            // A short first page is either the end or the node's MaxIteratorResultItems,
+            // which may be set below the default; only the next page tells them apart
+            pageLimit = page.items.size();
+            page.hasMore = true;
+        } else {
+            // Every page but the last is as long as the first
+            page.hasMore = page.items.size() >= pageLimit;
+        }
+        return page;
+    };
+}
+
+SharedPtr<ItemStream> Iterator::fromInvokeResult(const nlohmann::json& result,
+                                                 const SharedPtr<EpicChainRpcClient>& client,
+                                                 size_t pageSize,
+                                                 bool prefetch) {
+    if (!result.contains("stack") || !result["stack"].is_array() || result["stack"].empty()) {
+        return std::make_shared<ItemStream>(std::vector<nlohmann::json>());
+    }
+    
+    const auto& item = result["stack"][0];
+    std::string type = item.value("type", "");
+    
+    if (type == "Array") {
+        return std::make_shared<ItemStream>(item["value"].get<std::vector<nlohmann::json>>());
+    }
+    
+    if (type == "InteropInterface") {
+        // Nodes with sessions disabled expand the iterator inline
+        if (item.contains("iterator")) {
+            return std::make_shared<ItemStream>(item["iterator"].get<std::vector<nlohmann::json>>());
+        }
+        if (!result.contains("session") || !item.contains("id")) {
+            throw IllegalStateException("Iterator result has no session or iterator ID");
+        }
+        Iterator iterator(result["session"].get<std::string>(), item["id"].get<std::string>(), client);
+        return iterator.stream(pageSize, prefetch);
+    }
+    
+    throw IllegalArgumentException("Expected an iterator or array result, got " + type);
+}
+
+SharedPtr<ItemStream> Iterator::findStorage(const SharedPtr<EpicChainRpcClient>& client,
+                                            const Hash160& scriptHash,
+                                            const Bytes& prefix,
+                                            bool prefetch) {
+    if (!client) {
+        throw IllegalArgumentException("RPC client cannot be null");
+    }
+    
+    // Pages are fetched one after another, so the cursor needs no locking
+    std::string encodedPrefix = Base64::encode(prefix);
+    auto fetcher = [client, scriptHash, encodedPrefix, start = 0]() mutable {
+        auto result = client->findStorage(scriptHash, encodedPrefix, start);
+        IteratorPage page;
+        if (result.contains("results") && result["results"].is_array()) {
+            page.items = result["results"].get<std::vector<nlohmann::json>>();
+        }
+        page.hasMore = result.value("truncated", false);
+        start = result.value("next", start + static_cast<int>(page.items.size()));
+        return page;
+    };
+    return std::make_shared<ItemStream>(fetcher, nullptr, prefetch);
+}
+
 void Iterator::ensureNotTraversed() {
     if (traversed_) {
         throw IllegalStateException("Iterator has already been traversed");
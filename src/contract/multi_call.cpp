@@ -0,0 +1,130 @@
+#include "epicchaincpp/contract/multi_call.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
+#include "epicchaincpp/protocol/response_types_impl.hpp"
+#include "epicchaincpp/script/script_builder.hpp"
+#include "epicchaincpp/utils/base64.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <algorithm>
+
+namespace epicchaincpp {
+
+// MultiCallResult
+
+MultiCallResult::MultiCallResult(std::vector<nlohmann::json> items)
+    : items_(std::move(items)) {
+}
+
+const nlohmann::json& MultiCallResult::getItem(size_t index) const {
+    if (index >= items_.size()) {
+        throw IllegalArgumentException("MultiCall result index " + std::to_string(index) + " out of range");
+    }
+    return items_[index];
+}
+
+bool MultiCallResult::getBoolean(size_t index) const {
+    const auto& item = getItem(index);
+    std::string type = item.value("type", "");
+    if (type == "Boolean") {
+        return item["value"].get<bool>();
+    }
+    if (type == "Integer") {
+        return getInteger(index) != 0;
+    }
+    throw IllegalStateException("Cannot decode " + type + " result " + std::to_string(index) + " as boolean");
+}
+
+int64_t MultiCallResult::getInteger(size_t index) const {
+    const auto& item = getItem(index);
+    std::string type = item.value("type", "");
+    if (type == "Integer") {
+        // Integers are serialized as decimal strings by the node
+        const auto& value = item["value"];
+        return value.is_string() ? std::stoll(value.get<std::string>()) : value.get<int64_t>();
+    }
+    if (type == "Boolean") {
+        return item["value"].get<bool>() ? 1 : 0;
+    }
+    throw IllegalStateException("Cannot decode " + type + " result " + std::to_string(index) + " as integer");
+}
+
+Bytes MultiCallResult::getByteArray(size_t index) const {
+    const auto& item = getItem(index);
+    std::string type = item.value("type", "");
+    if (type == "ByteString" || type == "Buffer") {
+        return Base64::decode(item["value"].get<std::string>());
+    }
+    throw IllegalStateException("Cannot decode " + type + " result " + std::to_string(index) + " as bytes");
+}
+
+std::string MultiCallResult::getString(size_t index) const {
+    Bytes bytes = getByteArray(index);
+    return std::string(bytes.begin(), bytes.end());
+}
+
+Hash160 MultiCallResult::getHash160(size_t index) const {
+    Bytes bytes = getByteArray(index);
+    // The VM holds UInt160 values in little-endian order
+    std::reverse(bytes.begin(), bytes.end());
+    return Hash160(bytes);
+}
+
+// MultiCall
+
+MultiCall::MultiCall(const SharedPtr<EpicChainRpcClient>& client, size_t batchSize)
+    : client_(client), batchSize_(batchSize) {
+    if (batchSize_ == 0) {
+        throw IllegalArgumentException("Batch size must be positive");
+    }
+}
+
+size_t MultiCall::add(const Hash160& scriptHash, const std::string& method,
+                      const std::vector<ContractParameter>& params) {
+    calls_.push_back({scriptHash, method, params});
+    return calls_.size() - 1;
+}
+
+std::vector<Bytes> MultiCall::buildScripts() const {
+    std::vector<Bytes> scripts;
+    for (size_t begin = 0; begin < calls_.size(); begin += batchSize_) {
+        size_t end = std::min(calls_.size(), begin + batchSize_);
+        
+        // PACK puts the last pushed item first, so push the calls in reverse
+        ScriptBuilder builder;
+        for (size_t i = end; i-- > begin;) {
+            builder.callContract(calls_[i].scriptHash, calls_[i].method, calls_[i].params);
+        }
+        builder.pushInteger(static_cast<int64_t>(end - begin));
+        builder.emit(OpCode::PACK);
+        scripts.push_back(builder.toArray());
+    }
+    return scripts;
+}
+
+MultiCallResult MultiCall::execute() const {
+    if (!client_) {
+        throw IllegalStateException("RPC client not set");
+    }
+    
+    std::vector<nlohmann::json> items;
+    items.reserve(calls_.size());
+    for (const auto& script : buildScripts()) {
+        nlohmann::json result = client_->invokeScript(script)->getRawJson();
+        if (result.value("state", "") != "HALT") {
+            std::string reason = result.contains("exception") && result["exception"].is_string()
+                ? result["exception"].get<std::string>() : "no exception message";
+            throw ScriptException("MultiCall invocation faulted: " + reason);
+        }
+        
+        size_t expected = std::min(batchSize_, calls_.size() - items.size());
+        if (!result.contains("stack") || result["stack"].empty() ||
+            result["stack"][0].value("type", "") != "Array" || result["stack"][0]["value"].size() != expected) {
+            throw RpcException("Unexpected MultiCall result stack");
+        }
+        for (auto& item : result["stack"][0]["value"]) {
+            items.push_back(std::move(item));
+        }
+    }
+    return MultiCallResult(std::move(items));
+}
+
+} // namespace epicchaincpp
@@ -1,5 +1,7 @@
 #include "epicchaincpp/contract/non_fungible_token.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
+#include "epicchaincpp/contract/contract_metadata_cache.hpp"
+#include "epicchaincpp/contract/multi_call.hpp"
 #include "epicchaincpp/types/contract_parameter.hpp"
 #include "epicchaincpp/wallet/account.hpp"
 #include "epicchaincpp/transaction/transaction_builder.hpp"
@@ -8,7 +10,43 @@
 
 namespace epicchaincpp {
 
-NonFungibleToken::NonFungibleToken(const Hash160& scriptHash, const SharedPtr<NeoRpcClient>& client)
+namespace {
+
+/// Drain a stream of token ID stack items
+std::vector<std::string> collectTokenIds(ItemStream& stream) {
+    std::vector<std::string> tokens;
+    for (const auto& item : stream) {
+        if (item.contains("value") && item["value"].is_string()) {
+            tokens.push_back(item["value"].get<std::string>());
+        }
+    }
+    return tokens;
+}
+
+/// Collect the string values of stack items
+std::vector<std::string> stackValues(const std::vector<nlohmann::json>& items) {
+    std::vector<std::string> values;
+    values.reserve(items.size());
+    for (const auto& item : items) {
+        values.push_back(item.contains("value") && item["value"].is_string()
+                         ? item["value"].get<std::string>() : std::string());
+    }
+    return values;
+}
+
+/// Build one single-argument call per token ID
+std::vector<std::vector<ContractParameter>> tokenIdCalls(const std::vector<std::string>& tokenIds) {
+    std::vector<std::vector<ContractParameter>> calls;
+    calls.reserve(tokenIds.size());
+    for (const auto& tokenId : tokenIds) {
+        calls.push_back({ContractParameter::string(tokenId)});
+    }
+    return calls;
+}
+
+} // namespace
+
+NonFungibleToken::NonFungibleToken(const Hash160& scriptHash, const SharedPtr<EpicChainRpcClient>& client)
     : SmartContract(scriptHash, client), decimals_(0), metadataLoaded_(false) {
 }
 
@@ -43,6 +81,10 @@ int64_t NonFungibleToken::getBalanceOf(const std::string& address) {
 }
 
 std::vector<std::string> NonFungibleToken::getTokensOf(const std::string& address) {
+    return collectTokenIds(*streamTokensOf(address));
+}
+
+SharedPtr<ItemStream> NonFungibleToken::streamTokensOf(const std::string& address, size_t pageSize, bool prefetch) {
     Bytes hashBytes = AddressUtils::addressToScriptHash(address);
     Hash160 scriptHash = Hash160(hashBytes);
     std::vector<ContractParameter> params = {
@@ -50,15 +92,16 @@ std::vector<std::string> NonFungibleToken::getTokensOf(const std::string& addres
     };
     
     auto result = invokeFunction("tokensOf", params);
-    std::vector<std::string> tokens;
-    
-    if (result["stack"][0]["type"] == "Array") {
-        for (const auto& item : result["stack"][0]["value"]) {
-            tokens.push_back(item["value"].get<std::string>());
-        }
-    }
+    return Iterator::fromInvokeResult(result, client_, pageSize, prefetch);
+}
+
+std::vector<std::string> NonFungibleToken::listTokensOf(const std::string& address, int maxItems) {
+    Bytes hashBytes = AddressUtils::addressToScriptHash(address);
+    std::vector<ContractParameter> params = {
+        ContractParameter::hash160(Hash160(hashBytes))
+    };
     
-    return tokens;
+    return stackValues(invokeAndUnwrapIterator("tokensOf", params, maxItems));
 }
 
 std::string NonFungibleToken::getOwnerOf(const std::string& tokenId) {
@@ -70,6 +113,10 @@ std::string NonFungibleToken::getOwnerOf(const std::string& tokenId) {
     return result["stack"][0]["value"].get<std::string>();
 }
 
+std::vector<std::string> NonFungibleToken::getOwnersOf(const std::vector<std::string>& tokenIds, size_t batchSize) {
+    return stackValues(invokeMany("ownerOf", tokenIdCalls(tokenIds), batchSize));
+}
+
 nlohmann::json NonFungibleToken::getProperties(const std::string& tokenId) {
     std::vector<ContractParameter> params = {
         ContractParameter::string(tokenId)
@@ -78,29 +125,21 @@ nlohmann::json NonFungibleToken::getProperties(const std::string& tokenId) {
     return invokeFunction("properties", params);
 }
 
+std::vector<nlohmann::json> NonFungibleToken::getProperties(const std::vector<std::string>& tokenIds, size_t batchSize) {
+    return invokeMany("properties", tokenIdCalls(tokenIds), batchSize);
+}
+
 std::vector<std::string> NonFungibleToken::getAllTokens() {
+    return collectTokenIds(*streamAllTokens());
+}
+
+SharedPtr<ItemStream> NonFungibleToken::streamAllTokens(size_t pageSize, bool prefetch) {
     auto result = invokeFunction("tokens");
-    std::vector<std::string> tokens;
-    
-    if (result["stack"][0]["type"] == "InteropInterface") {
-        // Iterator returned - this requires session-based RPC calls to traverse
-        // Since iterators are session-specific and require stateful connection,
-        // return empty vector. Callers should use paginated methods if available.
-        return tokens;
-    }
-    
-    // If result is an array, parse it
-    if (result["stack"][0]["type"] == "Array") {
-        for (const auto& item : result["stack"][0]["value"]) {
-            if (item["type"] == "ByteString") {
-                auto base64 = item["value"].get<std::string>();
-                // Decode base64 to get token ID
-                tokens.push_back(base64);
-            }
-        }
-    }
-    
-    return tokens;
+    return Iterator::fromInvokeResult(result, client_, pageSize, prefetch);
+}
+
+std::vector<std::string> NonFungibleToken::listAllTokens(int maxItems) {
+    return stackValues(invokeAndUnwrapIterator("tokens", {}, maxItems));
 }
 
 SharedPtr<TransactionBuilder> NonFungibleToken::transfer(const SharedPtr<Account>& from, 
@@ -174,20 +213,29 @@ SharedPtr<TransactionBuilder> NonFungibleToken::transfer(const SharedPtr<Account
 
 void NonFungibleToken::loadMetadata() {
     try {
-        auto symbolResult = invokeFunction("symbol");
-        symbol_ = symbolResult["stack"][0]["value"].get<std::string>();
-        
-        try {
-            auto decimalsResult = invokeFunction("decimals");
-            decimals_ = decimalsResult["stack"][0]["value"].get<int>();
-        } catch (...) {
-            decimals_ = 0; // Default for NFTs
-        }
+        auto metadata = getTokenMetadata([this]() {
+            TokenMetadata token;
+            MultiCall symbolCall(client_);
+            symbolCall.add(scriptHash_, "symbol");
+            token.symbol = symbolCall.execute().getString(0);
+            
+            // Kept out of the symbol batch: a faulting call aborts its whole batch
+            try {
+                MultiCall decimalsCall(client_);
+                decimalsCall.add(scriptHash_, "decimals");
+                token.decimals = static_cast<int>(decimalsCall.execute().getInteger(0));
+            } catch (...) {
+                token.decimals = 0; // Default for NFTs
+            }
+            return token;
+        });
         
+        symbol_ = metadata->symbol;
+        decimals_ = metadata->decimals;
         metadataLoaded_ = true;
     } catch (const std::exception& e) {
         throw IllegalStateException("Failed to load NFT metadata: " + std::string(e.what()));
     }
 }
 
-} // namespace epicchaincpp
\ No newline at end of file
+} // namespace epicchaincpp
@@ -1,5 +1,5 @@
 #include "epicchaincpp/contract/policy_contract.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
 #include "epicchaincpp/types/contract_parameter.hpp"
 #include "epicchaincpp/transaction/transaction_builder.hpp"
 #include "epicchaincpp/exceptions.hpp"
@@ -9,11 +9,11 @@ namespace epicchaincpp {
 const Hash160 PolicyContract::SCRIPT_HASH = Hash160("0xcc5e4edd9f5f8dba8bb65734541df7a1c081c67b");
 const std::string PolicyContract::NAME = "PolicyContract";
 
-PolicyContract::PolicyContract(const SharedPtr<NeoRpcClient>& client)
+PolicyContract::PolicyContract(const SharedPtr<EpicChainRpcClient>& client)
     : SmartContract(SCRIPT_HASH, client) {
 }
 
-SharedPtr<PolicyContract> PolicyContract::create(const SharedPtr<NeoRpcClient>& client) {
+SharedPtr<PolicyContract> PolicyContract::create(const SharedPtr<EpicChainRpcClient>& client) {
     return std::make_shared<PolicyContract>(client);
 }
 
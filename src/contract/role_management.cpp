@@ -1,5 +1,5 @@
 #include "epicchaincpp/contract/role_management.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
 #include "epicchaincpp/types/contract_parameter.hpp"
 #include "epicchaincpp/transaction/transaction_builder.hpp"
 #include "epicchaincpp/utils/hex.hpp"
@@ -10,11 +10,11 @@ namespace epicchaincpp {
 const Hash160 RoleManagement::SCRIPT_HASH = Hash160("0x49cf4e5378ffcd4dec034fd98a174c5491e395e2");
 const std::string RoleManagement::NAME = "RoleManagement";
 
-RoleManagement::RoleManagement(const SharedPtr<NeoRpcClient>& client)
+RoleManagement::RoleManagement(const SharedPtr<EpicChainRpcClient>& client)
     : SmartContract(SCRIPT_HASH, client) {
 }
 
-SharedPtr<RoleManagement> RoleManagement::create(const SharedPtr<NeoRpcClient>& client) {
+SharedPtr<RoleManagement> RoleManagement::create(const SharedPtr<EpicChainRpcClient>& client) {
     return std::make_shared<RoleManagement>(client);
 }
 
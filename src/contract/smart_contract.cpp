@@ -1,15 +1,19 @@
 #include "epicchaincpp/contract/smart_contract.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/contract/iterator.hpp"
+#include "epicchaincpp/contract/multi_call.hpp"
+#include "epicchaincpp/contract/contract_metadata_cache.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
 #include "epicchaincpp/protocol/response_types.hpp"
 #include "epicchaincpp/transaction/transaction_builder.hpp"
+#include "epicchaincpp/script/script_builder.hpp"
 #include "epicchaincpp/types/contract_parameter.hpp"
 #include "epicchaincpp/wallet/account.hpp"
 #include "epicchaincpp/exceptions.hpp"
 
 namespace epicchaincpp {
 
-SmartContract::SmartContract(const Hash160& scriptHash, const SharedPtr<NeoRpcClient>& client)
-    : scriptHash_(scriptHash), client_(client) {
+SmartContract::SmartContract(const Hash160& scriptHash, const SharedPtr<EpicChainRpcClient>& client)
+    : scriptHash_(scriptHash), client_(client), metadataNetwork_(0) {
     if (!client) {
         throw IllegalArgumentException("RPC client cannot be null");
     }
@@ -25,6 +29,43 @@ nlohmann::json SmartContract::invokeFunction(const std::string& method, const st
     return result->getRawJson();
 }
 
+std::vector<nlohmann::json> SmartContract::invokeMany(const std::string& method,
+                                                      const std::vector<std::vector<ContractParameter>>& calls,
+                                                      size_t batchSize) {
+    MultiCall multiCall(client_, batchSize);
+    for (const auto& params : calls) {
+        multiCall.add(scriptHash_, method, params);
+    }
+    return multiCall.execute().getItems();
+}
+
+std::vector<nlohmann::json> SmartContract::invokeAndUnwrapIterator(const std::string& method,
+                                                                   const std::vector<ContractParameter>& params,
+                                                                   int maxItems) {
+    ScriptBuilder builder;
+    builder.callContractAndUnwrapIterator(scriptHash_, method, params, maxItems);
+    
+    auto stack = invokeScriptStack(builder.toArray());
+    if (stack.empty() || stack[0]["type"] != "Array") {
+        throw RpcException("Unexpected result of unwrapped " + method + " invocation");
+    }
+    return stack[0]["value"].get<std::vector<nlohmann::json>>();
+}
+
+nlohmann::json SmartContract::invokeScriptStack(const Bytes& script) {
+    if (!client_) {
+        throw IllegalStateException("RPC client not set");
+    }
+    
+    nlohmann::json result = client_->invokeScript(script)->getRawJson();
+    if (result.value("state", "") != "HALT") {
+        std::string reason = result.contains("exception") && result["exception"].is_string()
+            ? result["exception"].get<std::string>() : "no exception message";
+        throw ScriptException("Invocation faulted: " + reason);
+    }
+    return result.contains("stack") ? result["stack"] : nlohmann::json::array();
+}
+
 SharedPtr<TransactionBuilder> SmartContract::buildInvokeTx(const std::string& method,
                                                            const std::vector<ContractParameter>& params,
                                                            const SharedPtr<Account>& account) {
@@ -34,27 +75,48 @@ SharedPtr<TransactionBuilder> SmartContract::buildInvokeTx(const std::string& me
     return builder;
 }
 
-nlohmann::json SmartContract::getManifest() {
+SharedPtr<const ContractMetadata> SmartContract::getContractMetadata() {
     if (!client_) {
         throw IllegalStateException("RPC client not set");
     }
     
-    auto state = client_->getContractState(scriptHash_);
-    auto contractState = state->getContractState();
-    return contractState.manifest;
+    auto fetch = [this]() {
+        auto state = client_->getContractState(scriptHash_);
+        if (!state) {
+            throw RpcException("Contract " + scriptHash_.toString() + " not found");
+        }
+        auto contractState = state->getContractState();
+        ContractMetadata metadata;
+        metadata.id = contractState.id;
+        metadata.updateCounter = contractState.updateCounter;
+        metadata.nef = contractState.nef;
+        metadata.manifest = contractState.manifest;
+        return metadata;
+    };
+    
+    if (!metadataCache_) {
+        return std::make_shared<const ContractMetadata>(fetch());
+    }
+    return metadataCache_->getContractMetadata(metadataNetwork_, scriptHash_, fetch);
 }
 
-std::string SmartContract::getNef() {
-    if (!client_) {
-        throw IllegalStateException("RPC client not set");
+SharedPtr<const TokenMetadata> SmartContract::getTokenMetadata(const std::function<TokenMetadata()>& fetch) {
+    if (!metadataCache_) {
+        return std::make_shared<const TokenMetadata>(fetch());
     }
-    
-    auto state = client_->getContractState(scriptHash_);
-    auto contractState = state->getContractState();
-    return contractState.nef;
+    return metadataCache_->getTokenMetadata(metadataNetwork_, scriptHash_, fetch);
+}
+
+nlohmann::json SmartContract::getManifest() {
+    return getContractMetadata()->manifest;
+}
+
+std::string SmartContract::getNef() {
+    return getContractMetadata()->nef;
 }
 
 bool SmartContract::isDeployed() {
+    // Always ask the node: a cached state cannot tell that the contract was destroyed
     try {
         auto state = client_->getContractState(scriptHash_);
         return state != nullptr;
@@ -112,6 +174,10 @@ std::vector<nlohmann::json> SmartContract::getEvents() {
     return events;
 }
 
+SharedPtr<ItemStream> SmartContract::findStorage(const Bytes& prefix, bool prefetch) {
+    return Iterator::findStorage(client_, scriptHash_, prefix, prefetch);
+}
+
 nlohmann::json SmartContract::paramsToJson(const std::vector<ContractParameter>& params) {
     nlohmann::json jsonParams = nlohmann::json::array();
     for (const auto& param : params) {
@@ -2,7 +2,7 @@
 
 namespace epicchaincpp {
 
-Token::Token(const Hash160& scriptHash, const SharedPtr<NeoRpcClient>& client)
+Token::Token(const Hash160& scriptHash, const SharedPtr<EpicChainRpcClient>& client)
     : SmartContract(scriptHash, client) {
 }
 
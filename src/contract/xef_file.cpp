@@ -114,21 +114,23 @@ NefFile NefFile::deserialize(BinaryReader& reader) {
     NefFile nef;
     
     // Read magic
-    Bytes magicBytes = reader.readBytes(4);
-    nef.magic_ = std::string(magicBytes.begin(), magicBytes.end());
+    ByteSpan magic = reader.readSpan(4);
+    nef.magic_.assign(magic.begin(), magic.end());
     if (nef.magic_ != "NEF3") {
         throw IllegalArgumentException("Invalid NEF magic: " + nef.magic_);
     }
     
     // Read compiler and version
-    nef.compiler_ = reader.readVarString();
-    nef.version_ = reader.readVarString();
+    nef.compiler_ = reader.readVarStringView();
+    nef.version_ = reader.readVarStringView();
     
     // Read script
-    nef.script_ = reader.readVarBytes();
+    ByteSpan script = reader.readVarSpan();
+    nef.script_.assign(script.begin(), script.end());
     
     // Read checksum
-    nef.checksum_ = reader.readBytes(4);
+    ByteSpan checksum = reader.readSpan(4);
+    nef.checksum_.assign(checksum.begin(), checksum.end());
     
     // Verify checksum
     if (!nef.verifyChecksum()) {
@@ -14,11 +14,86 @@
 #include <random>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
 
 namespace epicchaincpp {
 
 // ECPrivateKey implementation
 
+namespace {
+
+// Order n of secp256k1; valid private keys lie in [1, n - 1]
+const std::array<uint8_t, 32> CURVE_ORDER = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0xBA, 0xAE, 0xDC, 0xE6, 0xAF, 0x48, 0xA0, 0x3B, 0xBF, 0xD2, 0x5E, 0x8C, 0xD0, 0x36, 0x41, 0x41
+};
+
+bool isValidPrivateKey(const std::array<uint8_t, NeoConstants::PRIVATE_KEY_SIZE>& key) {
+    bool zero = std::all_of(key.begin(), key.end(), [](uint8_t b) { return b == 0; });
+    return !zero && std::lexicographical_compare(key.begin(), key.end(), CURVE_ORDER.begin(), CURVE_ORDER.end());
+}
+
+/// Create an EC_KEY holding the private key and its public point
+EC_KEY* createKey(const std::array<uint8_t, NeoConstants::PRIVATE_KEY_SIZE>& key) {
+    EC_KEY* eckey = EC_KEY_new_by_curve_name(NID_secp256k1);
+    if (!eckey) {
+        throw CryptoException("Failed to create EC_KEY");
+    }
+    
+    BIGNUM* priv_bn = BN_bin2bn(key.data(), 32, nullptr);
+    if (!priv_bn || EC_KEY_set_private_key(eckey, priv_bn) != 1) {
+        if (priv_bn) BN_clear_free(priv_bn);
+        EC_KEY_free(eckey);
+        throw CryptoException("Failed to set private key");
+    }
+    
+    // Derive the public key from the private key
+    const EC_GROUP* group = EC_KEY_get0_group(eckey);
+    EC_POINT* pub_point = EC_POINT_new(group);
+    if (!pub_point || !EC_POINT_mul(group, pub_point, priv_bn, nullptr, nullptr, nullptr) ||
+        EC_KEY_set_public_key(eckey, pub_point) != 1) {
+        EC_POINT_free(pub_point);
+        BN_clear_free(priv_bn);
+        EC_KEY_free(eckey);
+        throw CryptoException("Failed to generate public key");
+    }
+    EC_POINT_free(pub_point);
+    BN_clear_free(priv_bn);
+    return eckey;
+}
+
+} // namespace
+
+/// Owns an EC_KEY with both halves set. The key is only read after
+/// construction, so one instance can sign from several threads at once.
+class ECPrivateKey::OpenSSLKey {
+private:
+    EC_KEY* key_;
+    SharedPtr<ECPublicKey> publicKey_;
+    
+public:
+    explicit OpenSSLKey(EC_KEY* key) : key_(key) {
+        const EC_GROUP* group = EC_KEY_get0_group(key_);
+        Bytes encoded(33);
+        if (EC_POINT_point2oct(group, EC_KEY_get0_public_key(key_), POINT_CONVERSION_COMPRESSED,
+                               encoded.data(), encoded.size(), nullptr) != encoded.size()) {
+            EC_KEY_free(key_);
+            throw CryptoException("Failed to encode public key");
+        }
+        publicKey_ = std::make_shared<ECPublicKey>(encoded);
+    }
+    
+    ~OpenSSLKey() {
+        EC_KEY_free(key_);
+    }
+    
+    OpenSSLKey(const OpenSSLKey&) = delete;
+    OpenSSLKey& operator=(const OpenSSLKey&) = delete;
+    
+    EC_KEY* get() const { return key_; }
+    const SharedPtr<ECPublicKey>& getPublicKey() const { return publicKey_; }
+};
+
 ECPrivateKey ECPrivateKey::generate() {
     EC_KEY* eckey = EC_KEY_new_by_curve_name(NID_secp256k1);
     if (!eckey) {
@@ -35,8 +110,10 @@ ECPrivateKey ECPrivateKey::generate() {
     key.fill(0);
     BN_bn2binpad(priv_bn, key.data(), 32);
     
-    EC_KEY_free(eckey);
-    return ECPrivateKey(key);
+    // The generated EC_KEY already has its public key; keep it as the cache
+    ECPrivateKey privateKey(key);
+    privateKey.openSSLKey_ = std::make_shared<const OpenSSLKey>(eckey);
+    return privateKey;
 }
 
 ECPrivateKey::ECPrivateKey(const Bytes& bytes) {
@@ -44,46 +121,49 @@ ECPrivateKey::ECPrivateKey(const Bytes& bytes) {
         throw IllegalArgumentException("Private key must be 32 bytes");
     }
     std::copy(bytes.begin(), bytes.end(), key_.begin());
-    
-    // Verify the private key is valid using OpenSSL
-    EC_KEY* eckey = EC_KEY_new_by_curve_name(NID_secp256k1);
-    if (!eckey) {
-        throw CryptoException("Failed to create EC_KEY");
-    }
-    
-    BIGNUM* priv_bn = BN_bin2bn(key_.data(), 32, nullptr);
-    if (!priv_bn || EC_KEY_set_private_key(eckey, priv_bn) != 1) {
-        if (priv_bn) BN_free(priv_bn);
-        EC_KEY_free(eckey);
+    if (!isValidPrivateKey(key_)) {
         throw IllegalArgumentException("Invalid private key");
     }
-    
-    BN_free(priv_bn);
-    EC_KEY_free(eckey);
 }
 
 ECPrivateKey::ECPrivateKey(const std::array<uint8_t, NeoConstants::PRIVATE_KEY_SIZE>& key) 
     : key_(key) {
-    EC_KEY* eckey = EC_KEY_new_by_curve_name(NID_secp256k1);
-    if (!eckey) {
-        throw CryptoException("Failed to create EC_KEY");
-    }
-    
-    BIGNUM* priv_bn = BN_bin2bn(key_.data(), 32, nullptr);
-    if (!priv_bn || EC_KEY_set_private_key(eckey, priv_bn) != 1) {
-        if (priv_bn) BN_free(priv_bn);
-        EC_KEY_free(eckey);
+    if (!isValidPrivateKey(key_)) {
         throw IllegalArgumentException("Invalid private key");
     }
-    
-    BN_free(priv_bn);
-    EC_KEY_free(eckey);
 }
 
 ECPrivateKey::ECPrivateKey(const std::string& hex) 
     : ECPrivateKey(ByteUtils::fromHex(hex)) {
 }
 
+ECPrivateKey::ECPrivateKey(const ECPrivateKey& other)
+    : key_(other.key_), openSSLKey_(std::atomic_load(&other.openSSLKey_)) {
+}
+
+ECPrivateKey& ECPrivateKey::operator=(const ECPrivateKey& other) {
+    if (this != &other) {
+        key_ = other.key_;
+        std::atomic_store(&openSSLKey_, std::atomic_load(&other.openSSLKey_));
+    }
+    return *this;
+}
+
+ECPrivateKey::~ECPrivateKey() = default;
+
+const ECPrivateKey::OpenSSLKey& ECPrivateKey::openSSLKey() const {
+    auto cached = std::atomic_load(&openSSLKey_);
+    if (!cached) {
+        // Concurrent first uses may each build a key; only one is kept
+        SharedPtr<const OpenSSLKey> created = std::make_shared<const OpenSSLKey>(createKey(key_));
+        if (std::atomic_compare_exchange_strong(&openSSLKey_, &cached, created)) {
+            cached = created;
+        }
+    }
+    // openSSLKey_ is never reset once set, so the object outlives this call
+    return *cached;
+}
+
 Bytes ECPrivateKey::getBytes() const {
     return Bytes(key_.begin(), key_.end());
 }
@@ -93,65 +173,20 @@ std::string ECPrivateKey::toHex() const {
 }
 
 SharedPtr<ECPublicKey> ECPrivateKey::getPublicKey() const {
-    EC_KEY* eckey = EC_KEY_new_by_curve_name(NID_secp256k1);
-    if (!eckey) {
-        throw CryptoException("Failed to create EC_KEY");
-    }
-    
-    BIGNUM* priv_bn = BN_bin2bn(key_.data(), 32, nullptr);
-    if (!priv_bn || EC_KEY_set_private_key(eckey, priv_bn) != 1) {
-        if (priv_bn) BN_free(priv_bn);
-        EC_KEY_free(eckey);
-        throw CryptoException("Failed to set private key");
-    }
-    BN_free(priv_bn);
-    
-    // Generate public key from private key
-    const EC_GROUP* group = EC_KEY_get0_group(eckey);
-    EC_POINT* pub_point = EC_POINT_new(group);
-    BN_CTX* ctx = BN_CTX_new();
-    
-    if (!EC_POINT_mul(group, pub_point, EC_KEY_get0_private_key(eckey), nullptr, nullptr, ctx)) {
-        BN_CTX_free(ctx);
-        EC_POINT_free(pub_point);
-        EC_KEY_free(eckey);
-        throw CryptoException("Failed to generate public key");
-    }
-    
-    EC_KEY_set_public_key(eckey, pub_point);
-    
-    // Get compressed public key (33 bytes)
-    size_t len = 33;
-    Bytes encoded(len);
-    EC_POINT_point2oct(group, pub_point, POINT_CONVERSION_COMPRESSED, encoded.data(), len, ctx);
-    
-    BN_CTX_free(ctx);
-    EC_POINT_free(pub_point);
-    EC_KEY_free(eckey);
-    return std::make_shared<ECPublicKey>(encoded);
+    return openSSLKey().getPublicKey();
 }
 
 SharedPtr<ECDSASignature> ECPrivateKey::sign(const Bytes& message) const {
-    EC_KEY* eckey = EC_KEY_new_by_curve_name(NID_secp256k1);
-    if (!eckey) {
-        throw CryptoException("Failed to create EC_KEY");
-    }
-    
-    BIGNUM* priv_bn = BN_bin2bn(key_.data(), 32, nullptr);
-    if (!priv_bn || EC_KEY_set_private_key(eckey, priv_bn) != 1) {
-        if (priv_bn) BN_free(priv_bn);
-        EC_KEY_free(eckey);
-        throw CryptoException("Failed to set private key");
+    return signHash(HashUtils::sha256(message));
+}
+
+SharedPtr<ECDSASignature> ECPrivateKey::signHash(const Bytes& hash) const {
+    if (hash.size() != 32) {
+        throw IllegalArgumentException("Hash must be 32 bytes");
     }
-    BN_free(priv_bn);
-    
-    // Hash the message
-    Bytes hash = HashUtils::sha256(message);
     
-    // Sign the hash
-    ECDSA_SIG* sig = ECDSA_do_sign(hash.data(), hash.size(), eckey);
+    ECDSA_SIG* sig = ECDSA_do_sign(hash.data(), static_cast<int>(hash.size()), openSSLKey().get());
     if (!sig) {
-        EC_KEY_free(eckey);
         throw SignException("Failed to sign message");
     }
     
@@ -166,7 +201,6 @@ SharedPtr<ECDSASignature> ECPrivateKey::sign(const Bytes& message) const {
     BN_bn2binpad(s, signature.data() + 32, 32);
     
     ECDSA_SIG_free(sig);
-    EC_KEY_free(eckey);
     return std::make_shared<ECDSASignature>(signature);
 }
 
@@ -1,58 +1,134 @@
 #include "epicchaincpp/crypto/hash.hpp"
+#include "epicchaincpp/exceptions.hpp"
 #include <openssl/sha.h>
 #include <openssl/ripemd.h>
 #include <openssl/evp.h>
 #include <openssl/hmac.h>
 #include <cstring>
+#include <vector>
 
 namespace epicchaincpp {
 
-Bytes HashUtils::sha256(const Bytes& data) {
-    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
-    Bytes result(SHA256_DIGEST_LENGTH);
-    unsigned int len = SHA256_DIGEST_LENGTH;
+namespace {
+
+enum Algorithm { SHA256_ALGORITHM, RIPEMD160_ALGORITHM, KECCAK256_ALGORITHM, ALGORITHM_COUNT };
+
+const EVP_MD* digestOf(Algorithm algorithm) {
+    switch (algorithm) {
+        case SHA256_ALGORITHM: return EVP_sha256();
+        case RIPEMD160_ALGORITHM: return EVP_ripemd160();
+        default: return EVP_sha3_256();
+    }
+}
+
+/// Digest contexts of one thread that are not in use.
+/// A context is set up with its digest once; taking it again only resets its
+/// state, which skips the digest lookup and the allocation of a fresh context.
+class ContextPool {
+private:
+    std::vector<EVP_MD_CTX*> spare_[ALGORITHM_COUNT];
     
-    EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr);
-    EVP_DigestUpdate(ctx, data.data(), data.size());
-    EVP_DigestFinal_ex(ctx, result.data(), &len);
+public:
+    ~ContextPool() {
+        for (auto& spare : spare_) {
+            for (EVP_MD_CTX* ctx : spare) {
+                EVP_MD_CTX_free(ctx);
+            }
+        }
+    }
     
-    EVP_MD_CTX_free(ctx);
-    return result;
+    EVP_MD_CTX* acquire(Algorithm algorithm) {
+        auto& spare = spare_[algorithm];
+        if (!spare.empty()) {
+            EVP_MD_CTX* ctx = spare.back();
+            spare.pop_back();
+            if (EVP_DigestInit_ex(ctx, nullptr, nullptr) != 1) {
+                EVP_MD_CTX_free(ctx);
+                throw RuntimeException("Failed to reset digest context");
+            }
+            return ctx;
+        }
+        EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+        if (!ctx || EVP_DigestInit_ex(ctx, digestOf(algorithm), nullptr) != 1) {
+            EVP_MD_CTX_free(ctx);
+            throw RuntimeException("Failed to create digest context");
+        }
+        return ctx;
+    }
+    
+    void release(Algorithm algorithm, EVP_MD_CTX* ctx) {
+        spare_[algorithm].push_back(ctx);
+    }
+};
+
+ContextPool& contextPool() {
+    thread_local ContextPool pool;
+    return pool;
+}
+
+/// One-shot digest on a pooled context
+void digest(Algorithm algorithm, const uint8_t* data, size_t length, uint8_t* out) {
+    ContextPool& pool = contextPool();
+    EVP_MD_CTX* ctx = pool.acquire(algorithm);
+    EVP_DigestUpdate(ctx, data, length);
+    EVP_DigestFinal_ex(ctx, out, nullptr);
+    pool.release(algorithm, ctx);
+}
+
+} // namespace
+
+void HashUtils::sha256(const uint8_t* data, size_t length, Digest256& out) {
+    digest(SHA256_ALGORITHM, data, length, out.data());
+}
+
+void HashUtils::doubleSha256(const uint8_t* data, size_t length, Digest256& out) {
+    Digest256 first;
+    digest(SHA256_ALGORITHM, data, length, first.data());
+    digest(SHA256_ALGORITHM, first.data(), first.size(), out.data());
+}
+
+void HashUtils::ripemd160(const uint8_t* data, size_t length, Digest160& out) {
+    digest(RIPEMD160_ALGORITHM, data, length, out.data());
+}
+
+void HashUtils::sha256ThenRipemd160(const uint8_t* data, size_t length, Digest160& out) {
+    Digest256 first;
+    digest(SHA256_ALGORITHM, data, length, first.data());
+    digest(RIPEMD160_ALGORITHM, first.data(), first.size(), out.data());
+}
+
+void HashUtils::keccak256(const uint8_t* data, size_t length, Digest256& out) {
+    digest(KECCAK256_ALGORITHM, data, length, out.data());
+}
+
+Bytes HashUtils::sha256(const Bytes& data) {
+    Digest256 hash;
+    sha256(data.data(), data.size(), hash);
+    return Bytes(hash.begin(), hash.end());
 }
 
 Bytes HashUtils::doubleSha256(const Bytes& data) {
-    return sha256(sha256(data));
+    Digest256 hash;
+    doubleSha256(data.data(), data.size(), hash);
+    return Bytes(hash.begin(), hash.end());
 }
 
 Bytes HashUtils::ripemd160(const Bytes& data) {
-    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
-    Bytes result(20); // RIPEMD160 produces 20 bytes
-    unsigned int len = 20;
-    
-    EVP_DigestInit_ex(ctx, EVP_ripemd160(), nullptr);
-    EVP_DigestUpdate(ctx, data.data(), data.size());
-    EVP_DigestFinal_ex(ctx, result.data(), &len);
-    
-    EVP_MD_CTX_free(ctx);
-    return result;
+    Digest160 hash;
+    ripemd160(data.data(), data.size(), hash);
+    return Bytes(hash.begin(), hash.end());
 }
 
 Bytes HashUtils::sha256ThenRipemd160(const Bytes& data) {
-    return ripemd160(sha256(data));
+    Digest160 hash;
+    sha256ThenRipemd160(data.data(), data.size(), hash);
+    return Bytes(hash.begin(), hash.end());
 }
 
 Bytes HashUtils::keccak256(const Bytes& data) {
-    Bytes result(32);
-    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
-    const EVP_MD* md = EVP_sha3_256();
-    
-    EVP_DigestInit_ex(ctx, md, nullptr);
-    EVP_DigestUpdate(ctx, data.data(), data.size());
-    unsigned int len = 32;
-    EVP_DigestFinal_ex(ctx, result.data(), &len);
-    
-    EVP_MD_CTX_free(ctx);
-    return result;
+    Digest256 hash;
+    keccak256(data.data(), data.size(), hash);
+    return Bytes(hash.begin(), hash.end());
 }
 
 Bytes HashUtils::hmacSha256(const Bytes& key, const Bytes& data) {
@@ -65,4 +141,44 @@ Bytes HashUtils::hmacSha256(const Bytes& key, const Bytes& data) {
     return result;
 }
 
-} // namespace epicchaincpp
\ No newline at end of file
+Sha256Hasher::Sha256Hasher() : ctx_(contextPool().acquire(SHA256_ALGORITHM)) {
+}
+
+Sha256Hasher::~Sha256Hasher() {
+    contextPool().release(SHA256_ALGORITHM, ctx_);
+}
+
+void Sha256Hasher::restart() {
+    // Deferred from final() so a hasher used once never pays for a reset
+    EVP_DigestInit_ex(ctx_, nullptr, nullptr);
+    finished_ = false;
+}
+
+void Sha256Hasher::updateLarge(const uint8_t* data, size_t length) {
+    EVP_DigestUpdate(ctx_, pending_.data(), pendingSize_);
+    pendingSize_ = 0;
+    if (length < pending_.size()) {
+        std::memcpy(pending_.data(), data, length);
+        pendingSize_ = length;
+    } else {
+        EVP_DigestUpdate(ctx_, data, length);
+    }
+}
+
+void Sha256Hasher::final(Digest256& out) {
+    if (finished_) {
+        restart();
+    }
+    EVP_DigestUpdate(ctx_, pending_.data(), pendingSize_);
+    pendingSize_ = 0;
+    EVP_DigestFinal_ex(ctx_, out.data(), nullptr);
+    finished_ = true;
+}
+
+Digest256 Sha256Hasher::final() {
+    Digest256 out;
+    final(out);
+    return out;
+}
+
+} // namespace epicchaincpp
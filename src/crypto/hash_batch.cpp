@@ -0,0 +1,490 @@
+#include "epicchaincpp/crypto/hash.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define EPICCHAIN_HASH_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+namespace epicchaincpp {
+
+namespace {
+
+constexpr uint32_t SHA256_K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+constexpr uint32_t SHA256_H0[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+constexpr uint32_t RIPEMD160_H0[5] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+
+// RIPEMD160 message word order and rotations, left and right lines
+constexpr uint8_t RIPEMD160_R[80] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    7, 4, 13, 1, 10, 6, 15, 3, 12, 0, 9, 5, 2, 14, 11, 8,
+    3, 10, 14, 4, 9, 15, 8, 1, 2, 7, 0, 6, 13, 11, 5, 12,
+    1, 9, 11, 10, 0, 8, 12, 4, 13, 3, 7, 15, 14, 5, 6, 2,
+    4, 0, 5, 9, 7, 12, 2, 10, 14, 1, 3, 8, 11, 6, 15, 13
+};
+constexpr uint8_t RIPEMD160_RR[80] = {
+    5, 14, 7, 0, 9, 2, 11, 4, 13, 6, 15, 8, 1, 10, 3, 12,
+    6, 11, 3, 7, 0, 13, 5, 10, 14, 15, 8, 12, 4, 9, 1, 2,
+    15, 5, 1, 3, 7, 14, 6, 9, 11, 8, 12, 2, 10, 0, 4, 13,
+    8, 6, 4, 1, 3, 11, 15, 0, 5, 12, 2, 13, 9, 7, 10, 14,
+    12, 15, 10, 4, 1, 5, 8, 7, 6, 2, 13, 14, 0, 3, 9, 11
+};
+constexpr uint8_t RIPEMD160_S[80] = {
+    11, 14, 15, 12, 5, 8, 7, 9, 11, 13, 14, 15, 6, 7, 9, 8,
+    7, 6, 8, 13, 11, 9, 7, 15, 7, 12, 15, 9, 11, 7, 13, 12,
+    11, 13, 6, 7, 14, 9, 13, 15, 14, 8, 13, 6, 5, 12, 7, 5,
+    11, 12, 14, 15, 14, 15, 9, 8, 9, 14, 5, 6, 8, 6, 5, 12,
+    9, 15, 5, 11, 6, 8, 13, 12, 5, 12, 13, 14, 11, 8, 5, 6
+};
+constexpr uint8_t RIPEMD160_SR[80] = {
+    8, 9, 9, 11, 13, 15, 15, 5, 7, 7, 8, 11, 14, 14, 12, 6,
+    9, 13, 15, 7, 12, 8, 9, 11, 7, 7, 12, 7, 6, 15, 13, 11,
+    9, 7, 15, 11, 8, 6, 6, 14, 12, 13, 5, 14, 13, 13, 7, 5,
+    15, 5, 8, 11, 14, 14, 6, 14, 6, 9, 12, 9, 12, 5, 15, 8,
+    8, 5, 12, 9, 12, 5, 14, 6, 8, 13, 6, 5, 15, 13, 11, 11
+};
+constexpr uint32_t RIPEMD160_K[5] = {0x00000000, 0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xa953fd4e};
+constexpr uint32_t RIPEMD160_KR[5] = {0x50a28be6, 0x5c4dd124, 0x6d703ef3, 0x7a6d76e9, 0x00000000};
+
+inline uint32_t loadBigEndian32(const uint8_t* p) {
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+}
+
+inline uint32_t loadLittleEndian32(const uint8_t* p) {
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+inline void storeBigEndian32(uint8_t* p, uint32_t value) {
+    p[0] = uint8_t(value >> 24);
+    p[1] = uint8_t(value >> 16);
+    p[2] = uint8_t(value >> 8);
+    p[3] = uint8_t(value);
+}
+
+inline void storeLittleEndian32(uint8_t* p, uint32_t value) {
+    p[0] = uint8_t(value);
+    p[1] = uint8_t(value >> 8);
+    p[2] = uint8_t(value >> 16);
+    p[3] = uint8_t(value >> 24);
+}
+
+/// One message of a batch, split into the blocks read in place and the one
+/// or two padded blocks at its end
+struct Message {
+    const uint8_t* data = nullptr;
+    size_t fullBlocks = 0;
+    size_t blocks = 0;
+    uint8_t tail[128];
+    uint8_t* out = nullptr;
+    
+    void prepare(ByteSpan input, uint8_t* digest) {
+        data = input.data();
+        fullBlocks = input.size() / 64;
+        size_t rest = input.size() % 64;
+        size_t tailBlocks = rest + 9 > 64 ? 2 : 1;
+        blocks = fullBlocks + tailBlocks;
+        std::memset(tail, 0, tailBlocks * 64);
+        if (rest > 0) {
+            std::memcpy(tail, data + fullBlocks * 64, rest);
+        }
+        tail[rest] = 0x80;
+        uint64_t bits = static_cast<uint64_t>(input.size()) * 8;
+        for (int i = 0; i < 8; ++i) {
+            tail[tailBlocks * 64 - 1 - i] = uint8_t(bits >> (8 * i));
+        }
+        out = digest;
+    }
+    
+    const uint8_t* block(size_t index) const {
+        return index < fullBlocks ? data + index * 64 : tail + (index - fullBlocks) * 64;
+    }
+};
+
+void sha256Scalar(const ByteSpan* inputs, Digest256* outputs, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        HashUtils::sha256(inputs[i].data(), inputs[i].size(), outputs[i]);
+    }
+}
+
+void ripemd160Scalar(const Digest256* inputs, Digest160* outputs, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        HashUtils::ripemd160(inputs[i].data(), inputs[i].size(), outputs[i]);
+    }
+}
+
+#ifdef EPICCHAIN_HASH_X86
+
+// Lane-generic kernels, written with vector extensions so the same code is
+// compiled for each vector width by the target-specific entry points below.
+// Everything here is force-inlined into those entry points.
+#define HASH_INLINE inline __attribute__((always_inline))
+
+typedef uint32_t U32x8 __attribute__((vector_size(32)));
+typedef uint32_t U32x16 __attribute__((vector_size(64)));
+
+// Macros rather than functions: passing vectors by value outside their
+// target-specific functions draws ABI warnings
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define ROTL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+/// Transpose one 64-byte block per lane into 16 lane vectors
+template<typename V, size_t N, bool BigEndian>
+HASH_INLINE void loadWords(V (&words)[16], const uint8_t* const (&blocks)[N]) {
+    alignas(64) uint32_t lanes[16][N];
+    for (size_t lane = 0; lane < N; ++lane) {
+        for (size_t t = 0; t < 16; ++t) {
+            lanes[t][lane] = BigEndian ? loadBigEndian32(blocks[lane] + 4 * t)
+                                       : loadLittleEndian32(blocks[lane] + 4 * t);
+        }
+    }
+    std::memcpy(words, lanes, sizeof(lanes));
+}
+
+template<typename V, size_t N>
+HASH_INLINE void sha256CompressLanes(V (&state)[8], const uint8_t* const (&blocks)[N]) {
+    V w[16];
+    loadWords<V, N, true>(w, blocks);
+    V a = state[0], b = state[1], c = state[2], d = state[3];
+    V e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int t = 0; t < 64; ++t) {
+        if (t >= 16) {
+            V w15 = w[(t - 15) & 15];
+            V w2 = w[(t - 2) & 15];
+            V s0 = ROTR(w15, 7) ^ ROTR(w15, 18) ^ (w15 >> 3);
+            V s1 = ROTR(w2, 17) ^ ROTR(w2, 19) ^ (w2 >> 10);
+            w[t & 15] += s0 + w[(t - 7) & 15] + s1;
+        }
+        V s1 = ROTR(e, 6) ^ ROTR(e, 11) ^ ROTR(e, 25);
+        V ch = (e & f) ^ (~e & g);
+        V t1 = h + s1 + ch + SHA256_K[t] + w[t & 15];
+        V s0 = ROTR(a, 2) ^ ROTR(a, 13) ^ ROTR(a, 22);
+        V maj = (a & b) ^ (a & c) ^ (b & c);
+        V t2 = s0 + maj;
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+/// Hash up to N messages side by side, one per lane. A lane that runs out of
+/// blocks keeps hashing zeros; its digest was taken when its last block was done.
+template<typename V, size_t N>
+HASH_INLINE void sha256Lanes(const ByteSpan* inputs, Digest256* outputs, const uint32_t* order, size_t count) {
+    static const uint8_t zeros[64] = {};
+    Message messages[N];
+    for (size_t lane = 0; lane < count; ++lane) {
+        messages[lane].prepare(inputs[order[lane]], outputs[order[lane]].data());
+    }
+    V state[8];
+    for (int i = 0; i < 8; ++i) {
+        state[i] = V{} + SHA256_H0[i];
+    }
+    size_t rounds = 0;
+    for (size_t lane = 0; lane < count; ++lane) {
+        rounds = std::max(rounds, messages[lane].blocks);
+    }
+    for (size_t index = 0; index < rounds; ++index) {
+        const uint8_t* blocks[N];
+        for (size_t lane = 0; lane < N; ++lane) {
+            blocks[lane] = lane < count && index < messages[lane].blocks ? messages[lane].block(index) : zeros;
+        }
+        sha256CompressLanes<V, N>(state, blocks);
+        for (size_t lane = 0; lane < count; ++lane) {
+            if (messages[lane].blocks == index + 1) {
+                for (int i = 0; i < 8; ++i) {
+                    storeBigEndian32(messages[lane].out + 4 * i, state[i][lane]);
+                }
+            }
+        }
+    }
+}
+
+/// RIPEMD160 of N 32-byte inputs (SHA256 digests), one per lane
+template<typename V, size_t N>
+HASH_INLINE void ripemd160Lanes(const Digest256* inputs, Digest160* outputs, size_t count) {
+    // A 32-byte message fits in one block with fixed padding
+    uint8_t padded[N][64] = {};
+    const uint8_t* blocks[N];
+    for (size_t lane = 0; lane < N; ++lane) {
+        if (lane < count) {
+            std::memcpy(padded[lane], inputs[lane].data(), 32);
+        }
+        padded[lane][32] = 0x80;
+        padded[lane][56] = 0x00;
+        padded[lane][57] = 0x01; // 256 bits, little-endian
+        blocks[lane] = padded[lane];
+    }
+    V x[16];
+    loadWords<V, N, false>(x, blocks);
+    
+    V al = V{} + RIPEMD160_H0[0], bl = V{} + RIPEMD160_H0[1], cl = V{} + RIPEMD160_H0[2];
+    V dl = V{} + RIPEMD160_H0[3], el = V{} + RIPEMD160_H0[4];
+    V ar = al, br = bl, cr = cl, dr = dl, er = el;
+    for (int j = 0; j < 80; ++j) {
+        // The right line runs the boolean functions in reverse order
+        int round = j / 16;
+        V fl, fr;
+        switch (round) {
+            case 0: fl = bl ^ cl ^ dl; fr = br ^ (cr | ~dr); break;
+            case 1: fl = (bl & cl) | (~bl & dl); fr = (br & dr) | (cr & ~dr); break;
+            case 2: fl = (bl | ~cl) ^ dl; fr = (br | ~cr) ^ dr; break;
+            case 3: fl = (bl & dl) | (cl & ~dl); fr = (br & cr) | (~br & dr); break;
+            default: fl = bl ^ (cl | ~dl); fr = br ^ cr ^ dr; break;
+        }
+        V t = ROTL(al + fl + x[RIPEMD160_R[j]] + RIPEMD160_K[round], RIPEMD160_S[j]) + el;
+        al = el; el = dl; dl = ROTL(cl, 10); cl = bl; bl = t;
+        t = ROTL(ar + fr + x[RIPEMD160_RR[j]] + RIPEMD160_KR[round], RIPEMD160_SR[j]) + er;
+        ar = er; er = dr; dr = ROTL(cr, 10); cr = br; br = t;
+    }
+    V h[5] = {
+        RIPEMD160_H0[1] + cl + dr,
+        RIPEMD160_H0[2] + dl + er,
+        RIPEMD160_H0[3] + el + ar,
+        RIPEMD160_H0[4] + al + br,
+        RIPEMD160_H0[0] + bl + cr
+    };
+    for (size_t lane = 0; lane < count; ++lane) {
+        for (int i = 0; i < 5; ++i) {
+            storeLittleEndian32(outputs[lane].data() + 4 * i, h[i][lane]);
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+void sha256Avx2(const ByteSpan* inputs, Digest256* outputs, const uint32_t* order, size_t count) {
+    for (size_t i = 0; i < count; i += 8) {
+        sha256Lanes<U32x8, 8>(inputs, outputs, order + i, std::min<size_t>(8, count - i));
+    }
+}
+
+__attribute__((target("avx512f")))
+void sha256Avx512(const ByteSpan* inputs, Digest256* outputs, const uint32_t* order, size_t count) {
+    for (size_t i = 0; i < count; i += 16) {
+        sha256Lanes<U32x16, 16>(inputs, outputs, order + i, std::min<size_t>(16, count - i));
+    }
+}
+
+__attribute__((target("avx2")))
+void ripemd160Avx2(const Digest256* inputs, Digest160* outputs, size_t count) {
+    for (size_t i = 0; i < count; i += 8) {
+        ripemd160Lanes<U32x8, 8>(inputs + i, outputs + i, std::min<size_t>(8, count - i));
+    }
+}
+
+__attribute__((target("avx512f")))
+void ripemd160Avx512(const Digest256* inputs, Digest160* outputs, size_t count) {
+    for (size_t i = 0; i < count; i += 16) {
+        ripemd160Lanes<U32x16, 16>(inputs + i, outputs + i, std::min<size_t>(16, count - i));
+    }
+}
+
+/// Compress whole blocks with the SHA extensions
+__attribute__((target("sha,sse4.1")))
+void sha256CompressShaNi(uint32_t (&state)[8], const uint8_t* data, size_t blocks) {
+    const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    
+    // The instructions want the state as ABEF and CDGH
+    __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0])), 0xB1);
+    __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4])), 0x1B);
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+    
+    for (; blocks > 0; --blocks, data += 64) {
+        __m128i savedAbef = state0;
+        __m128i savedCdgh = state1;
+        __m128i w[4];
+        for (int i = 0; i < 16; ++i) {
+            __m128i& current = w[i & 3];
+            if (i < 4) {
+                current = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * i)), byteSwap);
+            } else {
+                // current holds w[i - 4]
+                __m128i next = _mm_sha256msg1_epu32(current, w[(i - 3) & 3]);
+                next = _mm_add_epi32(next, _mm_alignr_epi8(w[(i - 1) & 3], w[(i - 2) & 3], 4));
+                current = _mm_sha256msg2_epu32(next, w[(i - 1) & 3]);
+            }
+            __m128i message = _mm_add_epi32(current, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA256_K[4 * i])));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, message);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(message, 0x0E));
+        }
+        state0 = _mm_add_epi32(state0, savedAbef);
+        state1 = _mm_add_epi32(state1, savedCdgh);
+    }
+    
+    tmp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+}
+
+void sha256ShaNi(const ByteSpan* inputs, Digest256* outputs, size_t count) {
+    Message message;
+    for (size_t i = 0; i < count; ++i) {
+        message.prepare(inputs[i], outputs[i].data());
+        uint32_t state[8];
+        std::memcpy(state, SHA256_H0, sizeof(state));
+        sha256CompressShaNi(state, message.data, message.fullBlocks);
+        sha256CompressShaNi(state, message.tail, message.blocks - message.fullBlocks);
+        for (int j = 0; j < 8; ++j) {
+            storeBigEndian32(message.out + 4 * j, state[j]);
+        }
+    }
+}
+
+struct CpuFeatures {
+    bool shaNi = false;
+    bool avx2 = false;
+    bool avx512 = false;
+    
+    CpuFeatures() {
+        unsigned int eax, ebx, ecx, edx;
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+            return;
+        }
+        bool ssse3 = ecx & (1u << 9);
+        bool sse41 = ecx & (1u << 19);
+        bool osxsave = ecx & (1u << 27);
+        uint64_t xcr0 = 0;
+        if (osxsave) {
+            uint32_t low, high;
+            __asm__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+            xcr0 = (static_cast<uint64_t>(high) << 32) | low;
+        }
+        if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+            return;
+        }
+        shaNi = ssse3 && sse41 && (ebx & (1u << 29));
+        // The OS must save the YMM (and for AVX-512, opmask and ZMM) registers
+        avx2 = (ebx & (1u << 5)) && (xcr0 & 0x06) == 0x06;
+        avx512 = (ebx & (1u << 16)) && (xcr0 & 0xE6) == 0xE6;
+    }
+};
+
+const CpuFeatures& cpuFeatures() {
+    static const CpuFeatures features;
+    return features;
+}
+
+#endif // EPICCHAIN_HASH_X86
+
+/// Choose the kernel for a request, falling back to what the CPU offers
+HashUtils::HashKernel resolve(HashUtils::HashKernel kernel) {
+    if (kernel == HashUtils::HashKernel::Auto) {
+        return HashUtils::preferredKernel();
+    }
+    if (!HashUtils::isKernelSupported(kernel)) {
+        throw IllegalArgumentException("Hash kernel not supported on this CPU");
+    }
+    return kernel;
+}
+
+} // namespace
+
+bool HashUtils::isKernelSupported(HashKernel kernel) {
+    switch (kernel) {
+        case HashKernel::Auto:
+        case HashKernel::Scalar:
+            return true;
+#ifdef EPICCHAIN_HASH_X86
+        case HashKernel::ShaNi:
+            return cpuFeatures().shaNi;
+        case HashKernel::Avx2:
+            return cpuFeatures().avx2;
+        case HashKernel::Avx512:
+            return cpuFeatures().avx512;
+#endif
+        default:
+            return false;
+    }
+}
+
+HashUtils::HashKernel HashUtils::preferredKernel() {
+    // 16 lanes outrun the SHA extensions on a batch; 8 lanes do not
+    for (HashKernel kernel : {HashKernel::Avx512, HashKernel::ShaNi, HashKernel::Avx2}) {
+        if (isKernelSupported(kernel)) {
+            return kernel;
+        }
+    }
+    return HashKernel::Scalar;
+}
+
+void HashUtils::sha256Many(const ByteSpan* inputs, Digest256* outputs, size_t count, HashKernel kernel) {
+    kernel = resolve(kernel);
+    if (kernel == HashKernel::Scalar || count == 0) {
+        sha256Scalar(inputs, outputs, count);
+        return;
+    }
+#ifdef EPICCHAIN_HASH_X86
+    if (kernel == HashKernel::ShaNi) {
+        sha256ShaNi(inputs, outputs, count);
+        return;
+    }
+    // Lanes advance together, so group messages of similar length
+    std::vector<uint32_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    auto blocks = [inputs](uint32_t i) { return (inputs[i].size() + 9 + 63) / 64; };
+    auto [shortest, longest] = std::minmax_element(order.begin(), order.end(),
+        [&](uint32_t a, uint32_t b) { return blocks(a) < blocks(b); });
+    if (blocks(*shortest) != blocks(*longest)) {
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return blocks(a) < blocks(b); });
+    }
+    if (kernel == HashKernel::Avx512) {
+        sha256Avx512(inputs, outputs, order.data(), count);
+    } else {
+        sha256Avx2(inputs, outputs, order.data(), count);
+    }
+#endif
+}
+
+std::vector<Digest256> HashUtils::sha256Many(const std::vector<ByteSpan>& inputs) {
+    std::vector<Digest256> outputs(inputs.size());
+    sha256Many(inputs.data(), outputs.data(), inputs.size());
+    return outputs;
+}
+
+void HashUtils::hash160Many(const ByteSpan* inputs, Digest160* outputs, size_t count, HashKernel kernel) {
+    kernel = resolve(kernel);
+    std::vector<Digest256> digests(count);
+    sha256Many(inputs, digests.data(), count, kernel);
+#ifdef EPICCHAIN_HASH_X86
+    // There is no RIPEMD160 instruction; use the widest vector unit allowed
+    if (kernel == HashKernel::Avx512 || (kernel == HashKernel::ShaNi && cpuFeatures().avx512)) {
+        ripemd160Avx512(digests.data(), outputs, count);
+        return;
+    }
+    if (kernel == HashKernel::Avx2 || (kernel == HashKernel::ShaNi && cpuFeatures().avx2)) {
+        ripemd160Avx2(digests.data(), outputs, count);
+        return;
+    }
+#endif
+    ripemd160Scalar(digests.data(), outputs, count);
+}
+
+} // namespace epicchaincpp
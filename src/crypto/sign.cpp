@@ -35,27 +35,8 @@ SharedPtr<ECDSASignature> Sign::signHash(const Bytes& hash, const SharedPtr<ECPr
         throw IllegalArgumentException("Hash must be 32 bytes");
     }
     
-    EC_KEY* ecKey = nullptr;
-    try {
-        ecKey = privateKey->toOpenSSL();
-        unsigned int sigLen = ECDSA_size(ecKey);
-        Bytes sigBytes(sigLen);
-        
-        if (!ECDSA_sign(0, hash.data(), static_cast<int>(hash.size()), sigBytes.data(), &sigLen, ecKey)) {
-            throw CryptoException("Failed to sign hash");
-        }
-        
-        // Resize to actual signature length
-        sigBytes.resize(sigLen);
-        
-        // Convert DER signature to compact format
-        return std::make_shared<ECDSASignature>(ECDSASignature::fromDER(sigBytes));
-    } catch (...) {
-        if (ecKey) {
-            EC_KEY_free(ecKey);
-        }
-        throw;
-    }
+    // Reuses the OpenSSL key cached in the private key
+    return privateKey->signHash(hash);
 }
 
 Bytes Sign::signTransaction(const Bytes& txHash, const SharedPtr<ECPrivateKey>& privateKey) {
@@ -0,0 +1,147 @@
+#include "epicchaincpp/crypto/signature_batch_verifier.hpp"
+#include "epicchaincpp/crypto/ec_key_pair.hpp"
+#include "epicchaincpp/crypto/ecdsa_signature.hpp"
+#include "epicchaincpp/utils/thread_pool.hpp"
+#include <openssl/ec.h>
+#include <openssl/ecdsa.h>
+#include <openssl/bn.h>
+#include <openssl/obj_mac.h>
+#include <unordered_map>
+#include <string>
+
+namespace epicchaincpp {
+
+namespace {
+
+/// Per-thread OpenSSL state: parsed public keys, keyed by their encoding
+class VerifyContext {
+private:
+    /// Bound on cached keys per thread; the cache is dropped when full
+    static constexpr size_t MAX_KEYS = 4096;
+    
+    std::unordered_map<std::string, EC_KEY*> keys_;
+
+public:
+    VerifyContext() = default;
+    
+    ~VerifyContext() {
+        clear();
+    }
+    
+    VerifyContext(const VerifyContext&) = delete;
+    VerifyContext& operator=(const VerifyContext&) = delete;
+    
+    /// Get the OpenSSL key for an encoded public key, or nullptr if it is not a valid point
+    EC_KEY* key(const Bytes& encoded) {
+        std::string id(encoded.begin(), encoded.end());
+        auto it = keys_.find(id);
+        if (it != keys_.end()) {
+            return it->second;
+        }
+        
+        EC_KEY* eckey = EC_KEY_new_by_curve_name(NID_secp256k1);
+        if (!eckey) {
+            return nullptr;
+        }
+        const EC_GROUP* group = EC_KEY_get0_group(eckey);
+        EC_POINT* point = EC_POINT_new(group);
+        bool ok = point &&
+                  EC_POINT_oct2point(group, point, encoded.data(), encoded.size(), nullptr) == 1 &&
+                  EC_KEY_set_public_key(eckey, point) == 1;
+        EC_POINT_free(point);
+        if (!ok) {
+            EC_KEY_free(eckey);
+            return nullptr;
+        }
+        
+        if (keys_.size() >= MAX_KEYS) {
+            clear();
+        }
+        keys_.emplace(std::move(id), eckey);
+        return eckey;
+    }
+    
+    void clear() {
+        for (auto& entry : keys_) {
+            EC_KEY_free(entry.second);
+        }
+        keys_.clear();
+    }
+    
+    static VerifyContext& current() {
+        thread_local VerifyContext context;
+        return context;
+    }
+};
+
+} // namespace
+
+SignatureBatchVerifier::SignatureBatchVerifier()
+    : pool_(&ThreadPool::shared(), [](ThreadPool*) {}) {
+}
+
+SignatureBatchVerifier::SignatureBatchVerifier(const SharedPtr<ThreadPool>& pool)
+    : pool_(pool) {
+}
+
+size_t SignatureBatchVerifier::add(const Bytes& messageHash, const SharedPtr<ECDSASignature>& signature,
+                                   const SharedPtr<ECPublicKey>& publicKey) {
+    items_.push_back({messageHash, signature, publicKey});
+    return items_.size() - 1;
+}
+
+bool SignatureBatchVerifier::verifyHash(const Bytes& messageHash, const SharedPtr<ECDSASignature>& signature,
+                                        const SharedPtr<ECPublicKey>& publicKey) {
+    if (!signature || !publicKey || messageHash.size() != 32) {
+        return false;
+    }
+    
+    EC_KEY* eckey = VerifyContext::current().key(publicKey->getEncoded());
+    if (!eckey) {
+        return false;
+    }
+    
+    // r and s are read as two 32-byte halves
+    Bytes sigBytes = signature->getBytes();
+    if (sigBytes.size() != NeoConstants::SIGNATURE_SIZE) {
+        return false;
+    }
+    ECDSA_SIG* sig = ECDSA_SIG_new();
+    BIGNUM* r = BN_bin2bn(sigBytes.data(), 32, nullptr);
+    BIGNUM* s = BN_bin2bn(sigBytes.data() + 32, 32, nullptr);
+    if (!sig || !r || !s || ECDSA_SIG_set0(sig, r, s) != 1) {
+        BN_free(r);
+        BN_free(s);
+        ECDSA_SIG_free(sig);
+        return false;
+    }
+    
+    int valid = ECDSA_do_verify(messageHash.data(), static_cast<int>(messageHash.size()), sig, eckey);
+    ECDSA_SIG_free(sig);
+    return valid == 1;
+}
+
+SignatureBatchResult SignatureBatchVerifier::verify() const {
+    // std::vector<bool> packs bits, so workers write to a byte vector
+    std::vector<uint8_t> valid(items_.size(), 0);
+    pool_->parallelFor(items_.size(), [this, &valid](size_t i) {
+        const auto& item = items_[i];
+        try {
+            valid[i] = verifyHash(item.messageHash, item.signature, item.publicKey) ? 1 : 0;
+        } catch (const std::exception&) {
+            valid[i] = 0;
+        }
+    });
+    
+    SignatureBatchResult result;
+    result.valid.reserve(valid.size());
+    for (size_t i = 0; i < valid.size(); ++i) {
+        result.valid.push_back(valid[i] != 0);
+        if (!valid[i]) {
+            result.failed.push_back(i);
+        }
+    }
+    return result;
+}
+
+} // namespace epicchaincpp
@@ -23,13 +23,12 @@ std::string WIF::encode(const Bytes& privateKey) {
 }
 
 Bytes WIF::decode(const std::string& wif) {
-    Bytes decoded = Base58::decodeCheck(wif);
-    
-    if (decoded.empty() || decoded.size() != NeoConstants::PRIVATE_KEY_SIZE + 2 || decoded[0] != WIF_VERSION || decoded[NeoConstants::PRIVATE_KEY_SIZE + 1] != COMPRESSED_FLAG) {
+    uint8_t decoded[NeoConstants::PRIVATE_KEY_SIZE + 2];
+    if (!Base58::tryDecodeCheck(wif, decoded, sizeof(decoded)) || decoded[0] != WIF_VERSION || decoded[NeoConstants::PRIVATE_KEY_SIZE + 1] != COMPRESSED_FLAG) {
         throw CryptoException("Incorrect WIF format.");
     }
     
-    return Bytes(decoded.begin() + 1, decoded.begin() + 1 + NeoConstants::PRIVATE_KEY_SIZE);
+    return Bytes(decoded + 1, decoded + 1 + NeoConstants::PRIVATE_KEY_SIZE);
 }
 
 bool WIF::isValid(const std::string& wif) {
@@ -39,9 +38,8 @@ bool WIF::isValid(const std::string& wif) {
         return false;
     }
     
-    Bytes decoded = Base58::decodeCheck(wif);
-    return !decoded.empty() && 
-           decoded.size() == NeoConstants::PRIVATE_KEY_SIZE + 2 && 
+    uint8_t decoded[NeoConstants::PRIVATE_KEY_SIZE + 2];
+    return Base58::tryDecodeCheck(wif, decoded, sizeof(decoded)) && 
            decoded[0] == WIF_VERSION && 
            decoded[NeoConstants::PRIVATE_KEY_SIZE + 1] == COMPRESSED_FLAG;
 }
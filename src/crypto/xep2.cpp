@@ -3,10 +3,15 @@
 #include "epicchaincpp/crypto/hash.hpp"
 #include "epicchaincpp/utils/base58.hpp"
 #include "epicchaincpp/utils/address.hpp"
+#include "epicchaincpp/utils/thread_pool.hpp"
 #include "epicchaincpp/exceptions.hpp"
 #include <openssl/evp.h>
 #include <openssl/aes.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstring>
+#include <mutex>
 
 namespace epicchaincpp {
 
@@ -147,15 +152,11 @@ std::string XEP2::encrypt(const ECKeyPair& keyPair, const std::string& password,
 }
 
 Bytes XEP2::decrypt(const std::string& xep2, const std::string& password, const ScryptParams& params) {
-    if (!isValid(xep2)) {
+    Bytes encrypted(XEP2_ENCRYPTED_SIZE);
+    if (!tryDecode(xep2, encrypted.data())) {
         throw XEP2Exception("Invalid XEP-2 format");
     }
     
-    Bytes encrypted = Base58::decodeCheck(xep2);
-    if (encrypted.size() != XEP2_ENCRYPTED_SIZE) {
-        throw XEP2Exception("Invalid XEP-2 length");
-    }
-    
     // Extract components
     Bytes salt(encrypted.begin() + 3, encrypted.begin() + 7);
     Bytes encrypted1(encrypted.begin() + 7, encrypted.begin() + 23);
@@ -215,25 +216,104 @@ ECKeyPair XEP2::decryptToKeyPair(const std::string& xep2, const std::string& pas
     return ECKeyPair(privateKey);
 }
 
-bool XEP2::isValid(const std::string& xep2) {
-    if (xep2.length() != 58) {
-        return false;
-    }
-    
-    try {
-        Bytes decoded = Base58::decodeCheck(xep2);
-        if (decoded.empty()) {
-            return false;
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Run process(i) for every key on concurrency workers, each taking the next
+// unclaimed index, so at most concurrency derivations are ever in flight.
+// process returns the seconds spent and whether the key succeeded.
+template<typename Process>
+static void runBulk(size_t count, size_t concurrency, const XEP2BulkOptions& options, Process process) {
+    auto start = std::chrono::steady_clock::now();
+    std::atomic<size_t> next(0);
+    std::mutex progressMutex;
+    XEP2BulkProgress progress;
+    progress.total = count;
+    progress.concurrency = concurrency;
+    
+    auto worker = [&](size_t) {
+        for (size_t i = next++; i < count; i = next++) {
+            bool succeeded = process(i);
+            if (options.onProgress) {
+                std::lock_guard<std::mutex> lock(progressMutex);
+                progress.completed++;
+                progress.failed += succeeded ? 0 : 1;
+                progress.elapsedSeconds = secondsSince(start);
+                options.onProgress(progress);
+            }
         }
-        return decoded.size() == XEP2_ENCRYPTED_SIZE &&
-               decoded[0] == XEP2_PREFIX_1 &&
-               decoded[1] == XEP2_PREFIX_2 &&
-               decoded[2] == XEP2_FLAG;
-    } catch (...) {
-        return false;
+    };
+    
+    // The caller takes part in parallelFor, so a pool of concurrency - 1 workers suffices
+    ThreadPool& shared = ThreadPool::shared();
+    if (concurrency <= shared.size() + 1) {
+        shared.parallelFor(concurrency, worker);
+    } else {
+        ThreadPool pool(concurrency - 1);
+        pool.parallelFor(concurrency, worker);
     }
 }
 
+std::vector<XEP2DecryptResult> XEP2::decryptAll(const std::vector<std::string>& keys, const std::string& password,
+                                                const ScryptParams& params, const XEP2BulkOptions& options) {
+    std::vector<XEP2DecryptResult> results(keys.size());
+    runBulk(keys.size(), bulkConcurrency(keys.size(), params, options), options, [&](size_t i) {
+        auto start = std::chrono::steady_clock::now();
+        XEP2DecryptResult& result = results[i];
+        try {
+            result.privateKey = decrypt(keys[i], password, params);
+        } catch (const std::exception& e) {
+            result.error = e.what();
+        }
+        result.seconds = secondsSince(start);
+        return result.succeeded();
+    });
+    return results;
+}
+
+std::vector<XEP2EncryptResult> XEP2::encryptAll(const std::vector<Bytes>& privateKeys, const std::string& password,
+                                                const ScryptParams& params, const XEP2BulkOptions& options) {
+    std::vector<XEP2EncryptResult> results(privateKeys.size());
+    runBulk(privateKeys.size(), bulkConcurrency(privateKeys.size(), params, options), options, [&](size_t i) {
+        auto start = std::chrono::steady_clock::now();
+        XEP2EncryptResult& result = results[i];
+        try {
+            result.xep2 = encrypt(privateKeys[i], password, params);
+        } catch (const std::exception& e) {
+            result.error = e.what();
+        }
+        result.seconds = secondsSince(start);
+        return result.succeeded();
+    });
+    return results;
+}
+
+size_t XEP2::scryptMemory(const ScryptParams& params) {
+    // What EVP_PBE_scrypt allocates: the N + 2 block table plus p blocks, each 128 * r bytes
+    size_t block = 128 * static_cast<size_t>(params.getR());
+    return block * (static_cast<size_t>(params.getN()) + 2 + static_cast<size_t>(params.getP()));
+}
+
+size_t XEP2::bulkConcurrency(size_t count, const ScryptParams& params, const XEP2BulkOptions& options) {
+    size_t threads = options.threads != 0 ? options.threads : ThreadPool::hardwareConcurrency();
+    size_t byMemory = options.memoryLimit / std::max<size_t>(scryptMemory(params), 1);
+    return std::max<size_t>(1, std::min({threads, byMemory, count}));
+}
+
+bool XEP2::isValid(const std::string& xep2) {
+    uint8_t encrypted[XEP2_ENCRYPTED_SIZE];
+    return tryDecode(xep2, encrypted);
+}
+
+bool XEP2::tryDecode(const std::string& xep2, uint8_t* encrypted) {
+    return xep2.length() == 58 &&
+           Base58::tryDecodeCheck(xep2, encrypted, XEP2_ENCRYPTED_SIZE) &&
+           encrypted[0] == XEP2_PREFIX_1 &&
+           encrypted[1] == XEP2_PREFIX_2 &&
+           encrypted[2] == XEP2_FLAG;
+}
+
 std::string XEP2::getAddress(const std::string& xep2) {
     if (!isValid(xep2)) {
         throw XEP2Exception("Invalid XEP-2 format");
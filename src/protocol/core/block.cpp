@@ -0,0 +1,132 @@
+#include "epicchaincpp/protocol/core/block.hpp"
+#include "epicchaincpp/transaction/transaction.hpp"
+#include "epicchaincpp/transaction/witness.hpp"
+#include "epicchaincpp/serialization/binary_writer.hpp"
+#include "epicchaincpp/serialization/binary_reader.hpp"
+#include "epicchaincpp/crypto/hash.hpp"
+#include "epicchaincpp/utils/base64.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <algorithm>
+
+namespace epicchaincpp {
+
+// Header
+
+Header::Header()
+    : version_(0), timestamp_(0), nonce_(0), index_(0), primaryIndex_(0),
+      hashCalculated_(false) {
+}
+
+const Hash256& Header::getHash() const {
+    if (!hashCalculated_) {
+        FixedBinaryWriter<UNSIGNED_SIZE> writer;
+        serializeUnsigned(writer);
+        ByteSpan data = writer.view();
+        // The digest is a little-endian UInt256; Hash256 stores big-endian
+        Digest256 hash;
+        HashUtils::sha256(data.data(), data.size(), hash);
+        std::reverse(hash.begin(), hash.end());
+        hash_ = Hash256(hash);
+        hashCalculated_ = true;
+    }
+    return hash_;
+}
+
+size_t Header::getSize() const {
+    // Unsigned part + witness count (always 1) + witness
+    return UNSIGNED_SIZE + 1 + (witness_ ? witness_->getSize() : 0);
+}
+
+void Header::serializeUnsigned(BinaryWriter& writer) const {
+    writer.writeUInt32(version_);
+    previousHash_.serialize(writer);
+    merkleRoot_.serialize(writer);
+    writer.writeUInt64(timestamp_);
+    writer.writeUInt64(nonce_);
+    writer.writeUInt32(index_);
+    writer.writeUInt8(primaryIndex_);
+    nextConsensus_.serialize(writer);
+}
+
+void Header::serialize(BinaryWriter& writer) const {
+    serializeUnsigned(writer);
+    if (!witness_) {
+        throw SerializationException("Block header has no witness");
+    }
+    writer.writeVarInt(1);
+    witness_->serialize(writer);
+}
+
+SharedPtr<Header> Header::deserialize(BinaryReader& reader) {
+    auto header = std::make_shared<Header>();
+    
+    header->version_ = reader.readUInt32();
+    if (header->version_ > 0) {
+        throw DeserializationException("Unsupported block version: " + std::to_string(header->version_));
+    }
+    header->previousHash_ = Hash256::deserialize(reader);
+    header->merkleRoot_ = Hash256::deserialize(reader);
+    header->timestamp_ = reader.readUInt64();
+    header->nonce_ = reader.readUInt64();
+    header->index_ = reader.readUInt32();
+    header->primaryIndex_ = reader.readUInt8();
+    header->nextConsensus_ = Hash160::deserialize(reader);
+    
+    // A header carries exactly one witness
+    if (reader.readVarInt() != 1) {
+        throw DeserializationException("Block header must have exactly one witness");
+    }
+    header->witness_ = Witness::deserialize(reader);
+    
+    return header;
+}
+
+// Block
+
+Block::Block()
+    : header_(std::make_shared<Header>()) {
+}
+
+size_t Block::getSize() const {
+    size_t size = header_->getSize() + BinaryWriter::getVarSize(transactions_.size());
+    for (const auto& transaction : transactions_) {
+        size += transaction->getSize();
+    }
+    return size;
+}
+
+void Block::serialize(BinaryWriter& writer) const {
+    header_->serialize(writer);
+    writer.writeVarInt(transactions_.size());
+    for (const auto& transaction : transactions_) {
+        transaction->serialize(writer);
+    }
+}
+
+SharedPtr<Block> Block::deserialize(BinaryReader& reader) {
+    auto block = std::make_shared<Block>();
+    block->header_ = Header::deserialize(reader);
+    
+    uint64_t count = reader.readVarInt();
+    if (count > MAX_TRANSACTIONS_PER_BLOCK) {
+        throw DeserializationException("Too many transactions in block: " + std::to_string(count));
+    }
+    block->transactions_.reserve(static_cast<size_t>(count));
+    for (uint64_t i = 0; i < count; ++i) {
+        block->transactions_.push_back(Transaction::deserialize(reader));
+    }
+    
+    return block;
+}
+
+SharedPtr<Block> Block::fromBase64(const std::string& base64) {
+    Bytes data = Base64::decode(base64);
+    BinaryReader reader(data);
+    auto block = deserialize(reader);
+    if (reader.hasMore()) {
+        throw DeserializationException("Unexpected trailing data after block");
+    }
+    return block;
+}
+
+} // namespace epicchaincpp
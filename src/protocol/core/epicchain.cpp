@@ -1,5 +1,5 @@
 #include "epicchaincpp/protocol/core/neo.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
 #include "epicchaincpp/protocol/http_service.hpp"
 #include "epicchaincpp/protocol/response_types.hpp"
 #include "epicchaincpp/protocol/core/polling/block_polling.hpp"
@@ -16,7 +16,7 @@ Neo::Neo(const std::string& rpcUrl) : rpcUrl_(rpcUrl) {
 
 void Neo::initialize() {
     httpService_ = std::make_shared<HttpService>(rpcUrl_);
-    rpcClient_ = std::make_shared<NeoRpcClient>(rpcUrl_);
+    rpcClient_ = std::make_shared<EpicChainRpcClient>(rpcUrl_);
 }
 
 void Neo::subscribeToBlocks(std::function<void(uint32_t)> callback) {
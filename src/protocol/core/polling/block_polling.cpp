@@ -1,10 +1,32 @@
 #include "epicchaincpp/protocol/core/polling/block_polling.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <algorithm>
+#include <future>
 
 namespace epicchaincpp {
 
-BlockPolling::BlockPolling(const SharedPtr<NeoRpcClient>& rpcClient, std::chrono::milliseconds pollInterval)
-    : rpcClient_(rpcClient), running_(false), lastBlockIndex_(0), pollInterval_(pollInterval) {
+BlockPolling::BlockPolling(const SharedPtr<EpicChainRpcClient>& rpcClient, std::chrono::milliseconds pollInterval)
+    : BlockPolling(rpcClient, [pollInterval]() {
+          BlockPollingConfig config;
+          config.maxPollInterval = pollInterval;
+          config.minPollInterval = std::min(config.minPollInterval, pollInterval);
+          return config;
+      }()) {
+}
+
+BlockPolling::BlockPolling(const SharedPtr<EpicChainRpcClient>& rpcClient, const BlockPollingConfig& config)
+    : rpcClient_(rpcClient), config_(config), nextSubscriptionId_(0),
+      running_(false), lastBlockIndex_(0), hasDelivered_(false),
+      hasNextIndex_(false), nextIndex_(0), firstIndex_(0),
+      hasSeenHeight_(false), arrivalObserved_(false), seenHeight_(0) {
+    if (config_.queueCapacity == 0) {
+        throw IllegalArgumentException("Block queue capacity must be positive");
+    }
+    if (config_.minPollInterval > config_.maxPollInterval) {
+        throw IllegalArgumentException("Minimum poll interval exceeds the maximum");
+    }
+    metrics_.estimatedBlockTime = config_.expectedBlockTime;
 }
 
 BlockPolling::~BlockPolling() {
@@ -16,56 +38,282 @@ void BlockPolling::start() {
         return;
     }
     
-    running_ = true;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        running_ = true;
+    }
+    dispatchThread_ = std::make_unique<std::thread>(&BlockPolling::dispatchLoop, this);
     pollingThread_ = std::make_unique<std::thread>(&BlockPolling::pollLoop, this);
 }
 
+void BlockPolling::start(uint32_t startIndex) {
+    if (running_) {
+        return;
+    }
+    
+    nextIndex_ = startIndex;
+    firstIndex_ = startIndex;
+    hasNextIndex_ = true;
+    hasDelivered_ = false;
+    start();
+}
+
 void BlockPolling::stop() {
     if (!running_) {
         return;
     }
     
-    running_ = false;
+    {
+        // Flip the flag under the lock so no waiter misses the wake-up
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        running_ = false;
+    }
+    queueNotEmpty_.notify_all();
+    queueNotFull_.notify_all();
+    wakeUp_.notify_all();
+    
     if (pollingThread_ && pollingThread_->joinable()) {
         pollingThread_->join();
     }
+    if (dispatchThread_ && dispatchThread_->joinable()) {
+        dispatchThread_->join();
+    }
+    
+    // Resume after the last delivered block, so dropped blocks are fetched again
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    queue_.clear();
+    if (hasDelivered_) {
+        nextIndex_ = lastBlockIndex_ + 1;
+        firstIndex_ = nextIndex_;
+    } else {
+        nextIndex_ = firstIndex_;
+    }
+}
+
+size_t BlockPolling::subscribe(IndexCallback callback) {
+    return subscribeBlocks([callback = std::move(callback)](const BlockEvent& event) {
+        callback(event.index);
+    });
 }
 
-void BlockPolling::subscribe(std::function<void(uint32_t)> callback) {
-    callbacks_.push_back(callback);
+size_t BlockPolling::subscribeBlocks(BlockCallback callback) {
+    std::lock_guard<std::mutex> lock(subscribersMutex_);
+    size_t id = nextSubscriptionId_++;
+    subscribers_.emplace_back(id, std::move(callback));
+    return id;
+}
+
+void BlockPolling::unsubscribe(size_t subscriptionId) {
+    std::lock_guard<std::mutex> lock(subscribersMutex_);
+    subscribers_.erase(std::remove_if(subscribers_.begin(), subscribers_.end(),
+                                      [subscriptionId](const auto& entry) { return entry.first == subscriptionId; }),
+                       subscribers_.end());
 }
 
 void BlockPolling::clearSubscriptions() {
-    callbacks_.clear();
+    std::lock_guard<std::mutex> lock(subscribersMutex_);
+    subscribers_.clear();
+}
+
+void BlockPolling::setPollInterval(std::chrono::milliseconds interval) {
+    if (interval.count() <= 0) {
+        throw IllegalArgumentException("Poll interval must be positive");
+    }
+    // Keep minPollInterval <= maxPollInterval, which nextPollDelay() clamps between.
+    // The poller reads both under queueMutex_.
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    config_.maxPollInterval = interval;
+    config_.minPollInterval = std::min(config_.minPollInterval, interval);
+}
+
+BlockPollingMetrics BlockPolling::getMetrics() const {
+    BlockPollingMetrics metrics;
+    {
+        std::lock_guard<std::mutex> lock(metricsMutex_);
+        metrics = metrics_;
+    }
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        metrics.queueDepth = queue_.size();
+    }
+    metrics.lagBlocks = metrics.chainHeight > metrics.deliveredHeight
+        ? metrics.chainHeight - metrics.deliveredHeight : 0;
+    return metrics;
 }
 
 void BlockPolling::pollLoop() {
     while (running_) {
+        bool behind = false;
         try {
-            auto blockCount = rpcClient_->getBlockCount();
-            if (blockCount > 0) {
-                uint32_t currentBlock = blockCount - 1;
-                if (currentBlock > lastBlockIndex_) {
-                    lastBlockIndex_ = currentBlock;
-                    notifySubscribers(currentBlock);
+            behind = pollOnce();
+        } catch (...) {
+            // Keep polling; the failed height is fetched again next time
+            std::lock_guard<std::mutex> lock(metricsMutex_);
+            ++metrics_.errors;
+        }
+        
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        auto delay = behind ? config_.minPollInterval : nextPollDelay();
+        wakeUp_.wait_for(lock, delay, [this]() { return !running_; });
+    }
+}
+
+bool BlockPolling::pollOnce() {
+    uint32_t blockCount = rpcClient_->getBlockCount();
+    auto now = std::chrono::steady_clock::now();
+    if (blockCount == 0) {
+        return false;
+    }
+    
+    uint32_t tip = blockCount - 1;
+    recordTip(tip, now);
+    
+    if (!hasNextIndex_) {
+        // Without a start index, delivery begins at the current tip
+        nextIndex_ = tip;
+        firstIndex_ = tip;
+        hasNextIndex_ = true;
+    }
+    
+    while (running_ && nextIndex_ <= tip) {
+        {
+            // Backpressure: wait for the subscribers rather than fetching further ahead,
+            // still polling the tip so the chain height and lag stay current
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            while (!queueNotFull_.wait_for(lock, config_.maxPollInterval, [this]() {
+                return !running_ || queue_.size() < config_.queueCapacity;
+            })) {
+                lock.unlock();
+                uint32_t count = rpcClient_->getBlockCount();
+                if (count > 0) {
+                    recordTip(count - 1, std::chrono::steady_clock::now());
+                    tip = std::max(tip, count - 1);
                 }
+                lock.lock();
             }
-        } catch (...) {
-            // Ignore errors and continue polling
+            if (!running_) {
+                return false;
+            }
+        }
+        
+        BlockEvent event = fetchEvent(nextIndex_, now);
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            queue_.push_back(std::move(event));
+        }
+        queueNotEmpty_.notify_one();
+        ++nextIndex_;
+    }
+    return nextIndex_ <= tip;
+}
+
+BlockEvent BlockPolling::fetchEvent(uint32_t index, std::chrono::steady_clock::time_point observedAt) {
+    BlockEvent event;
+    event.index = index;
+    event.observedAt = observedAt;
+    
+    if (config_.fetchBlocks || config_.fetchApplicationLogs) {
+        event.block = rpcClient_->sendRequest("getblock", nlohmann::json::array({index, true}));
+    }
+    
+    if (config_.fetchApplicationLogs) {
+        // Request all logs of the block at once, then collect them in order
+        std::vector<std::future<nlohmann::json>> logs;
+        logs.push_back(rpcClient_->sendRequestAsync("getapplicationlog", nlohmann::json::array({event.block["hash"]})));
+        if (event.block.contains("tx")) {
+            for (const auto& tx : event.block["tx"]) {
+                logs.push_back(rpcClient_->sendRequestAsync("getapplicationlog", nlohmann::json::array({tx["hash"]})));
+            }
+        }
+        event.applicationLogs.reserve(logs.size());
+        for (auto& log : logs) {
+            event.applicationLogs.push_back(log.get());
+        }
+    }
+    return event;
+}
+
+void BlockPolling::recordTip(uint32_t tip, std::chrono::steady_clock::time_point now) {
+    std::lock_guard<std::mutex> lock(metricsMutex_);
+    ++metrics_.polls;
+    metrics_.chainHeight = tip;
+    
+    if (!hasSeenHeight_) {
+        hasSeenHeight_ = true;
+        seenHeight_ = tip;
+        lastBlockSeenAt_ = now;
+        return;
+    }
+    if (tip <= seenHeight_) {
+        return;
+    }
+    
+    // The first arrival only anchors the clock: the block before it was seen
+    // at an arbitrary point of its interval
+    if (arrivalObserved_) {
+        auto sample = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastBlockSeenAt_) /
+                      (tip - seenHeight_);
+        metrics_.estimatedBlockTime = (metrics_.estimatedBlockTime * 3 + sample) / 4;
+    }
+    arrivalObserved_ = true;
+    seenHeight_ = tip;
+    lastBlockSeenAt_ = now;
+}
+
+std::chrono::milliseconds BlockPolling::nextPollDelay() const {
+    std::lock_guard<std::mutex> lock(metricsMutex_);
+    if (!hasSeenHeight_) {
+        return config_.minPollInterval;
+    }
+    
+    // Sleep until the next block is due, then poll at the minimum interval
+    auto sinceLastBlock = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - lastBlockSeenAt_);
+    auto untilDue = metrics_.estimatedBlockTime - sinceLastBlock;
+    return std::clamp(untilDue, config_.minPollInterval, config_.maxPollInterval);
+}
+
+void BlockPolling::dispatchLoop() {
+    for (;;) {
+        BlockEvent event;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            queueNotEmpty_.wait(lock, [this]() { return !running_ || !queue_.empty(); });
+            if (!running_) {
+                return;
+            }
+            event = std::move(queue_.front());
+            queue_.pop_front();
         }
+        queueNotFull_.notify_one();
+        
+        notifySubscribers(event);
         
-        std::this_thread::sleep_for(pollInterval_);
+        lastBlockIndex_ = event.index;
+        hasDelivered_ = true;
+        std::lock_guard<std::mutex> lock(metricsMutex_);
+        metrics_.deliveredHeight = event.index;
+        ++metrics_.delivered;
+        metrics_.lastDeliveryLatency = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - event.observedAt);
     }
 }
 
-void BlockPolling::notifySubscribers(uint32_t blockIndex) {
-    for (const auto& callback : callbacks_) {
+void BlockPolling::notifySubscribers(const BlockEvent& event) {
+    // Call a snapshot, so callbacks may subscribe or unsubscribe
+    std::vector<std::pair<size_t, BlockCallback>> subscribers;
+    {
+        std::lock_guard<std::mutex> lock(subscribersMutex_);
+        subscribers = subscribers_;
+    }
+    
+    for (const auto& subscriber : subscribers) {
         try {
-            callback(blockIndex);
+            subscriber.second(event);
         } catch (...) {
             // Ignore callback errors
         }
     }
 }
 
-} // namespace epicchaincpp
\ No newline at end of file
+} // namespace epicchaincpp
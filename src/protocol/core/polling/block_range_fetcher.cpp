@@ -0,0 +1,182 @@
+#include "epicchaincpp/protocol/core/polling/block_range_fetcher.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
+#include "epicchaincpp/protocol/response_types_impl.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <algorithm>
+
+namespace epicchaincpp {
+
+BlockRangeFetcher::BlockRangeFetcher(const SharedPtr<EpicChainRpcClient>& rpcClient, const BlockRangeFetcherConfig& config)
+    : rpcClient_(rpcClient), config_(config), nextToFetch_(0), nextToDeliver_(0), end_(0),
+      cancelled_(false), blocks_(0), bytes_(0), retries_(0) {
+    if (!rpcClient_) {
+        throw IllegalArgumentException("RPC client cannot be null");
+    }
+    if (config_.workers == 0 || config_.reorderBufferSize == 0 || config_.maxAttempts == 0) {
+        throw IllegalArgumentException("Workers, reorder buffer size and attempts must be positive");
+    }
+}
+
+void BlockRangeFetcher::fetch(uint32_t start, uint32_t end, const BlockCallback& consumer) {
+    if (start > end) {
+        throw IllegalArgumentException("Block range start must not exceed its end");
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffer_.clear();
+        nextToFetch_ = start;
+        nextToDeliver_ = start;
+        end_ = end;
+        error_ = nullptr;
+    }
+    cancelled_ = false;
+    blocks_ = 0;
+    bytes_ = 0;
+    retries_ = 0;
+    startTime_ = std::chrono::steady_clock::now();
+    
+    size_t workerCount = std::min<size_t>(config_.workers, end - start);
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers.emplace_back(&BlockRangeFetcher::workerLoop, this);
+    }
+    
+    try {
+        while (true) {
+            SharedPtr<EpicChainGetBlockResponse> block;
+            uint32_t index;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                blockReady_.wait(lock, [this] {
+                    return cancelled_ || error_ || nextToDeliver_ >= end_ ||
+                           buffer_.count(nextToDeliver_) > 0;
+                });
+                if (cancelled_ || error_ || nextToDeliver_ >= end_) {
+                    break;
+                }
+                index = nextToDeliver_;
+                auto it = buffer_.find(index);
+                block = std::move(it->second);
+                buffer_.erase(it);
+            }
+            
+            consumer(index, block);
+            blocks_++;
+            bytes_ += static_cast<uint64_t>(std::max(block->getSize(), 0));
+            
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                nextToDeliver_++;
+            }
+            // The reorder window moved; a waiting worker may claim the next height
+            workAvailable_.notify_all();
+        }
+    } catch (...) {
+        fail(std::current_exception());
+    }
+    
+    // Workers exit on their own once the range is claimed, cancelled or failed
+    workAvailable_.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        error = error_;
+        buffer_.clear();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void BlockRangeFetcher::cancel() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cancelled_ = true;
+    }
+    workAvailable_.notify_all();
+    blockReady_.notify_all();
+}
+
+BlockRangeMetrics BlockRangeFetcher::getMetrics() const {
+    BlockRangeMetrics metrics;
+    metrics.blocks = blocks_.load();
+    metrics.bytes = bytes_.load();
+    metrics.retries = retries_.load();
+    metrics.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime_).count();
+    return metrics;
+}
+
+void BlockRangeFetcher::workerLoop() {
+    while (true) {
+        uint32_t index;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            // Only claim heights inside the reorder window so the buffer stays bounded
+            workAvailable_.wait(lock, [this] {
+                return cancelled_ || error_ || nextToFetch_ >= end_ ||
+                       nextToFetch_ - nextToDeliver_ < config_.reorderBufferSize;
+            });
+            if (cancelled_ || error_ || nextToFetch_ >= end_) {
+                return;
+            }
+            index = nextToFetch_++;
+        }
+        
+        SharedPtr<EpicChainGetBlockResponse> block;
+        try {
+            block = fetchWithRetry(index);
+        } catch (...) {
+            fail(std::current_exception());
+            return;
+        }
+        if (!block) {
+            return; // cancelled while backing off
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            buffer_.emplace(index, std::move(block));
+        }
+        blockReady_.notify_one();
+    }
+}
+
+SharedPtr<EpicChainGetBlockResponse> BlockRangeFetcher::fetchWithRetry(uint32_t index) {
+    auto backoff = config_.initialBackoff;
+    for (uint32_t attempt = 1; ; ++attempt) {
+        try {
+            return rpcClient_->getBlock(index, config_.verbose);
+        } catch (...) {
+            if (attempt >= config_.maxAttempts) {
+                throw;
+            }
+        }
+        retries_++;
+        
+        // Back off, waking early if the fetch is cancelled or failed elsewhere
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (workAvailable_.wait_for(lock, backoff, [this] { return cancelled_ || error_; })) {
+            return nullptr;
+        }
+        backoff = std::min(backoff * 2, config_.maxBackoff);
+    }
+}
+
+void BlockRangeFetcher::fail(std::exception_ptr error) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!error_) {
+            error_ = error;
+        }
+    }
+    workAvailable_.notify_all();
+    blockReady_.notify_all();
+}
+
+} // namespace epicchaincpp
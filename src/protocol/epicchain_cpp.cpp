@@ -1,5 +1,5 @@
 #include "epicchaincpp/protocol/neo_cpp.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
 #include "epicchaincpp/protocol/http_service.hpp"
 #include "epicchaincpp/transaction/transaction.hpp"
 #include "epicchaincpp/exceptions.hpp"
@@ -12,7 +12,7 @@ EpicChainCpp::EpicChainCpp(const EpicChainCppConfig& config, SharedPtr<HttpServi
         throw IllegalArgumentException("HTTP service cannot be null");
     }
     // Extract base URL from HTTP service if needed
-    rpcClient_ = std::make_shared<NeoRpcClient>(httpService->getUrl());
+    rpcClient_ = std::make_shared<EpicChainRpcClient>(httpService->getUrl());
 }
 
 EpicChainCpp::EpicChainCpp(const std::string& url)
@@ -21,7 +21,7 @@ EpicChainCpp::EpicChainCpp(const std::string& url)
         throw IllegalArgumentException("URL cannot be empty");
     }
     httpService_ = std::make_shared<HttpService>(url);
-    rpcClient_ = std::make_shared<NeoRpcClient>(url);
+    rpcClient_ = std::make_shared<EpicChainRpcClient>(url);
 }
 
 SharedPtr<epicchaincpp> EpicChainCpp::build(SharedPtr<HttpService> httpService, const EpicChainCppConfig& config) {
@@ -43,19 +43,19 @@ Hash256 EpicChainCpp::getBestBlockHash() {
     return rpcClient_->getBestBlockHash();
 }
 
-SharedPtr<NeoGetBlockResponse> EpicChainCpp::getBlock(const Hash256& hash, bool verbose) {
+SharedPtr<EpicChainGetBlockResponse> EpicChainCpp::getBlock(const Hash256& hash, bool verbose) {
     return rpcClient_->getBlock(hash, verbose);
 }
 
-SharedPtr<NeoGetBlockResponse> EpicChainCpp::getBlock(uint32_t index, bool verbose) {
+SharedPtr<EpicChainGetBlockResponse> EpicChainCpp::getBlock(uint32_t index, bool verbose) {
     return rpcClient_->getBlock(index, verbose);
 }
 
-SharedPtr<NeoGetRawTransactionResponse> EpicChainCpp::getTransaction(const Hash256& txId, bool verbose) {
+SharedPtr<EpicChainGetRawTransactionResponse> EpicChainCpp::getTransaction(const Hash256& txId, bool verbose) {
     return rpcClient_->getRawTransaction(txId, verbose);
 }
 
-SharedPtr<NeoGetContractStateResponse> EpicChainCpp::getContractState(const Hash160& scriptHash) {
+SharedPtr<EpicChainGetContractStateResponse> EpicChainCpp::getContractState(const Hash160& scriptHash) {
     return rpcClient_->getContractState(scriptHash);
 }
 
@@ -63,7 +63,7 @@ SharedPtr<NeoGetNep17BalancesResponse> EpicChainCpp::getNep17Balances(const std:
     return rpcClient_->getNep17Balances(address);
 }
 
-SharedPtr<NeoInvokeResultResponse> EpicChainCpp::invokeFunction(const Hash160& scriptHash,
+SharedPtr<EpicChainInvokeResultResponse> EpicChainCpp::invokeFunction(const Hash160& scriptHash,
                                                           const std::string& method,
                                                           const nlohmann::json& params,
                                                           const nlohmann::json& signers) {
@@ -78,7 +78,7 @@ nlohmann::json EpicChainCpp::validateAddress(const std::string& address) {
     return rpcClient_->validateAddress(address);
 }
 
-SharedPtr<NeoGetVersionResponse> EpicChainCpp::getVersion() {
+SharedPtr<EpicChainGetVersionResponse> EpicChainCpp::getVersion() {
     return rpcClient_->getVersion();
 }
 
@@ -1,5 +1,6 @@
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
 #include "epicchaincpp/protocol/http_service.hpp"
+#include "epicchaincpp/protocol/rpc_batcher.hpp"
 #include "epicchaincpp/protocol/response_types_impl.hpp"
 #include "epicchaincpp/transaction/transaction.hpp"
 #include "epicchaincpp/transaction/signer.hpp"
@@ -10,10 +11,11 @@
 #include "epicchaincpp/exceptions.hpp"
 #include "epicchaincpp/logger.hpp"
 #include <sstream>
+#include <future>
 
 namespace epicchaincpp {
 
-NeoRpcClient::NeoRpcClient(const std::string& url) 
+EpicChainRpcClient::EpicChainRpcClient(const std::string& url) 
     : url_(url), requestId_(1) {
     httpService_ = std::make_shared<HttpService>(url);
 }
@@ -42,99 +44,99 @@ static nlohmann::json handleResponse(const nlohmann::json& response) {
     return response["result"];
 }
 
-SharedPtr<NeoGetVersionResponse> NeoRpcClient::getVersion() {
+SharedPtr<EpicChainGetVersionResponse> EpicChainRpcClient::getVersion() {
     auto request = createRequest("getversion", nlohmann::json::array(), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
-    auto versionResponse = std::make_shared<NeoGetVersionResponse>();
+    auto versionResponse = std::make_shared<EpicChainGetVersionResponse>();
     versionResponse->parseJson(result);
     return versionResponse;
 }
 
-int NeoRpcClient::getConnectionCount() {
+int EpicChainRpcClient::getConnectionCount() {
     auto request = createRequest("getconnectioncount", nlohmann::json::array(), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     return result.get<int>();
 }
 
-SharedPtr<NeoGetPeersResponse> NeoRpcClient::getPeers() {
+SharedPtr<EpicChainGetPeersResponse> EpicChainRpcClient::getPeers() {
     auto request = createRequest("getpeers", nlohmann::json::array(), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
-    auto peersResponse = std::make_shared<NeoGetPeersResponse>();
+    auto peersResponse = std::make_shared<EpicChainGetPeersResponse>();
     peersResponse->parseJson(result);
     return peersResponse;
 }
 
-nlohmann::json NeoRpcClient::validateAddress(const std::string& address) {
+nlohmann::json EpicChainRpcClient::validateAddress(const std::string& address) {
     auto request = createRequest("validateaddress", nlohmann::json::array({address}), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     return handleResponse(response);
 }
 
-Hash256 NeoRpcClient::getBestBlockHash() {
+Hash256 EpicChainRpcClient::getBestBlockHash() {
     auto request = createRequest("getbestblockhash", nlohmann::json::array(), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     return Hash256::fromHexString(result.get<std::string>());
 }
 
-SharedPtr<NeoGetBlockResponse> NeoRpcClient::getBlock(const Hash256& hash, bool verbose) {
+SharedPtr<EpicChainGetBlockResponse> EpicChainRpcClient::getBlock(const Hash256& hash, bool verbose) {
     auto params = nlohmann::json::array({hash.toString(), verbose});
     auto request = createRequest("getblock", params, requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
-    auto blockResponse = std::make_shared<NeoGetBlockResponse>();
+    auto blockResponse = std::make_shared<EpicChainGetBlockResponse>();
     blockResponse->parseJson(result);
     return blockResponse;
 }
 
-SharedPtr<NeoGetBlockResponse> NeoRpcClient::getBlock(uint32_t index, bool verbose) {
+SharedPtr<EpicChainGetBlockResponse> EpicChainRpcClient::getBlock(uint32_t index, bool verbose) {
     auto params = nlohmann::json::array({index, verbose});
     auto request = createRequest("getblock", params, requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
-    auto blockResponse = std::make_shared<NeoGetBlockResponse>();
+    auto blockResponse = std::make_shared<EpicChainGetBlockResponse>();
     blockResponse->parseJson(result);
     return blockResponse;
 }
 
-uint32_t NeoRpcClient::getBlockCount() {
+uint32_t EpicChainRpcClient::getBlockCount() {
     auto request = createRequest("getblockcount", nlohmann::json::array(), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     return result.get<uint32_t>();
 }
 
-Hash256 NeoRpcClient::getBlockHash(uint32_t index) {
+Hash256 EpicChainRpcClient::getBlockHash(uint32_t index) {
     auto request = createRequest("getblockhash", nlohmann::json::array({index}), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     return Hash256::fromHexString(result.get<std::string>());
 }
 
-nlohmann::json NeoRpcClient::getBlockHeader(const Hash256& hash, bool verbose) {
+nlohmann::json EpicChainRpcClient::getBlockHeader(const Hash256& hash, bool verbose) {
     auto params = nlohmann::json::array({hash.toString(), verbose});
     auto request = createRequest("getblockheader", params, requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     return handleResponse(response);
 }
 
-nlohmann::json NeoRpcClient::getBlockHeader(uint32_t index, bool verbose) {
+nlohmann::json EpicChainRpcClient::getBlockHeader(uint32_t index, bool verbose) {
     auto params = nlohmann::json::array({index, verbose});
     auto request = createRequest("getblockheader", params, requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     return handleResponse(response);
 }
 
-std::vector<std::string> NeoRpcClient::getCommittee() {
+std::vector<std::string> EpicChainRpcClient::getCommittee() {
     auto request = createRequest("getcommittee", nlohmann::json::array(), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
     std::vector<std::string> committee;
@@ -144,20 +146,20 @@ std::vector<std::string> NeoRpcClient::getCommittee() {
     return committee;
 }
 
-SharedPtr<NeoGetContractStateResponse> NeoRpcClient::getContractState(const Hash160& hash) {
+SharedPtr<EpicChainGetContractStateResponse> EpicChainRpcClient::getContractState(const Hash160& hash) {
     auto request = createRequest("getcontractstate", nlohmann::json::array({hash.toString()}), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
-    auto contractResponse = std::make_shared<NeoGetContractStateResponse>();
+    auto contractResponse = std::make_shared<EpicChainGetContractStateResponse>();
     contractResponse->parseJson(result);
     return contractResponse;
 }
 
 
-std::vector<nlohmann::json> NeoRpcClient::getNextBlockValidators() {
+std::vector<nlohmann::json> EpicChainRpcClient::getNextBlockValidators() {
     auto request = createRequest("getnextblockvalidators", nlohmann::json::array(), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
     std::vector<nlohmann::json> validators;
@@ -167,60 +169,60 @@ std::vector<nlohmann::json> NeoRpcClient::getNextBlockValidators() {
     return validators;
 }
 
-SharedPtr<NeoGetRawTransactionResponse> NeoRpcClient::getRawTransaction(const Hash256& hash, bool verbose) {
+SharedPtr<EpicChainGetRawTransactionResponse> EpicChainRpcClient::getRawTransaction(const Hash256& hash, bool verbose) {
     auto params = nlohmann::json::array({hash.toString(), verbose});
     auto request = createRequest("getrawtransaction", params, requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
-    auto txResponse = std::make_shared<NeoGetRawTransactionResponse>();
+    auto txResponse = std::make_shared<EpicChainGetRawTransactionResponse>();
     txResponse->parseJson(result);
     return txResponse;
 }
 
-SharedPtr<NeoGetApplicationLogResponse> NeoRpcClient::getApplicationLog(const Hash256& hash) {
+SharedPtr<EpicChainGetApplicationLogResponse> EpicChainRpcClient::getApplicationLog(const Hash256& hash) {
     auto request = createRequest("getapplicationlog", nlohmann::json::array({hash.toString()}), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
-    auto logResponse = std::make_shared<NeoGetApplicationLogResponse>();
+    auto logResponse = std::make_shared<EpicChainGetApplicationLogResponse>();
     logResponse->parseJson(result);
     return logResponse;
 }
 
-std::string NeoRpcClient::getStorage(const Hash160& scriptHash, const std::string& key) {
+std::string EpicChainRpcClient::getStorage(const Hash160& scriptHash, const std::string& key) {
     Bytes keyBytes = Hex::decode(key);
     std::string base64Key = Base64::encode(keyBytes);
     auto params = nlohmann::json::array({scriptHash.toString(), base64Key});
     auto request = createRequest("getstorage", params, requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     return result.get<std::string>();
 }
 
-uint32_t NeoRpcClient::getTransactionHeight(const Hash256& txId) {
+uint32_t EpicChainRpcClient::getTransactionHeight(const Hash256& txId) {
     auto request = createRequest("gettransactionheight", nlohmann::json::array({txId.toString()}), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     return result.get<uint32_t>();
 }
 
-SharedPtr<NeoGetUnclaimedGasResponse> NeoRpcClient::getUnclaimedGas(const std::string& address) {
+SharedPtr<EpicChainGetUnclaimedGasResponse> EpicChainRpcClient::getUnclaimedGas(const std::string& address) {
     auto request = createRequest("getunclaimedgas", nlohmann::json::array({address}), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
-    auto gasResponse = std::make_shared<NeoGetUnclaimedGasResponse>();
+    auto gasResponse = std::make_shared<EpicChainGetUnclaimedGasResponse>();
     gasResponse->parseJson(result);
     return gasResponse;
 }
 
-SharedPtr<NeoGetNep17BalancesResponse> NeoRpcClient::getNep17Balances(const std::string& address) {
-    auto request = createRequest("getnep17balances", nlohmann::json::array({address}), requestId_++);
-    auto response = httpService_->post(request);
+SharedPtr<EpicChainGetXep17BalancesResponse> EpicChainRpcClient::getXep17Balances(const std::string& address) {
+    auto request = createRequest("getxep17balances", nlohmann::json::array({address}), requestId_++);
+    auto response = post(request);
     auto result = handleResponse(response);
     
-    auto balancesResponse = std::make_shared<NeoGetNep17BalancesResponse>();
+    auto balancesResponse = std::make_shared<EpicChainGetXep17BalancesResponse>();
     balancesResponse->parseJson(result);
     return balancesResponse;
 }
@@ -228,7 +230,7 @@ SharedPtr<NeoGetNep17BalancesResponse> NeoRpcClient::getNep17Balances(const std:
 nlohmann::json EpicChainRpcClient::getXep17Transfers(const std::string& address, uint64_t startTime, uint64_t endTime) {
     auto params = nlohmann::json::array({address, startTime, endTime});
     auto request = createRequest("getxep17transfers", params, requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     return handleResponse(response);
 }
 
@@ -245,130 +247,131 @@ SharedPtr<EpicChainInvokeResultResponse> EpicChainRpcClient::invokeFunction(cons
     });
     
     auto request = createRequest("invokefunction", requestParams, requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
-    auto invokeResponse = std::make_shared<NeoInvokeResultResponse>();
+    auto invokeResponse = std::make_shared<EpicChainInvokeResultResponse>();
     invokeResponse->parseJson(result);
     return invokeResponse;
 }
 
-SharedPtr<NeoInvokeResultResponse> NeoRpcClient::invokeScript(const Bytes& script,
+SharedPtr<EpicChainInvokeResultResponse> EpicChainRpcClient::invokeScript(const Bytes& script,
                                                               const nlohmann::json& signers) {
     std::string base64Script = Base64::encode(script);
     
     auto params = nlohmann::json::array({base64Script, signers});
     auto request = createRequest("invokescript", params, requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
-    auto invokeResponse = std::make_shared<NeoInvokeResultResponse>();
+    auto invokeResponse = std::make_shared<EpicChainInvokeResultResponse>();
     invokeResponse->parseJson(result);
     return invokeResponse;
 }
 
-SharedPtr<NeoInvokeResultResponse> NeoRpcClient::invokeScript(const std::string& base64Script,
+SharedPtr<EpicChainInvokeResultResponse> EpicChainRpcClient::invokeScript(const std::string& base64Script,
                                                               const nlohmann::json& signers) {
     auto params = nlohmann::json::array({base64Script, signers});
     auto request = createRequest("invokescript", params, requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
-    auto invokeResponse = std::make_shared<NeoInvokeResultResponse>();
+    auto invokeResponse = std::make_shared<EpicChainInvokeResultResponse>();
     invokeResponse->parseJson(result);
     return invokeResponse;
 }
 
 
-Hash256 NeoRpcClient::sendRawTransaction(const SharedPtr<Transaction>& transaction) {
-    BinaryWriter writer;
-    transaction->serialize(writer);
-    Bytes rawTx = writer.toArray();
-    std::string base64Tx = Base64::encode(rawTx);
+Hash256 EpicChainRpcClient::sendRawTransaction(const SharedPtr<Transaction>& transaction) {
+    std::string base64Tx = Base64::encode(transaction->toArray());
     
     auto request = createRequest("sendrawtransaction", nlohmann::json::array({base64Tx}), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
     return Hash256::fromHexString(result["hash"].get<std::string>());
 }
 
-Hash256 NeoRpcClient::sendRawTransaction(const std::string& hex) {
+Hash256 EpicChainRpcClient::sendRawTransaction(const std::string& hex) {
     auto request = createRequest("sendrawtransaction", nlohmann::json::array({hex}), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
     return Hash256::fromHexString(result["hash"].get<std::string>());
 }
 
-SharedPtr<NeoGetWalletBalanceResponse> NeoRpcClient::getWalletBalance(const Hash160& assetHash, const std::string& address) {
+SharedPtr<EpicChainGetWalletBalanceResponse> EpicChainRpcClient::getWalletBalance(const Hash160& assetHash, const std::string& address) {
     auto request = createRequest("getwalletbalance", nlohmann::json::array({assetHash.toString(), address}), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     
-    auto balanceResponse = std::make_shared<NeoGetWalletBalanceResponse>();
+    auto balanceResponse = std::make_shared<EpicChainGetWalletBalanceResponse>();
     balanceResponse->parseJson(result);
     return balanceResponse;
 }
 
 
-int64_t NeoRpcClient::calculateNetworkFee(const SharedPtr<Transaction>& transaction) {
-    BinaryWriter writer;
-    transaction->serialize(writer);
-    Bytes rawTx = writer.toArray();
-    std::string base64Tx = Base64::encode(rawTx);
+int64_t EpicChainRpcClient::calculateNetworkFee(const SharedPtr<Transaction>& transaction) {
+    std::string base64Tx = Base64::encode(transaction->toArray());
     
     auto request = createRequest("calculatenetworkfee", nlohmann::json::array({base64Tx}), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     return result["networkfee"].get<int64_t>();
 }
 
 
-nlohmann::json NeoRpcClient::getStateHeight() {
+nlohmann::json EpicChainRpcClient::getStateHeight() {
     auto request = createRequest("getstateheight", nlohmann::json::array(), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     return handleResponse(response);
 }
 
-nlohmann::json NeoRpcClient::getStateRoot(uint32_t index) {
+nlohmann::json EpicChainRpcClient::getStateRoot(uint32_t index) {
     auto request = createRequest("getstateroot", nlohmann::json::array({index}), requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     return handleResponse(response);
 }
 
-nlohmann::json NeoRpcClient::getProof(const Hash256& rootHash, const Hash160& contractHash, const std::string& key) {
+nlohmann::json EpicChainRpcClient::getProof(const Hash256& rootHash, const Hash160& contractHash, const std::string& key) {
     Bytes keyBytes = Hex::decode(key);
     std::string base64Key = Base64::encode(keyBytes);
     auto params = nlohmann::json::array({rootHash.toString(), contractHash.toString(), base64Key});
     auto request = createRequest("getproof", params, requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     return handleResponse(response);
 }
 
-bool NeoRpcClient::verifyProof(const Hash256& rootHash, const std::string& proof) {
+bool EpicChainRpcClient::verifyProof(const Hash256& rootHash, const std::string& proof) {
     auto params = nlohmann::json::array({rootHash.toString(), proof});
     auto request = createRequest("verifyproof", params, requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     auto result = handleResponse(response);
     return result.get<bool>();
 }
 
 
-nlohmann::json NeoRpcClient::findStorage(const Hash160& scriptHash, const std::string& prefix) {
+nlohmann::json EpicChainRpcClient::findStorage(const Hash160& scriptHash, const std::string& prefix) {
     auto params = nlohmann::json::array({scriptHash.toString(), prefix});
     auto request = createRequest("findstorage", params, requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     return handleResponse(response);
 }
 
-nlohmann::json NeoRpcClient::sendRequest(const std::string& method, const nlohmann::json& params) {
+nlohmann::json EpicChainRpcClient::findStorage(const Hash160& scriptHash, const std::string& prefix, int start) {
+    auto params = nlohmann::json::array({scriptHash.toString(), prefix, start});
+    auto request = createRequest("findstorage", params, requestId_++);
+    auto response = post(request);
+    return handleResponse(response);
+}
+
+nlohmann::json EpicChainRpcClient::sendRequest(const std::string& method, const nlohmann::json& params) {
     auto request = createRequest(method, params, requestId_++);
-    auto response = httpService_->post(request);
+    auto response = post(request);
     return handleResponse(response);
 }
 
-std::vector<nlohmann::json> NeoRpcClient::sendBatch(const std::vector<std::pair<std::string, nlohmann::json>>& requests) {
+std::vector<nlohmann::json> EpicChainRpcClient::sendBatch(const std::vector<std::pair<std::string, nlohmann::json>>& requests) {
     nlohmann::json batch = nlohmann::json::array();
     for (const auto& [method, params] : requests) {
         batch.push_back(createRequest(method, params, requestId_++));
@@ -383,19 +386,179 @@ std::vector<nlohmann::json> NeoRpcClient::sendBatch(const std::vector<std::pair<
     return results;
 }
 
-int NeoRpcClient::getNextRequestId() {
+void EpicChainRpcClient::sendRequestAsync(const std::string& method, const nlohmann::json& params, RpcCallback callback) {
+    auto request = createRequest(method, params, requestId_++);
+    auto deliver = [callback](const nlohmann::json& response, std::exception_ptr error) {
+        if (error) {
+            callback(nullptr, error);
+            return;
+        }
+        nlohmann::json result;
+        try {
+            result = handleResponse(response);
+        } catch (...) {
+            callback(nullptr, std::current_exception());
+            return;
+        }
+        callback(result, nullptr);
+    };
+    
+    if (auto batcher = std::atomic_load(&batcher_)) {
+        batcher->submit(request, deliver);
+    } else {
+        httpService_->postAsync(request, deliver);
+    }
+}
+
+// Helper to issue an async request and convert its result when it completes
+template<typename T, typename Convert>
+static std::future<T> requestAsync(EpicChainRpcClient& client, const std::string& method,
+                                   const nlohmann::json& params, Convert convert) {
+    auto promise = std::make_shared<std::promise<T>>();
+    auto future = promise->get_future();
+    client.sendRequestAsync(method, params, [promise, convert](const nlohmann::json& result, std::exception_ptr error) {
+        if (error) {
+            promise->set_exception(error);
+            return;
+        }
+        try {
+            promise->set_value(convert(result));
+        } catch (...) {
+            promise->set_exception(std::current_exception());
+        }
+    });
+    return future;
+}
+
+template<typename Response>
+static SharedPtr<Response> parseAs(const nlohmann::json& result) {
+    auto response = std::make_shared<Response>();
+    response->parseJson(result);
+    return response;
+}
+
+std::future<nlohmann::json> EpicChainRpcClient::sendRequestAsync(const std::string& method, const nlohmann::json& params) {
+    return requestAsync<nlohmann::json>(*this, method, params,
+                                        [](const nlohmann::json& result) { return result; });
+}
+
+std::future<uint32_t> EpicChainRpcClient::getBlockCountAsync() {
+    return requestAsync<uint32_t>(*this, "getblockcount", nlohmann::json::array(),
+                                  [](const nlohmann::json& result) { return result.get<uint32_t>(); });
+}
+
+std::future<SharedPtr<EpicChainGetBlockResponse>> EpicChainRpcClient::getBlockAsync(const Hash256& hash, bool verbose) {
+    return requestAsync<SharedPtr<EpicChainGetBlockResponse>>(*this, "getblock",
+                                                              nlohmann::json::array({hash.toString(), verbose}),
+                                                              parseAs<EpicChainGetBlockResponse>);
+}
+
+std::future<SharedPtr<EpicChainGetBlockResponse>> EpicChainRpcClient::getBlockAsync(uint32_t index, bool verbose) {
+    return requestAsync<SharedPtr<EpicChainGetBlockResponse>>(*this, "getblock",
+                                                              nlohmann::json::array({index, verbose}),
+                                                              parseAs<EpicChainGetBlockResponse>);
+}
+
+std::future<SharedPtr<EpicChainGetRawTransactionResponse>> EpicChainRpcClient::getRawTransactionAsync(const Hash256& txId, bool verbose) {
+    return requestAsync<SharedPtr<EpicChainGetRawTransactionResponse>>(*this, "getrawtransaction",
+                                                                       nlohmann::json::array({txId.toString(), verbose}),
+                                                                       parseAs<EpicChainGetRawTransactionResponse>);
+}
+
+std::future<SharedPtr<EpicChainGetApplicationLogResponse>> EpicChainRpcClient::getApplicationLogAsync(const Hash256& txId) {
+    return requestAsync<SharedPtr<EpicChainGetApplicationLogResponse>>(*this, "getapplicationlog",
+                                                                       nlohmann::json::array({txId.toString()}),
+                                                                       parseAs<EpicChainGetApplicationLogResponse>);
+}
+
+std::future<SharedPtr<EpicChainInvokeResultResponse>> EpicChainRpcClient::invokeFunctionAsync(const Hash160& scriptHash,
+                                                                                         const std::string& method,
+                                                                                         const nlohmann::json& params,
+                                                                                         const nlohmann::json& signers) {
+    return requestAsync<SharedPtr<EpicChainInvokeResultResponse>>(*this, "invokefunction",
+                                                                  nlohmann::json::array({scriptHash.toString(), method, params, signers}),
+                                                                  parseAs<EpicChainInvokeResultResponse>);
+}
+
+std::future<SharedPtr<EpicChainInvokeResultResponse>> EpicChainRpcClient::invokeScriptAsync(const Bytes& script,
+                                                                                       const nlohmann::json& signers) {
+    return requestAsync<SharedPtr<EpicChainInvokeResultResponse>>(*this, "invokescript",
+                                                                  nlohmann::json::array({Base64::encode(script), signers}),
+                                                                  parseAs<EpicChainInvokeResultResponse>);
+}
+
+std::future<Hash256> EpicChainRpcClient::sendRawTransactionAsync(const SharedPtr<Transaction>& transaction) {
+    std::string base64Tx = Base64::encode(transaction->toArray());
+    return requestAsync<Hash256>(*this, "sendrawtransaction", nlohmann::json::array({base64Tx}),
+                                 [](const nlohmann::json& result) {
+        return Hash256::fromHexString(result["hash"].get<std::string>());
+    });
+}
+
+void EpicChainRpcClient::enableAutoBatching(const RpcBatchConfig& config) {
+    std::atomic_store(&batcher_, std::make_shared<RpcBatcher>(httpService_, config));
+}
+
+void EpicChainRpcClient::disableAutoBatching() {
+    std::atomic_store(&batcher_, SharedPtr<RpcBatcher>());
+}
+
+bool EpicChainRpcClient::isAutoBatchingEnabled() const {
+    return std::atomic_load(&batcher_) != nullptr;
+}
+
+RpcBatchStats EpicChainRpcClient::getBatchStats() const {
+    auto batcher = std::atomic_load(&batcher_);
+    return batcher ? batcher->getStats() : RpcBatchStats();
+}
+
+nlohmann::json EpicChainRpcClient::sendRequestStreamed(const std::string& method, const nlohmann::json& params,
+                                                       const std::vector<std::string>& streamedPaths,
+                                                       const RpcResponseSax::ElementCallback& onElement) {
+    RpcResponseSax handler(streamedPaths, onElement);
+    httpService_->post(createRequest(method, params, requestId_++), handler);
+    return handler.takeResult();
+}
+
+SharedPtr<EpicChainGetBlockResponse> EpicChainRpcClient::getBlockStreamed(
+    uint32_t index, const std::function<void(nlohmann::json&&)>& onTransaction) {
+    auto result = sendRequestStreamed("getblock", nlohmann::json::array({index, true}), {"tx"},
+                                      [&onTransaction](const std::string&, nlohmann::json&& tx) {
+                                          onTransaction(std::move(tx));
+                                      });
+    return parseAs<EpicChainGetBlockResponse>(result);
+}
+
+SharedPtr<EpicChainGetApplicationLogResponse> EpicChainRpcClient::getApplicationLogStreamed(
+    const Hash256& hash, const std::function<void(nlohmann::json&&)>& onNotification) {
+    auto result = sendRequestStreamed("getapplicationlog", nlohmann::json::array({hash.toString()}),
+                                      {"executions/notifications"},
+                                      [&onNotification](const std::string&, nlohmann::json&& notification) {
+                                          onNotification(std::move(notification));
+                                      });
+    return parseAs<EpicChainGetApplicationLogResponse>(result);
+}
+
+nlohmann::json EpicChainRpcClient::post(const nlohmann::json& request) {
+    if (auto batcher = std::atomic_load(&batcher_)) {
+        return batcher->call(request);
+    }
+    return httpService_->post(request);
+}
+
+int EpicChainRpcClient::getNextRequestId() {
     return requestId_++;
 }
 
-nlohmann::json NeoRpcClient::buildRequest(const std::string& method, const nlohmann::json& params) {
+nlohmann::json EpicChainRpcClient::buildRequest(const std::string& method, const nlohmann::json& params) {
     return createRequest(method, params, requestId_++);
 }
 
-nlohmann::json NeoRpcClient::parseResponse(const std::string& response) {
+nlohmann::json EpicChainRpcClient::parseResponse(const std::string& response) {
     return nlohmann::json::parse(response);
 }
 
-void NeoRpcClient::handleError(const nlohmann::json& error) {
+void EpicChainRpcClient::handleError(const nlohmann::json& error) {
     std::string message = "RPC error";
     if (error.contains("message")) {
         message = error["message"].get<std::string>();
@@ -403,7 +566,7 @@ void NeoRpcClient::handleError(const nlohmann::json& error) {
     throw RpcException(message);
 }
 
-nlohmann::json NeoRpcClient::traverseIterator(const std::string& sessionId, const std::string& iteratorId, uint32_t count) {
+nlohmann::json EpicChainRpcClient::traverseIterator(const std::string& sessionId, const std::string& iteratorId, uint32_t count) {
     nlohmann::json params = nlohmann::json::array();
     params.push_back(sessionId);
     params.push_back(iteratorId);
@@ -411,11 +574,11 @@ nlohmann::json NeoRpcClient::traverseIterator(const std::string& sessionId, cons
     return sendRequest("traverseiterator", params);
 }
 
-bool NeoRpcClient::terminateSession(const std::string& sessionId) {
+bool EpicChainRpcClient::terminateSession(const std::string& sessionId) {
     nlohmann::json params = nlohmann::json::array();
     params.push_back(sessionId);
     auto result = sendRequest("terminatesession", params);
-    return result.contains("result") && result["result"].get<bool>();
+    return result.is_boolean() && result.get<bool>();
 }
 
 } // namespace epicchaincpp
\ No newline at end of file
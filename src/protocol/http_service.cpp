@@ -2,7 +2,12 @@
 #include "epicchaincpp/exceptions.hpp"
 #include <sstream>
 #include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <vector>
+#include <thread>
 #include <cstdlib>
+#include <iterator>
 
 #ifdef HAVE_CURL
 #include <curl/curl.h>
@@ -17,7 +22,712 @@ static size_t WriteCallback(void* contents, size_t size, size_t nmemb, std::stri
     response->append((char*)contents, totalSize);
     return totalSize;
 }
+
+/// Response body read on demand: each refill drives the transfer until
+/// more bytes arrive, so a parser can consume the body while it downloads.
+/// The write callback pauses the transfer once a chunk is waiting, which
+/// bounds the buffered body to about one network read.
+class BodyStream {
+public:
+    /// Input iterator over the body, for nlohmann::json's iterator input
+    class Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = char;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const char*;
+        using reference = const char&;
+        
+        Iterator() = default;
+        explicit Iterator(BodyStream* stream) : stream_(stream) {}
+        
+        reference operator*() const { return *pos_; }
+        Iterator& operator++() {
+            ++pos_;
+            return *this;
+        }
+        
+        /// Only comparison with the end iterator is meaningful
+        bool operator!=(const Iterator&) const {
+            return pos_ != limit_ || (stream_ && stream_->next(pos_, limit_));
+        }
+        bool operator==(const Iterator& other) const { return !(*this != other); }
+        
+    private:
+        BodyStream* stream_ = nullptr;
+        mutable const char* pos_ = nullptr;
+        mutable const char* limit_ = nullptr;
+    };
+    
+    explicit BodyStream(CURL* handle)
+        : handle_(handle), multi_(curl_multi_init()) {
+        if (!multi_) {
+            throw RpcException("Failed to initialize CURL multi handle");
+        }
+        curl_easy_setopt(handle_, CURLOPT_WRITEFUNCTION, &BodyStream::write);
+        curl_easy_setopt(handle_, CURLOPT_WRITEDATA, this);
+        curl_multi_add_handle(multi_, handle_);
+    }
+    
+    ~BodyStream() {
+        // Removing an unfinished transfer closes its connection instead of returning it to the pool
+        curl_multi_remove_handle(multi_, handle_);
+        curl_multi_cleanup(multi_);
+    }
+    
+    BodyStream(const BodyStream&) = delete;
+    BodyStream& operator=(const BodyStream&) = delete;
+    
+    Iterator begin() { return Iterator(this); }
+    Iterator end() { return Iterator(); }
+    
+    /// Drive the transfer to its end, discarding any remaining body
+    void finish() {
+        const char* pos;
+        const char* limit;
+        while (next(pos, limit)) {
+        }
+    }
+    
+private:
+    static constexpr size_t CHUNK_LIMIT = 64 * 1024;
+    
+    CURL* handle_;
+    CURLM* multi_;
+    std::string chunk_;
+    std::string pending_;
+    bool paused_ = false;
+    bool done_ = false;
+    
+    static size_t write(char* data, size_t size, size_t nmemb, void* userdata) {
+        auto* stream = static_cast<BodyStream*>(userdata);
+        if (stream->pending_.size() >= CHUNK_LIMIT) {
+            // CURL keeps this data and delivers it again once unpaused
+            stream->paused_ = true;
+            return CURL_WRITEFUNC_PAUSE;
+        }
+        stream->pending_.append(data, size * nmemb);
+        return size * nmemb;
+    }
+    
+    void resume() {
+        if (paused_) {
+            paused_ = false;
+            curl_easy_pause(handle_, CURLPAUSE_CONT);
+        }
+    }
+    
+    /// Make the next chunk of the body current
+    /// @return False at the end of the body
+    bool next(const char*& pos, const char*& limit) {
+        for (;;) {
+            if (!pending_.empty()) {
+                chunk_.swap(pending_);
+                pending_.clear();
+                pos = chunk_.data();
+                limit = pos + chunk_.size();
+                resume();
+                return true;
+            }
+            if (paused_) {
+                resume();
+                continue;
+            }
+            if (done_) {
+                pos = limit = nullptr;
+                return false;
+            }
+            
+            int running = 0;
+            CURLMcode code = curl_multi_perform(multi_, &running);
+            if (code != CURLM_OK) {
+                throw RpcException("HTTP request failed: " + std::string(curl_multi_strerror(code)));
+            }
+            int queued = 0;
+            while (CURLMsg* message = curl_multi_info_read(multi_, &queued)) {
+                if (message->msg == CURLMSG_DONE) {
+                    if (message->data.result != CURLE_OK) {
+                        throw RpcException("HTTP request failed: " + std::string(curl_easy_strerror(message->data.result)));
+                    }
+                    done_ = true;
+                }
+            }
+            if (!done_ && pending_.empty() && !paused_) {
+                curl_multi_poll(multi_, nullptr, 0, 1000, nullptr);
+            }
+        }
+    }
+};
+
+// Extract "scheme://host:port" from a URL so connection limits apply per origin
+static std::string hostKey(const std::string& url) {
+    size_t schemeEnd = url.find("://");
+    size_t hostStart = schemeEnd == std::string::npos ? 0 : schemeEnd + 3;
+    size_t hostEnd = url.find_first_of("/?#", hostStart);
+    return url.substr(0, hostEnd);
+}
+#endif
+
+/// Pool of reusable CURL easy handles sharing one connection cache.
+/// Handles are checked out for a single request and returned afterwards,
+/// which keeps their connections alive for the next caller.
+class HttpService::ConnectionPool {
+public:
+    explicit ConnectionPool(const HttpPoolConfig& config)
+        : config_(config), timeoutSeconds_(30) {
+#ifdef HAVE_CURL
+        share_ = curl_share_init();
+        if (share_) {
+            curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, &ConnectionPool::lockShare);
+            curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, &ConnectionPool::unlockShare);
+            curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+            curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+            curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+            curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+        }
+        rebuildHeaders();
+#endif
+    }
+    
+    ~ConnectionPool() {
+#ifdef HAVE_CURL
+        dropIdle();
+        if (share_) {
+            curl_share_cleanup(share_);
+        }
+#endif
+    }
+    
+    HttpPoolConfig getConfig() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return config_;
+    }
+    
+    void setConfig(const HttpPoolConfig& config) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            config_ = config;
+        }
+        available_.notify_all();
+#ifdef HAVE_CURL
+        dropIdle();
+#endif
+    }
+    
+    void setTimeout(int seconds) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        timeoutSeconds_ = seconds;
+    }
+    
+    void setDefaultHeaders(const Headers& headers) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        defaultHeaders_ = headers;
+#ifdef HAVE_CURL
+        rebuildHeaders();
+#endif
+    }
+    
+    HttpPoolStats getStats() const {
+        HttpPoolStats stats;
+        stats.requests = requests_.load();
+        stats.handleHits = handleHits_.load();
+        stats.newConnections = newConnections_.load();
+        return stats;
+    }
+    
+    void resetStats() {
+        requests_ = 0;
+        handleHits_ = 0;
+        newConnections_ = 0;
+    }
+    
+    /// Record a completed request and the number of connections it had to open
+    void recordRequest(long connects) {
+        if (connects > 0) {
+            newConnections_ += static_cast<uint64_t>(connects);
+        }
+        requests_++;
+    }
+    
+    std::atomic<size_t>& pendingAsync() { return pendingAsync_; }
+    
+#ifdef HAVE_CURL
+    /// Settings a request needs, captured once so they stay consistent for its lifetime
+    struct RequestDefaults {
+        HttpPoolConfig config;
+        long timeout;
+        Headers defaultHeaders;
+        std::shared_ptr<curl_slist> postHeaders;
+        std::shared_ptr<curl_slist> getHeaders;
+    };
+    
+    RequestDefaults defaults() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return {config_, timeoutSeconds_, defaultHeaders_, postHeaders_, getHeaders_};
+    }
+#endif
+    
+#ifdef HAVE_CURL
+    /// A handle checked out of the pool for the duration of one request
+    class Lease {
+    public:
+        Lease(ConnectionPool& pool, const std::string& url)
+            : pool_(pool), host_(hostKey(url)) {
+            pool_.acquire(*this);
+        }
+        
+        ~Lease() {
+            pool_.release(handle_, host_);
+        }
+        
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        
+        CURL* handle() const { return handle_; }
+        
+        /// Headers for JSON POST requests
+        curl_slist* postHeaders() const { return postHeaders_.get(); }
+        
+        /// Headers for JSON GET requests
+        curl_slist* getHeaders() const { return getHeaders_.get(); }
+        
+        /// Perform the request and record connection statistics
+        CURLcode perform() {
+            CURLcode res = curl_easy_perform(handle_);
+            recordRequest();
+            return res;
+        }
+        
+        /// Record connection statistics for a request driven by the caller
+        void recordRequest() {
+            long connects = 0;
+            curl_easy_getinfo(handle_, CURLINFO_NUM_CONNECTS, &connects);
+            pool_.recordRequest(connects);
+        }
+        
+    private:
+        friend class ConnectionPool;
+        
+        ConnectionPool& pool_;
+        std::string host_;
+        CURL* handle_ = nullptr;
+        std::shared_ptr<curl_slist> postHeaders_;
+        std::shared_ptr<curl_slist> getHeaders_;
+    };
+#endif
+    
+private:
+    HttpPoolConfig config_;
+    long timeoutSeconds_;
+    Headers defaultHeaders_;
+    mutable std::mutex mutex_;
+    std::condition_variable available_;
+    std::atomic<uint64_t> requests_{0};
+    std::atomic<uint64_t> handleHits_{0};
+    std::atomic<uint64_t> newConnections_{0};
+    std::atomic<size_t> pendingAsync_{0};
+    
+#ifdef HAVE_CURL
+    struct IdleHandle {
+        CURL* handle;
+        std::chrono::steady_clock::time_point lastUsed;
+    };
+    
+    CURLSH* share_ = nullptr;
+    std::mutex shareLocks_[CURL_LOCK_DATA_LAST];
+    std::vector<IdleHandle> idle_;
+    std::unordered_map<std::string, size_t> active_;
+    std::shared_ptr<curl_slist> postHeaders_;
+    std::shared_ptr<curl_slist> getHeaders_;
+    
+    static void lockShare(CURL*, curl_lock_data data, curl_lock_access, void* userptr) {
+        static_cast<ConnectionPool*>(userptr)->shareLocks_[data].lock();
+    }
+    
+    static void unlockShare(CURL*, curl_lock_data data, void* userptr) {
+        static_cast<ConnectionPool*>(userptr)->shareLocks_[data].unlock();
+    }
+    
+    // Build the header lists once instead of on every request.
+    // Requests in flight keep their own reference, so rebuilding is safe at any time.
+    // Caller must hold mutex_ (or be the constructor).
+    void rebuildHeaders() {
+        auto build = [this](bool withContentType) {
+            curl_slist* list = nullptr;
+            if (withContentType) {
+                list = curl_slist_append(list, "Content-Type: application/json");
+            }
+            list = curl_slist_append(list, "Accept: application/json");
+            for (const auto& [name, value] : defaultHeaders_) {
+                list = curl_slist_append(list, (name + ": " + value).c_str());
+            }
+            return std::shared_ptr<curl_slist>(list, curl_slist_free_all);
+        };
+        postHeaders_ = build(true);
+        getHeaders_ = build(false);
+    }
+    
+    void acquire(Lease& lease) {
+        std::vector<CURL*> expired;
+        CURL* handle = nullptr;
+        long timeout = 0;
+        long maxAge = 0;
+        long maxConnects = 0;
+        bool share = false;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            available_.wait(lock, [&] {
+                return config_.maxConnectionsPerHost == 0 ||
+                       active_[lease.host_] < config_.maxConnectionsPerHost;
+            });
+            active_[lease.host_]++;
+            
+            // Close handles whose connections have been idle too long
+            auto now = std::chrono::steady_clock::now();
+            auto it = idle_.begin();
+            while (it != idle_.end()) {
+                if (now - it->lastUsed > config_.idleTimeout) {
+                    expired.push_back(it->handle);
+                    it = idle_.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            
+            // Most recently used handle first: its connection is the most likely to still be open
+            if (!idle_.empty()) {
+                handle = idle_.back().handle;
+                idle_.pop_back();
+            }
+            
+            lease.postHeaders_ = postHeaders_;
+            lease.getHeaders_ = getHeaders_;
+            timeout = timeoutSeconds_;
+            maxAge = static_cast<long>(config_.idleTimeout.count());
+            maxConnects = static_cast<long>(config_.maxConnectionsPerHost);
+            share = config_.shareConnections && share_ != nullptr;
+        }
+        
+        for (CURL* h : expired) {
+            curl_easy_cleanup(h);
+        }
+        
+        if (handle) {
+            // Reset clears per-request options but keeps live connections and caches
+            curl_easy_reset(handle);
+            handleHits_++;
+        } else {
+            handle = curl_easy_init();
+            if (!handle) {
+                release(nullptr, lease.host_);
+                throw RpcException("Failed to initialize CURL");
+            }
+        }
+        
+        if (share) {
+            curl_easy_setopt(handle, CURLOPT_SHARE, share_);
+        }
+        curl_easy_setopt(handle, CURLOPT_TIMEOUT, timeout);
+        curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, 1L);
+        if (maxAge > 0) {
+            curl_easy_setopt(handle, CURLOPT_MAXAGE_CONN, maxAge);
+        }
+        if (maxConnects > 0) {
+            curl_easy_setopt(handle, CURLOPT_MAXCONNECTS, maxConnects);
+        }
+        lease.handle_ = handle;
+    }
+    
+    void release(CURL* handle, const std::string& host) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = active_.find(host);
+            if (it != active_.end() && --it->second == 0) {
+                active_.erase(it);
+            }
+            if (handle) {
+                idle_.push_back({handle, std::chrono::steady_clock::now()});
+            }
+        }
+        available_.notify_one();
+    }
+    
+    void dropIdle() {
+        std::vector<IdleHandle> idle;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            idle.swap(idle_);
+        }
+        for (const auto& entry : idle) {
+            curl_easy_cleanup(entry.handle);
+        }
+    }
+#endif
+};
+
+// Pool whose event loop runs on this thread, so callers can tell they are inside a callback
+static thread_local const void* eventLoopPool = nullptr;
+
+/// Event loop multiplexing async requests over the CURL multi interface.
+/// A single thread drives every transfer; completions are delivered on that thread.
+class HttpService::AsyncEngine {
+public:
+    using Completion = std::function<void(HttpResponse&&)>;
+    
+    explicit AsyncEngine(ConnectionPool& pool)
+        : pool_(pool) {
+#ifdef HAVE_CURL
+        multi_ = curl_multi_init();
+        if (!multi_) {
+            throw RpcException("Failed to initialize CURL multi handle");
+        }
+        auto config = pool_.getConfig();
+        applyConfig(config.multiplex, config.maxConnectionsPerHost);
+        running_ = true;
+        thread_ = std::thread(&AsyncEngine::run, this);
+#endif
+    }
+    
+    ~AsyncEngine() {
+#ifdef HAVE_CURL
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            running_ = false;
+        }
+        curl_multi_wakeup(multi_);
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        for (CURL* handle : idle_) {
+            curl_easy_cleanup(handle);
+        }
+        curl_multi_cleanup(multi_);
 #endif
+    }
+    
+    /// Queue a request; the completion is always invoked exactly once
+    void submit(const std::string& url, std::string body, bool isPost,
+                const Headers& extraHeaders, bool jsonHeaders, Completion done) {
+#ifdef HAVE_CURL
+        auto transfer = std::make_unique<Transfer>();
+        auto defaults = pool_.defaults();
+        transfer->url = url;
+        transfer->body = std::move(body);
+        transfer->isPost = isPost;
+        transfer->timeout = defaults.timeout;
+        transfer->multiplex = defaults.config.multiplex;
+        transfer->maxConnectionsPerHost = defaults.config.maxConnectionsPerHost;
+        transfer->done = std::move(done);
+        if (jsonHeaders && extraHeaders.empty()) {
+            transfer->headers = isPost ? defaults.postHeaders : defaults.getHeaders;
+        } else {
+            curl_slist* list = nullptr;
+            if (jsonHeaders) {
+                if (isPost) {
+                    list = curl_slist_append(list, "Content-Type: application/json");
+                }
+                list = curl_slist_append(list, "Accept: application/json");
+            }
+            auto append = [&list](const Headers& headers) {
+                for (const auto& [name, value] : headers) {
+                    list = curl_slist_append(list, (name + ": " + value).c_str());
+                }
+            };
+            append(defaults.defaultHeaders);
+            append(extraHeaders);
+            transfer->headers = std::shared_ptr<curl_slist>(list, curl_slist_free_all);
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (running_) {
+                queue_.push_back(std::move(transfer));
+                pool_.pendingAsync()++;
+            }
+        }
+        if (transfer) {
+            HttpResponse response{0, "", {}, "HTTP service is shutting down"};
+            transfer->done(std::move(response));
+            return;
+        }
+        curl_multi_wakeup(multi_);
+#else
+        (void)url;
+        (void)body;
+        (void)isPost;
+        (void)extraHeaders;
+        (void)jsonHeaders;
+        HttpResponse response{0, "", {}, "HTTP support not available (CURL not found)"};
+        done(std::move(response));
+#endif
+    }
+    
+private:
+    ConnectionPool& pool_;
+    
+#ifdef HAVE_CURL
+    struct Transfer {
+        std::string url;
+        std::string body;
+        bool isPost = false;
+        long timeout = 30;
+        bool multiplex = true;
+        size_t maxConnectionsPerHost = 0;
+        std::shared_ptr<curl_slist> headers;
+        std::string response;
+        Completion done;
+        CURL* handle = nullptr;
+    };
+    
+    CURLM* multi_ = nullptr;
+    std::thread thread_;
+    std::mutex mutex_;
+    bool running_ = false;
+    std::vector<std::unique_ptr<Transfer>> queue_;
+    std::unordered_map<CURL*, std::unique_ptr<Transfer>> active_;
+    std::vector<CURL*> idle_;
+    
+    // Multi handle options currently set; only touched by the constructor and the event loop
+    bool multiplex_ = false;
+    size_t maxConnectionsPerHost_ = 0;
+    
+    /// Bring the multi handle in line with the pool config a transfer was submitted under
+    void applyConfig(bool multiplex, size_t maxConnectionsPerHost) {
+        if (multiplex != multiplex_) {
+            curl_multi_setopt(multi_, CURLMOPT_PIPELINING, multiplex ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING);
+            multiplex_ = multiplex;
+        }
+        if (maxConnectionsPerHost != maxConnectionsPerHost_) {
+            // Transfers beyond the limit are queued by CURL until a connection frees up; 0 lifts the limit
+            curl_multi_setopt(multi_, CURLMOPT_MAX_HOST_CONNECTIONS, static_cast<long>(maxConnectionsPerHost));
+            maxConnectionsPerHost_ = maxConnectionsPerHost;
+        }
+    }
+    
+    void start(std::unique_ptr<Transfer> transfer) {
+        // setPoolConfig may have changed the limits since the previous transfer
+        applyConfig(transfer->multiplex, transfer->maxConnectionsPerHost);
+        
+        CURL* handle = nullptr;
+        if (!idle_.empty()) {
+            handle = idle_.back();
+            idle_.pop_back();
+            curl_easy_reset(handle);
+        } else {
+            handle = curl_easy_init();
+        }
+        if (!handle) {
+            finish(*transfer, 0, "Failed to initialize CURL");
+            return;
+        }
+        
+        curl_easy_setopt(handle, CURLOPT_URL, transfer->url.c_str());
+        if (transfer->isPost) {
+            curl_easy_setopt(handle, CURLOPT_POST, 1L);
+            curl_easy_setopt(handle, CURLOPT_POSTFIELDS, transfer->body.c_str());
+            curl_easy_setopt(handle, CURLOPT_POSTFIELDSIZE, static_cast<long>(transfer->body.size()));
+        } else {
+            curl_easy_setopt(handle, CURLOPT_HTTPGET, 1L);
+        }
+        curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, WriteCallback);
+        curl_easy_setopt(handle, CURLOPT_WRITEDATA, &transfer->response);
+        curl_easy_setopt(handle, CURLOPT_HTTPHEADER, transfer->headers.get());
+        curl_easy_setopt(handle, CURLOPT_TIMEOUT, transfer->timeout);
+        curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, 1L);
+        if (transfer->multiplex) {
+            // HTTP/2 over TLS when the node offers it; wait for a multiplexable connection
+            // rather than opening a new one per request
+            curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+            curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1L);
+        }
+        
+        transfer->handle = handle;
+        if (curl_multi_add_handle(multi_, handle) != CURLM_OK) {
+            idle_.push_back(handle);
+            finish(*transfer, 0, "Failed to add request to CURL multi handle");
+            return;
+        }
+        active_.emplace(handle, std::move(transfer));
+    }
+    
+    void complete(CURL* handle, CURLcode result) {
+        curl_multi_remove_handle(multi_, handle);
+        auto it = active_.find(handle);
+        if (it == active_.end()) {
+            curl_easy_cleanup(handle);
+            return;
+        }
+        auto transfer = std::move(it->second);
+        active_.erase(it);
+        
+        long status = 0;
+        long connects = 0;
+        curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &status);
+        curl_easy_getinfo(handle, CURLINFO_NUM_CONNECTS, &connects);
+        pool_.recordRequest(connects);
+        idle_.push_back(handle);
+        
+        finish(*transfer, static_cast<int>(status),
+               result == CURLE_OK ? "" : curl_easy_strerror(result));
+    }
+    
+    void finish(Transfer& transfer, int status, const std::string& error) {
+        HttpResponse response{status, std::move(transfer.response), {}, error};
+        pool_.pendingAsync()--;
+        try {
+            transfer.done(std::move(response));
+        } catch (...) {
+            // Ignore callback errors so one caller cannot stall the event loop
+        }
+    }
+    
+    void run() {
+        eventLoopPool = &pool_;
+        while (true) {
+            std::vector<std::unique_ptr<Transfer>> incoming;
+            bool running;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                incoming.swap(queue_);
+                running = running_;
+            }
+            for (auto& transfer : incoming) {
+                if (running) {
+                    start(std::move(transfer));
+                } else {
+                    finish(*transfer, 0, "HTTP service is shutting down");
+                }
+            }
+            if (!running) {
+                break;
+            }
+            
+            int stillRunning = 0;
+            curl_multi_perform(multi_, &stillRunning);
+            
+            CURLMsg* message = nullptr;
+            int remaining = 0;
+            while ((message = curl_multi_info_read(multi_, &remaining)) != nullptr) {
+                if (message->msg == CURLMSG_DONE) {
+                    complete(message->easy_handle, message->data.result);
+                }
+            }
+            
+            // Sleeps until socket activity, a CURL timer, or curl_multi_wakeup from submit()
+            curl_multi_poll(multi_, nullptr, 0, 1000, nullptr);
+        }
+        
+        for (auto& [handle, transfer] : active_) {
+            curl_multi_remove_handle(multi_, handle);
+            idle_.push_back(handle);
+            finish(*transfer, 0, "HTTP service is shutting down");
+        }
+        active_.clear();
+    }
+#endif
+};
 
 HttpService::HttpService(const std::string& baseUrl) 
     : baseUrl_(baseUrl) {
@@ -30,44 +740,65 @@ HttpService::HttpService(const std::string& baseUrl)
         std::atexit([]() { curl_global_cleanup(); });
     });
 #endif
+    pool_ = std::make_unique<ConnectionPool>(HttpPoolConfig());
 }
 
 HttpService::~HttpService() {
-    // Cleanup is handled globally
+    // Stop the event loop before the pool it reports to; global cleanup is handled at exit
+    async_.reset();
+}
+
+HttpService::AsyncEngine& HttpService::asyncEngine() {
+    std::call_once(asyncInit_, [this]() {
+        async_ = std::make_unique<AsyncEngine>(*pool_);
+    });
+    return *async_;
+}
+
+void HttpService::setTimeout(int seconds) {
+    pool_->setTimeout(seconds);
+}
+
+void HttpService::setDefaultHeaders(const Headers& headers) {
+    pool_->setDefaultHeaders(headers);
+}
+
+void HttpService::setPoolConfig(const HttpPoolConfig& config) {
+    pool_->setConfig(config);
+}
+
+HttpPoolConfig HttpService::getPoolConfig() const {
+    return pool_->getConfig();
+}
+
+HttpPoolStats HttpService::getPoolStats() const {
+    return pool_->getStats();
+}
+
+void HttpService::resetPoolStats() {
+    pool_->resetStats();
 }
 
 nlohmann::json HttpService::post(const nlohmann::json& data, const std::string& endpoint) {
 #ifdef HAVE_CURL
-    CURL* curl = curl_easy_init();
-    if (!curl) {
-        throw RpcException("Failed to initialize CURL");
-    }
-    
     std::string url = baseUrl_ + endpoint;
     std::string jsonStr = data.dump();
     std::string response;
     
+    ConnectionPool::Lease lease(*pool_, url);
+    CURL* curl = lease.handle();
+    
     // Set CURL options
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_POST, 1L);
     curl_easy_setopt(curl, CURLOPT_POSTFIELDS, jsonStr.c_str());
-    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, jsonStr.length());
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(jsonStr.length()));
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 30L);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, lease.postHeaders());
     
-    // Set headers
-    struct curl_slist* headers = nullptr;
-    headers = curl_slist_append(headers, "Content-Type: application/json");
-    headers = curl_slist_append(headers, "Accept: application/json");
-    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-    
-    // Perform request
-    CURLcode res = curl_easy_perform(curl);
-    
-    // Cleanup
-    curl_slist_free_all(headers);
-    curl_easy_cleanup(curl);
+    // Perform request on a pooled keep-alive connection
+    CURLcode res = lease.perform();
     
     if (res != CURLE_OK) {
         throw RpcException("HTTP request failed: " + std::string(curl_easy_strerror(res)));
@@ -86,33 +817,57 @@ nlohmann::json HttpService::post(const nlohmann::json& data, const std::string&
 #endif
 }
 
-nlohmann::json HttpService::get(const std::string& endpoint) {
+void HttpService::post(const nlohmann::json& data, nlohmann::json_sax<nlohmann::json>& handler,
+                       const std::string& endpoint) {
 #ifdef HAVE_CURL
-    CURL* curl = curl_easy_init();
-    if (!curl) {
-        throw RpcException("Failed to initialize CURL");
-    }
+    std::string url = baseUrl_ + endpoint;
+    std::string jsonStr = data.dump();
+    
+    ConnectionPool::Lease lease(*pool_, url);
+    CURL* curl = lease.handle();
+    
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_POST, 1L);
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, jsonStr.c_str());
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(jsonStr.length()));
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, lease.postHeaders());
     
+    // Parse on this thread while the body downloads, without buffering it
+    BodyStream body(curl);
+    try {
+        if (!nlohmann::json::sax_parse(body.begin(), body.end(), &handler)) {
+            throw RpcException("Failed to parse JSON response");
+        }
+    } catch (const nlohmann::json::exception& e) {
+        throw RpcException("Failed to parse JSON response: " + std::string(e.what()));
+    }
+    body.finish();
+    lease.recordRequest();
+#else
+    (void)data;
+    (void)handler;
+    (void)endpoint;
+    throw RpcException("HTTP support not available (CURL not found)");
+#endif
+}
+
+nlohmann::json HttpService::get(const std::string& endpoint) {
+#ifdef HAVE_CURL
     std::string url = baseUrl_ + endpoint;
     std::string response;
     
+    ConnectionPool::Lease lease(*pool_, url);
+    CURL* curl = lease.handle();
+    
     // Set CURL options
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 30L);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, lease.getHeaders());
     
-    // Set headers
-    struct curl_slist* headers = nullptr;
-    headers = curl_slist_append(headers, "Accept: application/json");
-    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-    
-    // Perform request
-    CURLcode res = curl_easy_perform(curl);
-    
-    // Cleanup
-    curl_slist_free_all(headers);
-    curl_easy_cleanup(curl);
+    // Perform request on a pooled keep-alive connection
+    CURLcode res = lease.perform();
     
     if (res != CURLE_OK) {
         throw RpcException("HTTP request failed: " + std::string(curl_easy_strerror(res)));
@@ -130,4 +885,55 @@ nlohmann::json HttpService::get(const std::string& endpoint) {
 #endif
 }
 
+void HttpService::getAsync(const std::string& url, ResponseCallback callback, const Headers& headers) {
+    asyncEngine().submit(url, "", false, headers, false,
+                         [callback](HttpResponse&& response) { callback(response); });
+}
+
+void HttpService::postAsync(const std::string& url, const std::string& body, ResponseCallback callback, const Headers& headers) {
+    asyncEngine().submit(url, body, true, headers, false,
+                         [callback](HttpResponse&& response) { callback(response); });
+}
+
+void HttpService::postAsync(const nlohmann::json& data, JsonCallback callback, const std::string& endpoint) {
+    asyncEngine().submit(baseUrl_ + endpoint, data.dump(), true, {}, true,
+                         [callback](HttpResponse&& response) {
+        if (!response.error.empty()) {
+            callback(nullptr, std::make_exception_ptr(
+                RpcException("HTTP request failed: " + response.error)));
+            return;
+        }
+        nlohmann::json json;
+        try {
+            json = nlohmann::json::parse(response.body);
+        } catch (const nlohmann::json::exception& e) {
+            callback(nullptr, std::make_exception_ptr(
+                RpcException("Failed to parse JSON response: " + std::string(e.what()))));
+            return;
+        }
+        callback(json, nullptr);
+    });
+}
+
+std::future<nlohmann::json> HttpService::postAsync(const nlohmann::json& data, const std::string& endpoint) {
+    auto promise = std::make_shared<std::promise<nlohmann::json>>();
+    auto future = promise->get_future();
+    postAsync(data, [promise](const nlohmann::json& response, std::exception_ptr error) {
+        if (error) {
+            promise->set_exception(error);
+        } else {
+            promise->set_value(response);
+        }
+    }, endpoint);
+    return future;
+}
+
+size_t HttpService::getPendingAsyncRequests() const {
+    return pool_->pendingAsync().load();
+}
+
+bool HttpService::isEventLoopThread() const {
+    return eventLoopPool == pool_.get();
+}
+
 } // namespace epicchaincpp
\ No newline at end of file
@@ -1,11 +1,15 @@
 #include "epicchaincpp/protocol/response_types_impl.hpp"
 #include "epicchaincpp/protocol/stack_item.hpp"
+#include "epicchaincpp/protocol/core/block.hpp"
+#include "epicchaincpp/transaction/transaction.hpp"
+#include "epicchaincpp/serialization/binary_reader.hpp"
+#include "epicchaincpp/utils/base64.hpp"
 #include "epicchaincpp/exceptions.hpp"
 
 namespace epicchaincpp {
 
-// NeoGetVersionResponse
-void NeoGetVersionResponse::parseJson(const nlohmann::json& json) {
+// EpicChainGetVersionResponse
+void EpicChainGetVersionResponse::parseJson(const nlohmann::json& json) {
     if (json.contains("tcpport")) {
         tcpPort_ = json["tcpport"].get<int>();
     }
@@ -24,8 +28,8 @@ void NeoGetVersionResponse::parseJson(const nlohmann::json& json) {
     rawJson_ = json;
 }
 
-// NeoGetPeersResponse
-void NeoGetPeersResponse::parseJson(const nlohmann::json& json) {
+// EpicChainGetPeersResponse
+void EpicChainGetPeersResponse::parseJson(const nlohmann::json& json) {
     if (json.contains("connected")) {
         connected_ = json["connected"];
     }
@@ -38,8 +42,23 @@ void NeoGetPeersResponse::parseJson(const nlohmann::json& json) {
     rawJson_ = json;
 }
 
-// NeoGetBlockResponse
-void NeoGetBlockResponse::parseJson(const nlohmann::json& json) {
+// EpicChainGetBlockResponse
+void EpicChainGetBlockResponse::parseJson(const nlohmann::json& json) {
+    // Non-verbose responses carry the serialized block as a base64 string
+    if (json.is_string()) {
+        block_ = Block::fromBase64(json.get<std::string>());
+        const auto& header = block_->getHeader();
+        hash_ = header->getHash();
+        size_ = static_cast<int>(block_->getSize());
+        version_ = static_cast<int>(header->getVersion());
+        previousBlockHash_ = header->getPreviousHash();
+        merkleRoot_ = header->getMerkleRoot();
+        time_ = header->getTimestamp();
+        index_ = header->getIndex();
+        nextConsensus_ = header->getNextConsensus().toAddress();
+        rawJson_ = json;
+        return;
+    }
     if (json.contains("hash")) {
         hash_ = Hash256::fromHexString(json["hash"].get<std::string>());
     }
@@ -80,8 +99,24 @@ void NeoGetBlockResponse::parseJson(const nlohmann::json& json) {
     rawJson_ = json;
 }
 
-// NeoGetRawTransactionResponse
-void NeoGetRawTransactionResponse::parseJson(const nlohmann::json& json) {
+// EpicChainGetRawTransactionResponse
+void EpicChainGetRawTransactionResponse::parseJson(const nlohmann::json& json) {
+    // Non-verbose responses carry the serialized transaction as a base64 string
+    if (json.is_string()) {
+        Bytes data = Base64::decode(json.get<std::string>());
+        BinaryReader reader(data);
+        transaction_ = Transaction::deserialize(reader);
+        hash_ = transaction_->getHash();
+        size_ = static_cast<int>(data.size());
+        version_ = transaction_->getVersion();
+        nonce_ = transaction_->getNonce();
+        sysfee_ = std::to_string(transaction_->getSystemFee());
+        netfee_ = std::to_string(transaction_->getNetworkFee());
+        validUntilBlock_ = transaction_->getValidUntilBlock();
+        script_ = Base64::encode(transaction_->getScript());
+        rawJson_ = json;
+        return;
+    }
     if (json.contains("hash")) {
         hash_ = Hash256::fromHexString(json["hash"].get<std::string>());
     }
@@ -130,8 +165,8 @@ void NeoGetRawTransactionResponse::parseJson(const nlohmann::json& json) {
     rawJson_ = json;
 }
 
-// NeoGetApplicationLogResponse
-void NeoGetApplicationLogResponse::parseJson(const nlohmann::json& json) {
+// EpicChainGetApplicationLogResponse
+void EpicChainGetApplicationLogResponse::parseJson(const nlohmann::json& json) {
     if (json.contains("txid")) {
         txid_ = json["txid"].get<std::string>();
     }
@@ -141,8 +176,8 @@ void NeoGetApplicationLogResponse::parseJson(const nlohmann::json& json) {
     rawJson_ = json;
 }
 
-// NeoGetContractStateResponse
-void NeoGetContractStateResponse::parseJson(const nlohmann::json& json) {
+// EpicChainGetContractStateResponse
+void EpicChainGetContractStateResponse::parseJson(const nlohmann::json& json) {
     if (json.contains("id")) {
         id_ = json["id"].get<int>();
     }
@@ -162,13 +197,13 @@ void NeoGetContractStateResponse::parseJson(const nlohmann::json& json) {
 }
 
 // EpicChainGetXep17BalancesResponse
-void XeoGetXep17BalancesResponse::parseJson(const nlohmann::json& json) {
+void EpicChainGetXep17BalancesResponse::parseJson(const nlohmann::json& json) {
     if (json.contains("address")) {
         address_ = json["address"].get<std::string>();
     }
     if (json.contains("balance")) {
         for (const auto& balance : json["balance"]) {
-            EpicChainXep17Balance bal;
+            EpicChainNep17Balance bal;
             bal.assetHash = Hash160(balance["assethash"].get<std::string>());
             bal.amount = balance["amount"].get<std::string>();
             bal.lastUpdatedBlock = balance["lastupdatedblock"].get<uint32_t>();
@@ -178,8 +213,8 @@ void XeoGetXep17BalancesResponse::parseJson(const nlohmann::json& json) {
     rawJson_ = json;
 }
 
-// NeoInvokeResultResponse
-void NeoInvokeResultResponse::parseJson(const nlohmann::json& json) {
+// EpicChainInvokeResultResponse
+void EpicChainInvokeResultResponse::parseJson(const nlohmann::json& json) {
     if (json.contains("script")) {
         script_ = json["script"].get<std::string>();
     }
@@ -210,8 +245,8 @@ void NeoInvokeResultResponse::parseJson(const nlohmann::json& json) {
     rawJson_ = json;
 }
 
-// NeoGetUnclaimedGasResponse
-void NeoGetUnclaimedGasResponse::parseJson(const nlohmann::json& json) {
+// EpicChainGetUnclaimedGasResponse
+void EpicChainGetUnclaimedGasResponse::parseJson(const nlohmann::json& json) {
     if (json.contains("unclaimed")) {
         unclaimed_ = json["unclaimed"].get<std::string>();
     }
@@ -221,8 +256,8 @@ void NeoGetUnclaimedGasResponse::parseJson(const nlohmann::json& json) {
     rawJson_ = json;
 }
 
-// NeoGetWalletBalanceResponse
-void NeoGetWalletBalanceResponse::parseJson(const nlohmann::json& json) {
+// EpicChainGetWalletBalanceResponse
+void EpicChainGetWalletBalanceResponse::parseJson(const nlohmann::json& json) {
     if (json.contains("balance")) {
         balance_ = json["balance"].get<std::string>();
     }
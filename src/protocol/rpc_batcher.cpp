@@ -0,0 +1,161 @@
+#include "epicchaincpp/protocol/rpc_batcher.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <unordered_map>
+#include <algorithm>
+
+namespace epicchaincpp {
+
+RpcBatcher::RpcBatcher(const SharedPtr<HttpService>& httpService, const RpcBatchConfig& config)
+    : httpService_(httpService), config_(config), running_(true) {
+    if (!httpService_) {
+        throw IllegalArgumentException("HTTP service cannot be null");
+    }
+    if (config_.maxBatchSize == 0) {
+        throw IllegalArgumentException("Maximum batch size must be positive");
+    }
+    flusher_ = std::thread(&RpcBatcher::flushLoop, this);
+}
+
+RpcBatcher::~RpcBatcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (flusher_.joinable()) {
+        flusher_.join();
+    }
+}
+
+void RpcBatcher::submit(const nlohmann::json& request, HttpService::JsonCallback callback) {
+    if (!request.contains("id")) {
+        throw IllegalArgumentException("Batched requests must carry an id");
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            throw IllegalStateException("RPC batcher is shutting down");
+        }
+        pending_.push_back({request, std::move(callback), std::chrono::steady_clock::now()});
+    }
+    requests_++;
+    cv_.notify_one();
+}
+
+std::future<nlohmann::json> RpcBatcher::submit(const nlohmann::json& request) {
+    auto promise = std::make_shared<std::promise<nlohmann::json>>();
+    auto future = promise->get_future();
+    submit(request, [promise](const nlohmann::json& response, std::exception_ptr error) {
+        if (error) {
+            promise->set_exception(error);
+        } else {
+            promise->set_value(response);
+        }
+    });
+    return future;
+}
+
+nlohmann::json RpcBatcher::call(const nlohmann::json& request) {
+    // The batch's response is delivered on the event loop, so blocking it on
+    // that response would never return; send those requests on their own
+    if (httpService_->isEventLoopThread()) {
+        requests_++;
+        batches_++;
+        return httpService_->post(request);
+    }
+    return submit(request).get();
+}
+
+RpcBatchStats RpcBatcher::getStats() const {
+    RpcBatchStats stats;
+    stats.requests = requests_.load();
+    stats.batches = batches_.load();
+    return stats;
+}
+
+void RpcBatcher::flushLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this] { return !running_ || !pending_.empty(); });
+        if (pending_.empty()) {
+            break;
+        }
+        
+        // Hold the batch open until the oldest request's window closes or it fills up
+        auto deadline = pending_.front().enqueued + config_.maxDelay;
+        cv_.wait_until(lock, deadline, [this] {
+            return !running_ || pending_.size() >= config_.maxBatchSize;
+        });
+        
+        size_t count = std::min(pending_.size(), config_.maxBatchSize);
+        std::vector<Pending> batch;
+        batch.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            batch.push_back(std::move(pending_.front()));
+            pending_.pop_front();
+        }
+        
+        lock.unlock();
+        send(std::move(batch));
+        lock.lock();
+    }
+}
+
+void RpcBatcher::send(std::vector<Pending> batch) {
+    nlohmann::json payload = nlohmann::json::array();
+    for (const auto& item : batch) {
+        payload.push_back(item.request);
+    }
+    batches_++;
+    
+    auto requests = std::make_shared<std::vector<Pending>>(std::move(batch));
+    auto deliver = [requests](const nlohmann::json& response, std::exception_ptr error) {
+        // Isolate callers so one throwing callback does not starve the rest of the batch
+        auto notify = [](const Pending& item, const nlohmann::json& result, std::exception_ptr failure) {
+            try {
+                item.callback(result, failure);
+            } catch (...) {
+            }
+        };
+        
+        if (error) {
+            for (const auto& item : *requests) {
+                notify(item, nullptr, error);
+            }
+            return;
+        }
+        
+        // A node that rejects the whole batch answers with a single error object
+        if (!response.is_array()) {
+            for (const auto& item : *requests) {
+                notify(item, response, nullptr);
+            }
+            return;
+        }
+        
+        std::unordered_map<std::string, const nlohmann::json*> byId;
+        for (const auto& item : response) {
+            if (item.contains("id")) {
+                byId[item["id"].dump()] = &item;
+            }
+        }
+        for (const auto& item : *requests) {
+            std::string id = item.request["id"].dump();
+            auto it = byId.find(id);
+            if (it != byId.end()) {
+                notify(item, *it->second, nullptr);
+            } else {
+                notify(item, nullptr, std::make_exception_ptr(
+                    RpcException("Batch response is missing request id " + id)));
+            }
+        }
+    };
+    
+    try {
+        httpService_->postAsync(payload, deliver);
+    } catch (...) {
+        deliver(nullptr, std::current_exception());
+    }
+}
+
+} // namespace epicchaincpp
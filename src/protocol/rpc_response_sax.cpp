@@ -0,0 +1,197 @@
+#include "epicchaincpp/protocol/rpc_response_sax.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <algorithm>
+
+namespace epicchaincpp {
+
+nlohmann::json* RpcResponseSax::Builder::insert(nlohmann::json&& value) {
+    if (stack_.empty()) {
+        root = std::move(value);
+        return &root;
+    }
+    nlohmann::json& parent = *stack_.back();
+    if (parent.is_array()) {
+        // Only the innermost open container grows, so pointers to its ancestors stay valid
+        parent.push_back(std::move(value));
+        return &parent.back();
+    }
+    *slot_ = std::move(value);
+    return slot_;
+}
+
+void RpcResponseSax::Builder::value(nlohmann::json&& value) {
+    insert(std::move(value));
+}
+
+void RpcResponseSax::Builder::key(const std::string& key) {
+    slot_ = &(*stack_.back())[key];
+}
+
+void RpcResponseSax::Builder::open(nlohmann::json&& container) {
+    stack_.push_back(insert(std::move(container)));
+}
+
+void RpcResponseSax::Builder::close() {
+    stack_.pop_back();
+}
+
+void RpcResponseSax::Builder::reset() {
+    root = nullptr;
+    stack_.clear();
+    slot_ = nullptr;
+}
+
+RpcResponseSax::RpcResponseSax(std::vector<std::string> streamedPaths, ElementCallback onElement)
+    : streamedPaths_(std::move(streamedPaths)), onElement_(std::move(onElement)) {
+    for (auto& path : streamedPaths_) {
+        path = "result/" + path;
+    }
+}
+
+nlohmann::json RpcResponseSax::takeResult() {
+    nlohmann::json& response = response_.root;
+    if (response.contains("error")) {
+        const auto& error = response["error"];
+        std::string message = error.is_object() && error.contains("message")
+            ? error["message"].get<std::string>() : error.dump();
+        throw RpcException("RPC error: " + message);
+    }
+    if (!response.is_object() || !response.contains("result")) {
+        throw RpcException("Invalid RPC response: missing result");
+    }
+    return std::move(response["result"]);
+}
+
+std::string RpcResponseSax::pathOf(const std::string& name) const {
+    std::string path;
+    for (const auto& part : names_) {
+        if (!part.empty()) {
+            path += part;
+            path += '/';
+        }
+    }
+    return path + name;
+}
+
+void RpcResponseSax::emitIfComplete() {
+    if (element_.depth() == 0) {
+        ++streamedElements_;
+        if (onElement_) {
+            onElement_(streamPath_, std::move(element_.root));
+        }
+        element_.reset();
+    }
+}
+
+void RpcResponseSax::value(nlohmann::json&& value) {
+    if (streaming_) {
+        element_.value(std::move(value));
+        emitIfComplete();
+    } else {
+        response_.value(std::move(value));
+    }
+}
+
+bool RpcResponseSax::null() {
+    value(nullptr);
+    return true;
+}
+
+bool RpcResponseSax::boolean(bool value) {
+    this->value(value);
+    return true;
+}
+
+bool RpcResponseSax::number_integer(number_integer_t value) {
+    this->value(value);
+    return true;
+}
+
+bool RpcResponseSax::number_unsigned(number_unsigned_t value) {
+    this->value(value);
+    return true;
+}
+
+bool RpcResponseSax::number_float(number_float_t value, const string_t&) {
+    this->value(value);
+    return true;
+}
+
+bool RpcResponseSax::string(string_t& value) {
+    this->value(std::move(value));
+    return true;
+}
+
+bool RpcResponseSax::binary(binary_t& value) {
+    this->value(nlohmann::json::binary(std::move(value)));
+    return true;
+}
+
+bool RpcResponseSax::start_object(std::size_t) {
+    if (streaming_) {
+        element_.open(nlohmann::json::object());
+        return true;
+    }
+    names_.push_back(response_.inObject() ? currentKey_ : std::string());
+    response_.open(nlohmann::json::object());
+    return true;
+}
+
+bool RpcResponseSax::key(string_t& key) {
+    if (streaming_) {
+        element_.key(key);
+    } else {
+        response_.key(key);
+        currentKey_ = key;
+    }
+    return true;
+}
+
+bool RpcResponseSax::end_object() {
+    if (streaming_) {
+        element_.close();
+        emitIfComplete();
+        return true;
+    }
+    response_.close();
+    names_.pop_back();
+    return true;
+}
+
+bool RpcResponseSax::start_array(std::size_t) {
+    if (streaming_) {
+        element_.open(nlohmann::json::array());
+        return true;
+    }
+    
+    std::string name = response_.inObject() ? currentKey_ : std::string();
+    if (!name.empty()) {
+        std::string path = pathOf(name);
+        if (std::find(streamedPaths_.begin(), streamedPaths_.end(), path) != streamedPaths_.end()) {
+            // Keep the array itself, empty, and divert its elements
+            streaming_ = true;
+            streamPath_ = path.substr(7);
+        }
+    }
+    names_.push_back(name);
+    response_.open(nlohmann::json::array());
+    return true;
+}
+
+bool RpcResponseSax::end_array() {
+    if (streaming_ && element_.depth() > 0) {
+        element_.close();
+        emitIfComplete();
+        return true;
+    }
+    streaming_ = false;
+    response_.close();
+    names_.pop_back();
+    return true;
+}
+
+bool RpcResponseSax::parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& error) {
+    throw RpcException("Failed to parse JSON response: " + std::string(error.what()));
+}
+
+} // namespace epicchaincpp
@@ -0,0 +1,1066 @@
+#include "epicchaincpp/protocol/subscription_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
+#include "epicchaincpp/utils/base64.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <future>
+#include <limits>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <openssl/err.h>
+#include <openssl/rand.h>
+#include <openssl/sha.h>
+#include <openssl/ssl.h>
+
+namespace epicchaincpp {
+
+namespace {
+
+/// Largest message accepted from the server
+constexpr size_t MAX_MESSAGE_SIZE = 64 * 1024 * 1024;
+
+/// How long the receive thread waits for data before checking for queued requests
+constexpr std::chrono::milliseconds RECEIVE_SLICE{200};
+
+/// Subscription ID used for the client's own block subscription
+constexpr size_t INTERNAL_SUBSCRIPTION = std::numeric_limits<size_t>::max();
+
+const char* const WEBSOCKET_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+enum Opcode : uint8_t {
+    CONTINUATION = 0x0,
+    TEXT = 0x1,
+    BINARY = 0x2,
+    CLOSE = 0x8,
+    PING = 0x9,
+    PONG = 0xA
+};
+
+std::string lowercase(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return text;
+}
+
+std::string openSslError() {
+    unsigned long code = ERR_get_error();
+    if (code == 0) {
+        return "unknown error";
+    }
+    char buffer[256];
+    ERR_error_string_n(code, buffer, sizeof(buffer));
+    return buffer;
+}
+
+/// Format a hash the way the node writes it in JSON
+template<typename Hash>
+std::string hashParam(const Hash& hash) {
+    return "0x" + hash.toString();
+}
+
+std::optional<SubscriptionEvent> eventFromName(const std::string& name) {
+    if (name == "block_added") return SubscriptionEvent::BlockAdded;
+    if (name == "transaction_added") return SubscriptionEvent::TransactionAdded;
+    if (name == "notification_from_execution") return SubscriptionEvent::NotificationFromExecution;
+    if (name == "transaction_executed") return SubscriptionEvent::TransactionExecuted;
+    return std::nullopt;
+}
+
+/// Split a ws:// or wss:// URL into its parts
+void parseUrl(const std::string& url, bool& secure, std::string& host, std::string& port, std::string& path) {
+    size_t schemeEnd = url.find("://");
+    if (schemeEnd == std::string::npos) {
+        throw IllegalArgumentException("Invalid WebSocket URL: " + url);
+    }
+    std::string scheme = lowercase(url.substr(0, schemeEnd));
+    if (scheme == "ws" || scheme == "http") {
+        secure = false;
+    } else if (scheme == "wss" || scheme == "https") {
+        secure = true;
+    } else {
+        throw IllegalArgumentException("Unsupported WebSocket scheme: " + scheme);
+    }
+    
+    size_t hostStart = schemeEnd + 3;
+    size_t pathStart = url.find_first_of("/?#", hostStart);
+    std::string authority = url.substr(hostStart, pathStart == std::string::npos ? std::string::npos : pathStart - hostStart);
+    path = pathStart == std::string::npos ? "/" : url.substr(pathStart);
+    if (path[0] != '/') {
+        path = "/" + path;
+    }
+    
+    size_t portStart = std::string::npos;
+    if (!authority.empty() && authority[0] == '[') {
+        size_t close = authority.find(']');
+        if (close == std::string::npos) {
+            throw IllegalArgumentException("Invalid WebSocket URL: " + url);
+        }
+        host = authority.substr(1, close - 1);
+        if (close + 1 < authority.size() && authority[close + 1] == ':') {
+            portStart = close + 2;
+        }
+    } else {
+        size_t colon = authority.rfind(':');
+        host = authority.substr(0, colon);
+        if (colon != std::string::npos) {
+            portStart = colon + 1;
+        }
+    }
+    port = portStart == std::string::npos ? (secure ? "443" : "80") : authority.substr(portStart);
+    if (host.empty()) {
+        throw IllegalArgumentException("Invalid WebSocket URL: " + url);
+    }
+}
+
+} // namespace
+
+std::string subscriptionEventName(SubscriptionEvent event) {
+    switch (event) {
+        case SubscriptionEvent::BlockAdded: return "block_added";
+        case SubscriptionEvent::TransactionAdded: return "transaction_added";
+        case SubscriptionEvent::NotificationFromExecution: return "notification_from_execution";
+        case SubscriptionEvent::TransactionExecuted: return "transaction_executed";
+    }
+    throw IllegalArgumentException("Unknown subscription event");
+}
+
+/// A client WebSocket connection (RFC 6455) over TCP, or TLS for wss:// URLs.
+/// All I/O happens on the subscription client's receive thread.
+class SubscriptionClient::Connection {
+public:
+    Connection(const std::string& url, std::chrono::milliseconds timeout)
+        : fd_(-1), ctx_(nullptr), ssl_(nullptr), timeout_(timeout) {
+        bool secure;
+        std::string host, port, path;
+        parseUrl(url, secure, host, port, path);
+        
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        try {
+            connectSocket(host, port, deadline);
+            if (secure) {
+                startTls(host, deadline);
+            }
+            handshake(host, port, secure, path, deadline);
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+    
+    ~Connection() {
+        release();
+    }
+    
+    Connection(const Connection&) = delete;
+    Connection& operator=(const Connection&) = delete;
+    
+    void sendText(const std::string& text) {
+        sendFrame(TEXT, text.data(), text.size());
+    }
+    
+    /// Wait for the next complete text or binary message
+    /// @return False if none arrived within the timeout
+    bool receive(std::string& message, std::chrono::milliseconds timeout) {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        for (;;) {
+            uint8_t opcode;
+            bool fin;
+            std::string payload;
+            while (takeFrame(opcode, fin, payload)) {
+                switch (opcode) {
+                    case CLOSE:
+                        close();
+                        throw RuntimeException("WebSocket closed by the server");
+                    case PING:
+                        sendFrame(PONG, payload.data(), payload.size());
+                        break;
+                    case PONG:
+                        break;
+                    case TEXT:
+                    case BINARY:
+                    case CONTINUATION:
+                        if (opcode == CONTINUATION) {
+                            fragments_ += payload;
+                        } else {
+                            fragments_ = std::move(payload);
+                        }
+                        if (fragments_.size() > MAX_MESSAGE_SIZE) {
+                            throw RuntimeException("WebSocket message too large");
+                        }
+                        if (fin) {
+                            message = std::move(fragments_);
+                            fragments_.clear();
+                            return true;
+                        }
+                        break;
+                    default:
+                        throw RuntimeException("Unknown WebSocket opcode " + std::to_string(opcode));
+                }
+            }
+            
+            char chunk[16384];
+            size_t received = readSome(chunk, sizeof(chunk));
+            if (received > 0) {
+                buffer_.append(chunk, received);
+                continue;
+            }
+            
+            auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                return false;
+            }
+            if (!(ssl_ && SSL_pending(ssl_) > 0) &&
+                !waitSocket(POLLIN, std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now))) {
+                return false;
+            }
+        }
+    }
+    
+    /// Send a close frame, ignoring failures
+    void close() {
+        if (closed_ || fd_ < 0) {
+            return;
+        }
+        closed_ = true;
+        try {
+            const char status[2] = {static_cast<char>(0x03), static_cast<char>(0xE8)};  // 1000: normal closure
+            sendFrame(CLOSE, status, sizeof(status));
+        } catch (...) {
+            // The connection is going away anyway
+        }
+    }
+
+private:
+    int fd_;
+    SSL_CTX* ctx_;
+    SSL* ssl_;
+    std::chrono::milliseconds timeout_;
+    std::string buffer_;
+    std::string fragments_;
+    bool closed_ = false;
+    
+    static std::chrono::milliseconds remaining(std::chrono::steady_clock::time_point deadline) {
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        return std::max(left, std::chrono::milliseconds(0));
+    }
+    
+    bool waitSocket(short events, std::chrono::milliseconds timeout) {
+        pollfd descriptor{fd_, events, 0};
+        int result;
+        do {
+            result = ::poll(&descriptor, 1, static_cast<int>(timeout.count()));
+        } while (result < 0 && errno == EINTR);
+        if (result < 0) {
+            throw RuntimeException(std::string("WebSocket poll failed: ") + std::strerror(errno));
+        }
+        return result > 0;
+    }
+    
+    void connectSocket(const std::string& host, const std::string& port, std::chrono::steady_clock::time_point deadline) {
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        addrinfo* addresses = nullptr;
+        int status = ::getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses);
+        if (status != 0) {
+            throw RuntimeException("Cannot resolve " + host + ": " + ::gai_strerror(status));
+        }
+        
+        std::string error = "no addresses";
+        for (addrinfo* address = addresses; address && fd_ < 0; address = address->ai_next) {
+            int fd = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+            if (fd < 0) {
+                error = std::strerror(errno);
+                continue;
+            }
+            // Non-blocking from here on, so every wait is bounded by poll()
+            ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+            
+            int result = ::connect(fd, address->ai_addr, address->ai_addrlen);
+            if (result < 0 && errno == EINPROGRESS) {
+                fd_ = fd;
+                if (waitSocket(POLLOUT, remaining(deadline))) {
+                    int socketError = 0;
+                    socklen_t length = sizeof(socketError);
+                    ::getsockopt(fd, SOL_SOCKET, SO_ERROR, &socketError, &length);
+                    result = socketError == 0 ? 0 : -1;
+                    errno = socketError;
+                } else {
+                    errno = ETIMEDOUT;
+                }
+                fd_ = -1;
+            }
+            if (result == 0) {
+                fd_ = fd;
+            } else {
+                error = std::strerror(errno);
+                ::close(fd);
+            }
+        }
+        ::freeaddrinfo(addresses);
+        
+        if (fd_ < 0) {
+            throw RuntimeException("Cannot connect to " + host + ":" + port + ": " + error);
+        }
+        int noDelay = 1;
+        ::setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    }
+    
+    void startTls(const std::string& host, std::chrono::steady_clock::time_point deadline) {
+        ctx_ = SSL_CTX_new(TLS_client_method());
+        if (!ctx_) {
+            throw RuntimeException("Cannot create TLS context: " + openSslError());
+        }
+        SSL_CTX_set_default_verify_paths(ctx_);
+        SSL_CTX_set_verify(ctx_, SSL_VERIFY_PEER, nullptr);
+        
+        ssl_ = SSL_new(ctx_);
+        if (!ssl_ || SSL_set_fd(ssl_, fd_) != 1) {
+            throw RuntimeException("Cannot create TLS session: " + openSslError());
+        }
+        SSL_set_tlsext_host_name(ssl_, host.c_str());
+        SSL_set1_host(ssl_, host.c_str());
+        
+        for (;;) {
+            int result = SSL_connect(ssl_);
+            if (result == 1) {
+                return;
+            }
+            int error = SSL_get_error(ssl_, result);
+            short events = error == SSL_ERROR_WANT_READ ? POLLIN : error == SSL_ERROR_WANT_WRITE ? POLLOUT : 0;
+            if (events == 0) {
+                throw RuntimeException("TLS handshake with " + host + " failed: " + openSslError());
+            }
+            if (!waitSocket(events, remaining(deadline))) {
+                throw RuntimeException("TLS handshake with " + host + " timed out");
+            }
+        }
+    }
+    
+    void handshake(const std::string& host, const std::string& port, bool secure, const std::string& path,
+                   std::chrono::steady_clock::time_point deadline) {
+        Bytes nonce(16);
+        RAND_bytes(nonce.data(), static_cast<int>(nonce.size()));
+        std::string key = Base64::encode(nonce);
+        
+        bool defaultPort = port == (secure ? "443" : "80");
+        std::string hostHeader = host.find(':') != std::string::npos ? "[" + host + "]" : host;
+        if (!defaultPort) {
+            hostHeader += ":" + port;
+        }
+        std::string request = "GET " + path + " HTTP/1.1\r\n"
+                              "Host: " + hostHeader + "\r\n"
+                              "Upgrade: websocket\r\n"
+                              "Connection: Upgrade\r\n"
+                              "Sec-WebSocket-Key: " + key + "\r\n"
+                              "Sec-WebSocket-Version: 13\r\n\r\n";
+        writeAll(request.data(), request.size());
+        
+        size_t headerEnd;
+        while ((headerEnd = buffer_.find("\r\n\r\n")) == std::string::npos) {
+            if (buffer_.size() > 16384) {
+                throw RuntimeException("WebSocket handshake response too large");
+            }
+            char chunk[4096];
+            size_t received = readSome(chunk, sizeof(chunk));
+            if (received > 0) {
+                buffer_.append(chunk, received);
+            } else if (!(ssl_ && SSL_pending(ssl_) > 0) && !waitSocket(POLLIN, remaining(deadline))) {
+                throw RuntimeException("WebSocket handshake timed out");
+            }
+        }
+        
+        std::string response = buffer_.substr(0, headerEnd);
+        buffer_.erase(0, headerEnd + 4);
+        
+        size_t lineEnd = response.find("\r\n");
+        std::string statusLine = response.substr(0, lineEnd);
+        if (statusLine.compare(0, 5, "HTTP/") != 0 || statusLine.find(" 101") == std::string::npos) {
+            throw RuntimeException("WebSocket upgrade rejected: " + statusLine);
+        }
+        
+        std::string expected = key + WEBSOCKET_GUID;
+        Bytes digest(SHA_DIGEST_LENGTH);
+        SHA1(reinterpret_cast<const unsigned char*>(expected.data()), expected.size(), digest.data());
+        std::string accept;
+        std::string lowered = lowercase(response);
+        size_t header = lowered.find("\r\nsec-websocket-accept:");
+        if (header != std::string::npos) {
+            size_t valueStart = response.find_first_not_of(' ', header + 23);
+            size_t valueEnd = response.find("\r\n", valueStart);
+            accept = response.substr(valueStart, valueEnd == std::string::npos ? std::string::npos : valueEnd - valueStart);
+            accept.erase(accept.find_last_not_of(" \t") + 1);
+        }
+        if (accept != Base64::encode(digest)) {
+            throw RuntimeException("WebSocket handshake failed: bad Sec-WebSocket-Accept");
+        }
+    }
+    
+    /// Read what is available without blocking
+    /// @return The number of bytes read, 0 if none are available yet
+    size_t readSome(char* data, size_t size) {
+        if (ssl_) {
+            int result = SSL_read(ssl_, data, static_cast<int>(size));
+            if (result > 0) {
+                return static_cast<size_t>(result);
+            }
+            int error = SSL_get_error(ssl_, result);
+            if (error == SSL_ERROR_WANT_READ || error == SSL_ERROR_WANT_WRITE) {
+                return 0;
+            }
+            if (error == SSL_ERROR_ZERO_RETURN) {
+                throw RuntimeException("WebSocket connection closed");
+            }
+            throw RuntimeException("WebSocket read failed: " + openSslError());
+        }
+        
+        ssize_t result = ::recv(fd_, data, size, 0);
+        if (result > 0) {
+            return static_cast<size_t>(result);
+        }
+        if (result == 0) {
+            throw RuntimeException("WebSocket connection closed");
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+            return 0;
+        }
+        throw RuntimeException(std::string("WebSocket read failed: ") + std::strerror(errno));
+    }
+    
+    void writeAll(const char* data, size_t size) {
+        auto deadline = std::chrono::steady_clock::now() + timeout_;
+        while (size > 0) {
+            short waitFor = POLLOUT;
+            if (ssl_) {
+                int result = SSL_write(ssl_, data, static_cast<int>(size));
+                if (result > 0) {
+                    data += result;
+                    size -= static_cast<size_t>(result);
+                    continue;
+                }
+                int error = SSL_get_error(ssl_, result);
+                if (error == SSL_ERROR_WANT_READ) {
+                    waitFor = POLLIN;
+                } else if (error != SSL_ERROR_WANT_WRITE) {
+                    throw RuntimeException("WebSocket write failed: " + openSslError());
+                }
+            } else {
+                ssize_t result = ::send(fd_, data, size, MSG_NOSIGNAL);
+                if (result > 0) {
+                    data += result;
+                    size -= static_cast<size_t>(result);
+                    continue;
+                }
+                if (result < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                    throw RuntimeException(std::string("WebSocket write failed: ") + std::strerror(errno));
+                }
+            }
+            if (!waitSocket(waitFor, remaining(deadline))) {
+                throw RuntimeException("WebSocket write timed out");
+            }
+        }
+    }
+    
+    void sendFrame(uint8_t opcode, const char* payload, size_t size) {
+        // Client frames are always masked
+        std::string frame;
+        frame.reserve(size + 14);
+        frame.push_back(static_cast<char>(0x80 | opcode));
+        if (size < 126) {
+            frame.push_back(static_cast<char>(0x80 | size));
+        } else if (size <= 0xFFFF) {
+            frame.push_back(static_cast<char>(0x80 | 126));
+            frame.push_back(static_cast<char>(size >> 8));
+            frame.push_back(static_cast<char>(size));
+        } else {
+            frame.push_back(static_cast<char>(0x80 | 127));
+            for (int shift = 56; shift >= 0; shift -= 8) {
+                frame.push_back(static_cast<char>(static_cast<uint64_t>(size) >> shift));
+            }
+        }
+        
+        uint8_t mask[4];
+        RAND_bytes(mask, sizeof(mask));
+        frame.append(reinterpret_cast<const char*>(mask), sizeof(mask));
+        size_t offset = frame.size();
+        frame.append(payload, size);
+        for (size_t i = 0; i < size; ++i) {
+            frame[offset + i] = static_cast<char>(frame[offset + i] ^ mask[i & 3]);
+        }
+        writeAll(frame.data(), frame.size());
+    }
+    
+    /// Remove one complete frame from the read buffer
+    /// @return False if the buffer does not hold a complete frame yet
+    bool takeFrame(uint8_t& opcode, bool& fin, std::string& payload) {
+        if (buffer_.size() < 2) {
+            return false;
+        }
+        const auto* bytes = reinterpret_cast<const uint8_t*>(buffer_.data());
+        fin = (bytes[0] & 0x80) != 0;
+        opcode = bytes[0] & 0x0F;
+        bool masked = (bytes[1] & 0x80) != 0;
+        uint64_t length = bytes[1] & 0x7F;
+        size_t headerSize = 2;
+        
+        if (length == 126) {
+            if (buffer_.size() < 4) return false;
+            length = (static_cast<uint64_t>(bytes[2]) << 8) | bytes[3];
+            headerSize = 4;
+        } else if (length == 127) {
+            if (buffer_.size() < 10) return false;
+            length = 0;
+            for (int i = 2; i < 10; ++i) {
+                length = (length << 8) | bytes[i];
+            }
+            headerSize = 10;
+        }
+        if (length > MAX_MESSAGE_SIZE) {
+            throw RuntimeException("WebSocket message too large");
+        }
+        
+        size_t maskOffset = headerSize;
+        if (masked) {
+            headerSize += 4;
+        }
+        if (buffer_.size() < headerSize + length) {
+            return false;
+        }
+        
+        payload.assign(buffer_, headerSize, static_cast<size_t>(length));
+        if (masked) {
+            for (size_t i = 0; i < payload.size(); ++i) {
+                payload[i] = static_cast<char>(payload[i] ^ bytes[maskOffset + (i & 3)]);
+            }
+        }
+        buffer_.erase(0, headerSize + static_cast<size_t>(length));
+        return true;
+    }
+    
+    void release() {
+        if (ssl_) {
+            SSL_free(ssl_);
+            ssl_ = nullptr;
+        }
+        if (ctx_) {
+            SSL_CTX_free(ctx_);
+            ctx_ = nullptr;
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+};
+
+SubscriptionClient::SubscriptionClient(const std::string& url, const SharedPtr<EpicChainRpcClient>& rpcClient,
+                                       const SubscriptionClientConfig& config)
+    : url_(url), rpcClient_(rpcClient), config_(config), nextSubscriptionId_(0), nextRequestId_(1),
+      running_(false), connected_(false), nextBlockIndex_(0), hasNextBlock_(false),
+      holdingEvents_(false) {
+    // Reject a malformed URL here rather than retrying it forever
+    bool secure;
+    std::string host, port, path;
+    parseUrl(url_, secure, host, port, path);
+}
+
+SubscriptionClient::~SubscriptionClient() {
+    stop();
+}
+
+void SubscriptionClient::start() {
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    thread_ = std::make_unique<std::thread>(&SubscriptionClient::run, this);
+}
+
+void SubscriptionClient::start(uint32_t startIndex) {
+    if (!rpcClient_) {
+        throw IllegalStateException("Starting from a block index requires an RPC client");
+    }
+    if (running_) {
+        return;
+    }
+    nextBlockIndex_ = startIndex;
+    hasNextBlock_ = true;
+    start();
+}
+
+void SubscriptionClient::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    wakeUp_.notify_all();
+    if (thread_ && thread_->joinable()) {
+        thread_->join();
+    }
+    thread_.reset();
+}
+
+size_t SubscriptionClient::subscribeBlocks(BlockCallback callback, const BlockFilter& filter) {
+    nlohmann::json params = nlohmann::json::object();
+    if (filter.primary) {
+        params["primary"] = *filter.primary;
+    }
+    
+    auto matches = [filter](const nlohmann::json& block) {
+        return !filter.primary || block.value("primary", -1) == *filter.primary;
+    };
+    auto handler = [callback = std::move(callback)](const nlohmann::json& block) {
+        BlockAddedEvent event;
+        event.index = block.at("index").get<uint32_t>();
+        event.hash = Hash256(block.at("hash").get<std::string>());
+        event.block = block;
+        callback(event);
+    };
+    return addSubscription(SubscriptionEvent::BlockAdded, std::move(params), matches, handler);
+}
+
+size_t SubscriptionClient::subscribeTransactions(TransactionCallback callback, const TransactionFilter& filter) {
+    nlohmann::json params = nlohmann::json::object();
+    if (filter.sender) {
+        params["sender"] = hashParam(*filter.sender);
+    }
+    if (filter.signer) {
+        params["signer"] = hashParam(*filter.signer);
+    }
+    
+    auto matches = [filter](const nlohmann::json& transaction) {
+        if (!transaction.contains("signers") || !transaction["signers"].is_array()) {
+            return !filter.sender && !filter.signer;
+        }
+        const auto& signers = transaction["signers"];
+        // The sender is the first signer
+        if (filter.sender && (signers.empty() || Hash160(signers[0].value("account", "")) != *filter.sender)) {
+            return false;
+        }
+        if (filter.signer) {
+            return std::any_of(signers.begin(), signers.end(), [&filter](const nlohmann::json& signer) {
+                return Hash160(signer.value("account", "")) == *filter.signer;
+            });
+        }
+        return true;
+    };
+    auto handler = [callback = std::move(callback)](const nlohmann::json& transaction) {
+        TransactionAddedEvent event;
+        event.hash = Hash256(transaction.at("hash").get<std::string>());
+        event.transaction = transaction;
+        callback(event);
+    };
+    return addSubscription(SubscriptionEvent::TransactionAdded, std::move(params), matches, handler);
+}
+
+size_t SubscriptionClient::subscribeNotifications(NotificationCallback callback, const NotificationFilter& filter) {
+    nlohmann::json params = nlohmann::json::object();
+    if (filter.contract) {
+        params["contract"] = hashParam(*filter.contract);
+    }
+    if (filter.name) {
+        params["name"] = *filter.name;
+    }
+    
+    auto matches = [filter](const nlohmann::json& notification) {
+        if (filter.contract && Hash160(notification.value("contract", "")) != *filter.contract) {
+            return false;
+        }
+        return !filter.name || notification.value("eventname", "") == *filter.name;
+    };
+    auto handler = [callback = std::move(callback)](const nlohmann::json& notification) {
+        ExecutionNotificationEvent event;
+        event.container = Hash256(notification.at("container").get<std::string>());
+        event.contract = Hash160(notification.at("contract").get<std::string>());
+        event.eventName = notification.value("eventname", "");
+        event.state = notification.value("state", nlohmann::json());
+        callback(event);
+    };
+    return addSubscription(SubscriptionEvent::NotificationFromExecution, std::move(params), matches, handler);
+}
+
+size_t SubscriptionClient::subscribeExecutions(ExecutionCallback callback, const ExecutionFilter& filter) {
+    nlohmann::json params = nlohmann::json::object();
+    if (filter.vmState) {
+        params["state"] = *filter.vmState;
+    }
+    if (filter.container) {
+        params["container"] = hashParam(*filter.container);
+    }
+    
+    auto matches = [filter](const nlohmann::json& execution) {
+        if (filter.vmState && execution.value("vmstate", "") != *filter.vmState) {
+            return false;
+        }
+        return !filter.container || Hash256(execution.value("container", "")) == *filter.container;
+    };
+    auto handler = [callback = std::move(callback)](const nlohmann::json& execution) {
+        TransactionExecutedEvent event;
+        event.container = Hash256(execution.at("container").get<std::string>());
+        event.vmState = execution.value("vmstate", "");
+        event.execution = execution;
+        callback(event);
+    };
+    return addSubscription(SubscriptionEvent::TransactionExecuted, std::move(params), matches, handler);
+}
+
+size_t SubscriptionClient::addSubscription(SubscriptionEvent event, nlohmann::json filter,
+                                           std::function<bool(const nlohmann::json&)> matches,
+                                           std::function<void(const nlohmann::json&)> handler) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t id = nextSubscriptionId_++;
+    subscriptions_[id] = {event, filter, std::move(matches), std::move(handler), ""};
+    if (connected_) {
+        nlohmann::json params = nlohmann::json::array({subscriptionEventName(event)});
+        if (!filter.empty()) {
+            params.push_back(filter);
+        }
+        auto request = makeRequest("subscribe", params);
+        pendingSubscribes_[request["id"].get<int>()] = id;
+        outbox_.push_back(std::move(request));
+    }
+    return id;
+}
+
+void SubscriptionClient::unsubscribe(size_t subscriptionId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = subscriptions_.find(subscriptionId);
+    if (it == subscriptions_.end()) {
+        return;
+    }
+    if (connected_ && !it->second.serverId.empty()) {
+        outbox_.push_back(makeRequest("unsubscribe", nlohmann::json::array({it->second.serverId})));
+    }
+    subscriptions_.erase(it);
+}
+
+void SubscriptionClient::setErrorCallback(ErrorCallback callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    errorCallback_ = std::move(callback);
+}
+
+nlohmann::json SubscriptionClient::makeRequest(const std::string& method, const nlohmann::json& params) {
+    return {
+        {"jsonrpc", "2.0"},
+        {"method", method},
+        {"params", params},
+        {"id", nextRequestId_++}
+    };
+}
+
+void SubscriptionClient::reportError(const std::string& message) {
+    ErrorCallback callback;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callback = errorCallback_;
+    }
+    if (callback) {
+        try {
+            callback(message);
+        } catch (...) {
+            // Ignore callback errors
+        }
+    }
+}
+
+void SubscriptionClient::run() {
+    // Writes to a socket the server already closed must fail, not kill the process
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+    
+    auto delay = config_.reconnectDelay;
+    while (running_) {
+        try {
+            Connection connection(url_, config_.requestTimeout);
+            delay = config_.reconnectDelay;
+            session(connection);
+            connection.close();
+        } catch (const std::exception& e) {
+            reportError(e.what());
+        }
+        connected_ = false;
+        
+        std::unique_lock<std::mutex> lock(mutex_);
+        wakeUp_.wait_for(lock, delay, [this]() { return !running_; });
+        delay = std::min(delay * 2, config_.maxReconnectDelay);
+    }
+}
+
+void SubscriptionClient::session(Connection& connection) {
+    subscribeAll(connection);
+    
+    // Wait for the subscriptions to be confirmed. Events arriving meanwhile
+    // are kept until the catch-up has delivered everything before them.
+    std::vector<nlohmann::json> early;
+    auto deadline = std::chrono::steady_clock::now() + config_.requestTimeout;
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (pendingSubscribes_.empty()) {
+                break;
+            }
+        }
+        if (!running_) {
+            return;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            throw RuntimeException("Subscription requests timed out");
+        }
+        
+        sendQueued(connection);
+        std::string text;
+        auto wait = std::min(RECEIVE_SLICE, std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now));
+        if (connection.receive(text, wait)) {
+            auto message = nlohmann::json::parse(text);
+            if (message.contains("id") && !message["id"].is_null()) {
+                handleMessage(message);
+            } else {
+                early.push_back(std::move(message));
+            }
+        }
+    }
+    
+    heldEvents_.clear();
+    holdingEvents_ = rpcClient_ && hasNextBlock_;
+    catchUp();
+    for (const auto& message : early) {
+        handleMessage(message);
+    }
+    
+    while (running_) {
+        sendQueued(connection);
+        std::string text;
+        if (connection.receive(text, RECEIVE_SLICE)) {
+            handleMessage(nlohmann::json::parse(text));
+        }
+    }
+}
+
+void SubscriptionClient::subscribeAll(Connection& connection) {
+    std::vector<nlohmann::json> requests;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Requests queued for the previous connection are superseded
+        outbox_.clear();
+        pendingSubscribes_.clear();
+        
+        if (rpcClient_) {
+            // Blocks are always followed when catching up, to track the height
+            auto request = makeRequest("subscribe", nlohmann::json::array({subscriptionEventName(SubscriptionEvent::BlockAdded)}));
+            pendingSubscribes_[request["id"].get<int>()] = INTERNAL_SUBSCRIPTION;
+            requests.push_back(std::move(request));
+        }
+        for (auto& [id, subscription] : subscriptions_) {
+            subscription.serverId.clear();
+            nlohmann::json params = nlohmann::json::array({subscriptionEventName(subscription.event)});
+            if (!subscription.filter.empty()) {
+                params.push_back(subscription.filter);
+            }
+            auto request = makeRequest("subscribe", params);
+            pendingSubscribes_[request["id"].get<int>()] = id;
+            requests.push_back(std::move(request));
+        }
+        connected_ = true;
+    }
+    
+    for (const auto& request : requests) {
+        connection.sendText(request.dump());
+    }
+}
+
+void SubscriptionClient::sendQueued(Connection& connection) {
+    std::deque<nlohmann::json> requests;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        requests.swap(outbox_);
+    }
+    for (const auto& request : requests) {
+        connection.sendText(request.dump());
+    }
+}
+
+void SubscriptionClient::catchUp() {
+    if (!rpcClient_ || !hasNextBlock_) {
+        return;
+    }
+    
+    bool wantsExecutions = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& [id, subscription] : subscriptions_) {
+            if (subscription.event == SubscriptionEvent::NotificationFromExecution ||
+                subscription.event == SubscriptionEvent::TransactionExecuted) {
+                wantsExecutions = true;
+            }
+        }
+    }
+    
+    uint32_t blockCount = rpcClient_->getBlockCount();
+    while (running_ && nextBlockIndex_ < blockCount) {
+        uint32_t index = nextBlockIndex_;
+        nlohmann::json block = rpcClient_->sendRequest("getblock", nlohmann::json::array({index, true}));
+        
+        if (wantsExecutions) {
+            // Request all logs of the block at once, then replay them in execution order:
+            // OnPersist, the transactions, PostPersist
+            auto blockLog = rpcClient_->sendRequestAsync("getapplicationlog", nlohmann::json::array({block["hash"]}));
+            std::vector<std::future<nlohmann::json>> transactionLogs;
+            if (block.contains("tx")) {
+                for (const auto& tx : block["tx"]) {
+                    transactionLogs.push_back(rpcClient_->sendRequestAsync("getapplicationlog", nlohmann::json::array({tx["hash"]})));
+                }
+            }
+            
+            auto replay = [this](const nlohmann::json& log, const std::string& container, const char* trigger) {
+                for (const auto& execution : log.value("executions", nlohmann::json::array())) {
+                    if (trigger && execution.value("trigger", "") != trigger) {
+                        continue;
+                    }
+                    for (const auto& notification : execution.value("notifications", nlohmann::json::array())) {
+                        dispatch(SubscriptionEvent::NotificationFromExecution, {
+                            {"container", container},
+                            {"contract", notification.value("contract", "")},
+                            {"eventname", notification.value("eventname", "")},
+                            {"state", notification.value("state", nlohmann::json())}
+                        });
+                    }
+                    nlohmann::json executed = execution;
+                    executed["container"] = container;
+                    dispatch(SubscriptionEvent::TransactionExecuted, executed);
+                }
+            };
+            
+            nlohmann::json persistLog = blockLog.get();
+            std::string blockHash = block.value("hash", "");
+            replay(persistLog, blockHash, "OnPersist");
+            for (auto& transactionLog : transactionLogs) {
+                nlohmann::json log = transactionLog.get();
+                replay(log, log.value("txid", ""), nullptr);
+            }
+            replay(persistLog, blockHash, "PostPersist");
+        }
+        
+        dispatch(SubscriptionEvent::BlockAdded, block);
+        nextBlockIndex_ = index + 1;
+    }
+}
+
+void SubscriptionClient::handleMessage(const nlohmann::json& message) {
+    if (message.contains("id") && !message["id"].is_null()) {
+        // Response to a subscribe or unsubscribe request
+        int requestId = message["id"].get<int>();
+        std::string failure;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto pending = pendingSubscribes_.find(requestId);
+            if (pending == pendingSubscribes_.end()) {
+                return;
+            }
+            size_t subscriptionId = pending->second;
+            pendingSubscribes_.erase(pending);
+            
+            if (message.contains("error")) {
+                failure = "Subscription failed: " + message["error"].value("message", message["error"].dump());
+            } else if (message.contains("result") && message["result"].is_string()) {
+                std::string serverId = message["result"].get<std::string>();
+                auto subscription = subscriptions_.find(subscriptionId);
+                if (subscription != subscriptions_.end()) {
+                    subscription->second.serverId = serverId;
+                } else if (subscriptionId != INTERNAL_SUBSCRIPTION) {
+                    // Unsubscribed while the request was in flight
+                    outbox_.push_back(makeRequest("unsubscribe", nlohmann::json::array({serverId})));
+                }
+            }
+        }
+        if (!failure.empty()) {
+            reportError(failure);
+        }
+        return;
+    }
+    
+    std::string method = message.value("method", "");
+    if (method == "event_missed") {
+        // The server dropped events for this connection; reconnect and catch up
+        throw RuntimeException("Subscription server reported missed events");
+    }
+    auto event = eventFromName(method);
+    if (!event || !message.contains("params") || !message["params"].is_array() || message["params"].empty()) {
+        return;
+    }
+    handleEvent(*event, message["params"][0]);
+}
+
+void SubscriptionClient::handleEvent(SubscriptionEvent event, const nlohmann::json& payload) {
+    if (event == SubscriptionEvent::BlockAdded) {
+        uint32_t index = payload.value("index", 0u);
+        if (hasNextBlock_ && index < nextBlockIndex_) {
+            // Already delivered by the catch-up, together with its executions
+            heldEvents_.clear();
+            return;
+        }
+        
+        holdingEvents_ = false;
+        std::vector<std::pair<SubscriptionEvent, nlohmann::json>> held;
+        held.swap(heldEvents_);
+        for (const auto& [heldEvent, heldPayload] : held) {
+            dispatch(heldEvent, heldPayload);
+        }
+        dispatch(event, payload);
+        nextBlockIndex_ = index + 1;
+        hasNextBlock_ = true;
+        return;
+    }
+    
+    // Executions precede their block_added, so until a new block arrives
+    // they may belong to a block the catch-up already delivered
+    if (holdingEvents_ && event != SubscriptionEvent::TransactionAdded) {
+        heldEvents_.emplace_back(event, payload);
+        return;
+    }
+    dispatch(event, payload);
+}
+
+void SubscriptionClient::dispatch(SubscriptionEvent event, const nlohmann::json& payload) {
+    std::vector<std::function<void(const nlohmann::json&)>> handlers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& [id, subscription] : subscriptions_) {
+            if (subscription.event != event) {
+                continue;
+            }
+            try {
+                if (subscription.matches(payload)) {
+                    handlers.push_back(subscription.handler);
+                }
+            } catch (const std::exception&) {
+                // A malformed event matches nothing
+            }
+        }
+    }
+    
+    for (const auto& handler : handlers) {
+        try {
+            handler(payload);
+        } catch (...) {
+            // Ignore callback errors
+        }
+    }
+}
+
+} // namespace epicchaincpp
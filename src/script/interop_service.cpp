@@ -0,0 +1,105 @@
+#include "epicchaincpp/script/interop_service.hpp"
+#include "epicchaincpp/crypto/hash.hpp"
+#include "epicchaincpp/types/types.hpp"
+#include <mutex>
+#include <unordered_map>
+
+namespace epicchaincpp {
+
+const std::string InteropService::SYSTEM_BINARY_ATOI = getName(InteropId::SYSTEM_BINARY_ATOI);
+const std::string InteropService::SYSTEM_BINARY_BASE58_DECODE = getName(InteropId::SYSTEM_BINARY_BASE58_DECODE);
+const std::string InteropService::SYSTEM_BINARY_BASE58_ENCODE = getName(InteropId::SYSTEM_BINARY_BASE58_ENCODE);
+const std::string InteropService::SYSTEM_BINARY_BASE64_DECODE = getName(InteropId::SYSTEM_BINARY_BASE64_DECODE);
+const std::string InteropService::SYSTEM_BINARY_BASE64_ENCODE = getName(InteropId::SYSTEM_BINARY_BASE64_ENCODE);
+const std::string InteropService::SYSTEM_BINARY_DESERIALIZE = getName(InteropId::SYSTEM_BINARY_DESERIALIZE);
+const std::string InteropService::SYSTEM_BINARY_ITOA = getName(InteropId::SYSTEM_BINARY_ITOA);
+const std::string InteropService::SYSTEM_BINARY_SERIALIZE = getName(InteropId::SYSTEM_BINARY_SERIALIZE);
+
+const std::string InteropService::SYSTEM_CONTRACT_CALL = getName(InteropId::SYSTEM_CONTRACT_CALL);
+const std::string InteropService::SYSTEM_CONTRACT_CALL_NATIVE = getName(InteropId::SYSTEM_CONTRACT_CALL_NATIVE);
+const std::string InteropService::SYSTEM_CONTRACT_CREATE = getName(InteropId::SYSTEM_CONTRACT_CREATE);
+const std::string InteropService::SYSTEM_CONTRACT_CREATE_MULTISIG_ACCOUNT = getName(InteropId::SYSTEM_CONTRACT_CREATE_MULTISIG_ACCOUNT);
+const std::string InteropService::SYSTEM_CONTRACT_CREATE_STANDARD_ACCOUNT = getName(InteropId::SYSTEM_CONTRACT_CREATE_STANDARD_ACCOUNT);
+const std::string InteropService::SYSTEM_CONTRACT_DESTROY = getName(InteropId::SYSTEM_CONTRACT_DESTROY);
+const std::string InteropService::SYSTEM_CONTRACT_GET_CALL_FLAGS = getName(InteropId::SYSTEM_CONTRACT_GET_CALL_FLAGS);
+const std::string InteropService::SYSTEM_CONTRACT_NativeOnPersist = getName(InteropId::SYSTEM_CONTRACT_NATIVE_ON_PERSIST);
+const std::string InteropService::SYSTEM_CONTRACT_NativePostPersist = getName(InteropId::SYSTEM_CONTRACT_NATIVE_POST_PERSIST);
+const std::string InteropService::SYSTEM_CONTRACT_UPDATE = getName(InteropId::SYSTEM_CONTRACT_UPDATE);
+
+const std::string InteropService::SYSTEM_CRYPTO_CHECK_MULTISIG = getName(InteropId::SYSTEM_CRYPTO_CHECK_MULTISIG);
+const std::string InteropService::SYSTEM_CRYPTO_CHECK_SIG = getName(InteropId::SYSTEM_CRYPTO_CHECK_SIG);
+const std::string InteropService::SYSTEM_CRYPTO_SHA256 = getName(InteropId::SYSTEM_CRYPTO_SHA256);
+const std::string InteropService::SYSTEM_CRYPTO_RIPEMD160 = getName(InteropId::SYSTEM_CRYPTO_RIPEMD160);
+
+const std::string InteropService::SYSTEM_ITERATOR_NEXT = getName(InteropId::SYSTEM_ITERATOR_NEXT);
+const std::string InteropService::SYSTEM_ITERATOR_VALUE = getName(InteropId::SYSTEM_ITERATOR_VALUE);
+
+const std::string InteropService::SYSTEM_RUNTIME_BURN_GAS = getName(InteropId::SYSTEM_RUNTIME_BURN_GAS);
+const std::string InteropService::SYSTEM_RUNTIME_CHECK_WITNESS = getName(InteropId::SYSTEM_RUNTIME_CHECK_WITNESS);
+const std::string InteropService::SYSTEM_RUNTIME_GAS_LEFT = getName(InteropId::SYSTEM_RUNTIME_GAS_LEFT);
+const std::string InteropService::SYSTEM_RUNTIME_GET_CALLING_SCRIPT_HASH = getName(InteropId::SYSTEM_RUNTIME_GET_CALLING_SCRIPT_HASH);
+const std::string InteropService::SYSTEM_RUNTIME_GET_ENTRY_SCRIPT_HASH = getName(InteropId::SYSTEM_RUNTIME_GET_ENTRY_SCRIPT_HASH);
+const std::string InteropService::SYSTEM_RUNTIME_GET_EXECUTING_SCRIPT_HASH = getName(InteropId::SYSTEM_RUNTIME_GET_EXECUTING_SCRIPT_HASH);
+const std::string InteropService::SYSTEM_RUNTIME_GET_INVOCATION_COUNTER = getName(InteropId::SYSTEM_RUNTIME_GET_INVOCATION_COUNTER);
+const std::string InteropService::SYSTEM_RUNTIME_GET_NETWORK = getName(InteropId::SYSTEM_RUNTIME_GET_NETWORK);
+const std::string InteropService::SYSTEM_RUNTIME_GET_NOTIFICATIONS = getName(InteropId::SYSTEM_RUNTIME_GET_NOTIFICATIONS);
+const std::string InteropService::SYSTEM_RUNTIME_GET_RANDOM = getName(InteropId::SYSTEM_RUNTIME_GET_RANDOM);
+const std::string InteropService::SYSTEM_RUNTIME_GET_TIME = getName(InteropId::SYSTEM_RUNTIME_GET_TIME);
+const std::string InteropService::SYSTEM_RUNTIME_GET_TRIGGER = getName(InteropId::SYSTEM_RUNTIME_GET_TRIGGER);
+const std::string InteropService::SYSTEM_RUNTIME_LOG = getName(InteropId::SYSTEM_RUNTIME_LOG);
+const std::string InteropService::SYSTEM_RUNTIME_NOTIFY = getName(InteropId::SYSTEM_RUNTIME_NOTIFY);
+const std::string InteropService::SYSTEM_RUNTIME_PLATFORM = getName(InteropId::SYSTEM_RUNTIME_PLATFORM);
+
+const std::string InteropService::SYSTEM_STORAGE_AS_READONLY = getName(InteropId::SYSTEM_STORAGE_AS_READONLY);
+const std::string InteropService::SYSTEM_STORAGE_DELETE = getName(InteropId::SYSTEM_STORAGE_DELETE);
+const std::string InteropService::SYSTEM_STORAGE_FIND = getName(InteropId::SYSTEM_STORAGE_FIND);
+const std::string InteropService::SYSTEM_STORAGE_GET = getName(InteropId::SYSTEM_STORAGE_GET);
+const std::string InteropService::SYSTEM_STORAGE_GET_CONTEXT = getName(InteropId::SYSTEM_STORAGE_GET_CONTEXT);
+const std::string InteropService::SYSTEM_STORAGE_GET_READONLY_CONTEXT = getName(InteropId::SYSTEM_STORAGE_GET_READONLY_CONTEXT);
+const std::string InteropService::SYSTEM_STORAGE_PUT = getName(InteropId::SYSTEM_STORAGE_PUT);
+
+namespace {
+
+/// Bound on cached hashes of names outside DESCRIPTORS
+const size_t MAX_CACHED_HASHES = 1024;
+
+} // namespace
+
+uint32_t InteropService::getHash(const std::string& service) {
+    static const std::unordered_map<std::string, uint32_t> known = []() {
+        std::unordered_map<std::string, uint32_t> map;
+        for (const auto& descriptor : DESCRIPTORS) {
+            map.emplace(descriptor.name, descriptor.hash);
+        }
+        return map;
+    }();
+    auto it = known.find(service);
+    if (it != known.end()) {
+        return it->second;
+    }
+    
+    static std::mutex mutex;
+    static std::unordered_map<std::string, uint32_t> cache;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto cached = cache.find(service);
+    if (cached != cache.end()) {
+        return cached->second;
+    }
+    if (cache.size() >= MAX_CACHED_HASHES) {
+        cache.clear();
+    }
+    uint32_t hash = computeHash(service);
+    cache.emplace(service, hash);
+    return hash;
+}
+
+uint32_t InteropService::computeHash(const std::string& service) {
+    Bytes hash = HashUtils::sha256(Bytes(service.begin(), service.end()));
+    uint32_t result = 0;
+    for (int i = 0; i < 4; ++i) {
+        result |= static_cast<uint32_t>(hash[i]) << (i * 8);
+    }
+    return result;
+}
+
+} // namespace epicchaincpp
@@ -2,7 +2,6 @@
 #include "epicchaincpp/types/hash160.hpp"
 #include "epicchaincpp/types/contract_parameter.hpp"
 #include "epicchaincpp/crypto/ec_key_pair.hpp"
-#include "epicchaincpp/crypto/hash.hpp"
 #include "epicchaincpp/exceptions.hpp"
 #include <algorithm>
 #include <cstring>
@@ -144,12 +143,55 @@ ScriptBuilder& ScriptBuilder::callContract(const Hash160& scriptHash, const std:
     pushData(scriptHash.toLittleEndianArray());
     
     // Emit SYSCALL with System.Contract.Call
-    return emitSysCall("System.Contract.Call");
+    return emitSysCall(InteropId::SYSTEM_CONTRACT_CALL);
+}
+
+ScriptBuilder& ScriptBuilder::callContractAndUnwrapIterator(const Hash160& scriptHash, const std::string& method,
+                                                            const std::vector<ContractParameter>& parameters,
+                                                            int maxItems) {
+    if (maxItems <= 0) {
+        throw IllegalArgumentException("Maximum number of iterator items must be positive");
+    }
+    
+    pushInteger(maxItems);                              // [max]
+    callContract(scriptHash, method, parameters);       // [iterator, max]
+    emit(OpCode::NEWARRAY0);                            // [array, iterator, max]
+    
+    size_t loopStart = script_.size();
+    emit(OpCode::OVER);                                 // [iterator, array, iterator, max]
+    emitSysCall(InteropId::SYSTEM_ITERATOR_NEXT);       // [hasNext, array, iterator, max]
+    size_t exitJump = script_.size();
+    emitJump(OpCode::JMPIFNOT, 0);                      // [array, iterator, max]
+    emit(OpCode::DUP);                                  // [array, array, iterator, max]
+    pushInteger(2);
+    emit(OpCode::PICK);                                 // [iterator, array, array, iterator, max]
+    emitSysCall(InteropId::SYSTEM_ITERATOR_VALUE);      // [value, array, array, iterator, max]
+    emit(OpCode::APPEND);                               // [array, iterator, max]
+    emit(OpCode::DUP);
+    emit(OpCode::SIZE);                                 // [size, array, iterator, max]
+    pushInteger(3);
+    emit(OpCode::PICK);                                 // [max, size, array, iterator, max]
+    emit(OpCode::GE);                                   // [full, array, iterator, max]
+    size_t loopJump = script_.size();
+    emitJump(OpCode::JMPIFNOT, static_cast<int>(loopStart) - static_cast<int>(loopJump));
+    
+    // Jump offsets are relative to the jump instruction itself
+    script_[exitJump + 1] = static_cast<uint8_t>(script_.size() - exitJump);
+    emit(OpCode::NIP);
+    emit(OpCode::NIP);                                  // [array]
+    return *this;
 }
 
 ScriptBuilder& ScriptBuilder::emitSysCall(const std::string& interopService) {
+    return emitSysCallHash(InteropService::getHash(interopService));
+}
+
+ScriptBuilder& ScriptBuilder::emitSysCall(InteropId interopService) {
+    return emitSysCallHash(InteropService::getHash(interopService));
+}
+
+ScriptBuilder& ScriptBuilder::emitSysCallHash(uint32_t hash) {
     emit(OpCode::SYSCALL);
-    uint32_t hash = getInteropServiceHash(interopService);
     for (int i = 0; i < 4; ++i) {
         script_.push_back((hash >> (i * 8)) & 0xFF);
     }
@@ -184,7 +226,7 @@ Bytes ScriptBuilder::toArray() const {
 Bytes ScriptBuilder::buildVerificationScript(const Bytes& encodedPublicKey) {
     ScriptBuilder builder;
     builder.pushData(encodedPublicKey);
-    builder.emitSysCall("System.Crypto.CheckSig");
+    builder.emitSysCall(InteropId::SYSTEM_CRYPTO_CHECK_SIG);
     return builder.toArray();
 }
 
@@ -223,7 +265,7 @@ Bytes ScriptBuilder::buildVerificationScript(const std::vector<SharedPtr<ECPubli
     builder.pushInteger(sortedKeys.size());
     
     // Emit CheckMultiSig
-    builder.emitSysCall("System.Crypto.CheckMultiSig");
+    builder.emitSysCall(InteropId::SYSTEM_CRYPTO_CHECK_MULTISIG);
     
     return builder.toArray();
 }
@@ -278,17 +320,4 @@ void ScriptBuilder::emitPushData(const Bytes& data) {
     script_.insert(script_.end(), data.begin(), data.end());
 }
 
-uint32_t ScriptBuilder::getInteropServiceHash(const std::string& method) {
-    // Calculate SHA256 hash of the method name and take first 4 bytes
-    Bytes methodBytes(method.begin(), method.end());
-    Bytes hash = HashUtils::sha256(methodBytes);
-    
-    uint32_t result = 0;
-    for (int i = 0; i < 4; ++i) {
-        result |= static_cast<uint32_t>(hash[i]) << (i * 8);
-    }
-    
-    return result;
-}
-
 } // namespace epicchaincpp
\ No newline at end of file
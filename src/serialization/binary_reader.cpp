@@ -1,6 +1,7 @@
 #include "epicchaincpp/serialization/binary_reader.hpp"
 #include "epicchaincpp/exceptions.hpp"
 #include <cstring>
+#include <algorithm>
 
 namespace epicchaincpp {
 
@@ -24,20 +25,24 @@ bool BinaryReader::readBool() {
 }
 
 Bytes BinaryReader::readBytes(size_t count) {
+    return readSpan(count).toBytes();
+}
+
+void BinaryReader::readBytes(uint8_t* buffer, size_t count) {
     if (position_ + count > size_) {
         throw DeserializationException("Attempted to read beyond end of data");
     }
-    Bytes result(data_ + position_, data_ + position_ + count);
+    std::memcpy(buffer, data_ + position_, count);
     position_ += count;
-    return result;
 }
 
-void BinaryReader::readBytes(uint8_t* buffer, size_t count) {
-    if (position_ + count > size_) {
+ByteSpan BinaryReader::readSpan(size_t count) {
+    if (count > size_ - position_) {
         throw DeserializationException("Attempted to read beyond end of data");
     }
-    std::memcpy(buffer, data_ + position_, count);
+    ByteSpan result(data_ + position_, count);
     position_ += count;
+    return result;
 }
 
 int8_t BinaryReader::readInt8() {
@@ -106,24 +111,37 @@ uint64_t BinaryReader::readVarInt() {
 }
 
 Bytes BinaryReader::readVarBytes() {
+    return readVarSpan().toBytes();
+}
+
+ByteSpan BinaryReader::readVarSpan() {
     uint64_t length = readVarInt();
-    return readBytes(static_cast<size_t>(length));
+    // Check before narrowing so a huge length cannot wrap on 32-bit size_t
+    if (length > remaining()) {
+        throw DeserializationException("Attempted to read beyond end of data");
+    }
+    return readSpan(static_cast<size_t>(length));
 }
 
 std::string BinaryReader::readVarString() {
-    uint64_t length = readVarInt();
-    Bytes bytes = readBytes(static_cast<size_t>(length));
-    return std::string(bytes.begin(), bytes.end());
+    return std::string(readVarStringView());
+}
+
+std::string_view BinaryReader::readVarStringView() {
+    ByteSpan bytes = readVarSpan();
+    return std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size());
 }
 
 std::string BinaryReader::readFixedString(size_t length) {
-    Bytes bytes = readBytes(length);
+    return std::string(readFixedStringView(length));
+}
+
+std::string_view BinaryReader::readFixedStringView(size_t length) {
+    ByteSpan bytes = readSpan(length);
     // Find null terminator if present
-    auto nullPos = std::find(bytes.begin(), bytes.end(), 0);
-    if (nullPos != bytes.end()) {
-        return std::string(bytes.begin(), nullPos);
-    }
-    return std::string(bytes.begin(), bytes.end());
+    const uint8_t* nullPos = std::find(bytes.begin(), bytes.end(), 0);
+    return std::string_view(reinterpret_cast<const char*>(bytes.data()),
+                            static_cast<size_t>(nullPos - bytes.begin()));
 }
 
 void BinaryReader::skip(size_t count) {
@@ -1,11 +1,47 @@
 #include "epicchaincpp/serialization/binary_writer.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <algorithm>
 #include <cstring>
 
 namespace epicchaincpp {
 
+uint8_t* BinaryWriter::grow(size_t count) {
+    if (fixed_) {
+        if (count > fixedCapacity_ - fixedSize_) {
+            throw SerializationException("Fixed buffer capacity of " + std::to_string(fixedCapacity_) + " bytes exceeded");
+        }
+        uint8_t* out = fixed_ + fixedSize_;
+        fixedSize_ += count;
+        return out;
+    }
+    size_t offset = buffer_.size();
+    buffer_.resize(offset + count);
+    return buffer_.data() + offset;
+}
+
+template<typename T>
+void BinaryWriter::writeLittleEndian(T value) {
+    uint8_t bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    std::reverse(bytes, bytes + sizeof(T));
+#endif
+    if (stream_) {
+        stream_->write(reinterpret_cast<const char*>(bytes), sizeof(T));
+    } else if (sink_) {
+        sink_->write(bytes, sizeof(T));
+    } else {
+        std::memcpy(grow(sizeof(T)), bytes, sizeof(T));
+    }
+}
+
 void BinaryWriter::writeByte(uint8_t value) {
     if (stream_) {
         stream_->write(reinterpret_cast<const char*>(&value), 1);
+    } else if (sink_) {
+        sink_->write(&value, 1);
+    } else if (fixed_) {
+        *grow(1) = value;
     } else {
         buffer_.push_back(value);
     }
@@ -16,16 +52,18 @@ void BinaryWriter::writeBool(bool value) {
 }
 
 void BinaryWriter::writeBytes(const Bytes& bytes) {
-    if (stream_) {
-        stream_->write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
-    } else {
-        buffer_.insert(buffer_.end(), bytes.begin(), bytes.end());
-    }
+    writeBytes(bytes.data(), bytes.size());
 }
 
 void BinaryWriter::writeBytes(const uint8_t* data, size_t length) {
     if (stream_) {
         stream_->write(reinterpret_cast<const char*>(data), length);
+    } else if (sink_) {
+        sink_->write(data, length);
+    } else if (fixed_) {
+        if (length > 0) {
+            std::memcpy(grow(length), data, length);
+        }
     } else {
         buffer_.insert(buffer_.end(), data, data + length);
     }
@@ -40,39 +78,27 @@ void BinaryWriter::writeUInt8(uint8_t value) {
 }
 
 void BinaryWriter::writeInt16(int16_t value) {
-    writeByte(value & 0xFF);
-    writeByte((value >> 8) & 0xFF);
+    writeLittleEndian(value);
 }
 
 void BinaryWriter::writeUInt16(uint16_t value) {
-    writeByte(value & 0xFF);
-    writeByte((value >> 8) & 0xFF);
+    writeLittleEndian(value);
 }
 
 void BinaryWriter::writeInt32(int32_t value) {
-    writeByte(value & 0xFF);
-    writeByte((value >> 8) & 0xFF);
-    writeByte((value >> 16) & 0xFF);
-    writeByte((value >> 24) & 0xFF);
+    writeLittleEndian(value);
 }
 
 void BinaryWriter::writeUInt32(uint32_t value) {
-    writeByte(value & 0xFF);
-    writeByte((value >> 8) & 0xFF);
-    writeByte((value >> 16) & 0xFF);
-    writeByte((value >> 24) & 0xFF);
+    writeLittleEndian(value);
 }
 
 void BinaryWriter::writeInt64(int64_t value) {
-    for (int i = 0; i < 8; ++i) {
-        writeByte((value >> (i * 8)) & 0xFF);
-    }
+    writeLittleEndian(value);
 }
 
 void BinaryWriter::writeUInt64(uint64_t value) {
-    for (int i = 0; i < 8; ++i) {
-        writeByte((value >> (i * 8)) & 0xFF);
-    }
+    writeLittleEndian(value);
 }
 
 void BinaryWriter::writeVarInt(uint64_t value) {
@@ -105,9 +131,33 @@ void BinaryWriter::writeFixedString(const std::string& str, size_t length) {
     writeBytes(reinterpret_cast<const uint8_t*>(str.data()), writeLength);
     
     // Pad with zeros if necessary
-    for (size_t i = writeLength; i < length; ++i) {
-        writeByte(0);
+    size_t padding = length - writeLength;
+    if (padding == 0) {
+        return;
+    }
+    if (stream_ || sink_) {
+        for (size_t i = 0; i < padding; ++i) {
+            writeByte(0);
+        }
+    } else {
+        std::memset(grow(padding), 0, padding);
+    }
+}
+
+const Bytes& BinaryWriter::toArray() const {
+    if (fixed_) {
+        throw IllegalStateException("BinaryWriter in fixed-buffer mode has no byte array; use view()");
+    }
+    return buffer_;
+}
+
+Bytes BinaryWriter::release() {
+    if (fixed_) {
+        throw IllegalStateException("BinaryWriter in fixed-buffer mode has no byte array; use view()");
     }
+    Bytes result = std::move(buffer_);
+    buffer_.clear();
+    return result;
 }
 
-} // namespace epicchaincpp
\ No newline at end of file
+} // namespace epicchaincpp
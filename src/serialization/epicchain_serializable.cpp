@@ -5,8 +5,9 @@ namespace epicchaincpp {
 
 Bytes NeoSerializable::toArray() const {
     BinaryWriter writer;
+    writer.reserve(getSize());
     serialize(writer);
-    return writer.toArray();
+    return writer.release();
 }
 
 } // namespace epicchaincpp
\ No newline at end of file
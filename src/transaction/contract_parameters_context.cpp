@@ -49,7 +49,7 @@ void ContractParametersContext::addSignature(const Hash160& scriptHash, const By
 
 bool ContractParametersContext::sign(const SharedPtr<Account>& account) {
     auto txHash = transaction_->getHash();
-    auto signature = account->sign(txHash.toArray());
+    auto signature = account->sign(txHash.toLittleEndianArray());
     
     addSignature(account, signature);
     return true;
@@ -108,9 +108,7 @@ nlohmann::json ContractParametersContext::toJson() const {
     nlohmann::json json;
     
     // Serialize transaction to bytes then encode to hex
-    BinaryWriter writer;
-    transaction_->serialize(writer);
-    json["transaction"] = Hex::encode(writer.toArray());
+    json["transaction"] = Hex::encode(transaction_->toArray());
     
     // Serialize signatures
     nlohmann::json sigs;
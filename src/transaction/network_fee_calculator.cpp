@@ -0,0 +1,175 @@
+#include "epicchaincpp/transaction/network_fee_calculator.hpp"
+#include "epicchaincpp/transaction/transaction.hpp"
+#include "epicchaincpp/contract/policy_contract.hpp"
+#include "epicchaincpp/serialization/binary_writer.hpp"
+#include "epicchaincpp/script/op_code.hpp"
+#include "epicchaincpp/script/interop_service.hpp"
+#include "epicchaincpp/exceptions.hpp"
+
+namespace epicchaincpp {
+
+namespace {
+
+const uint8_t PUBLIC_KEY_SIZE = 33;
+
+/// Read a public key push at pos: PUSHDATA1 33 <key>, or the short 33 <key>
+/// form ScriptBuilder emits
+bool readPublicKey(const Bytes& script, size_t& pos) {
+    if (pos + 2 + PUBLIC_KEY_SIZE <= script.size() &&
+        script[pos] == static_cast<uint8_t>(OpCode::PUSHDATA1) && script[pos + 1] == PUBLIC_KEY_SIZE) {
+        pos += 2 + PUBLIC_KEY_SIZE;
+        return true;
+    }
+    if (pos + 1 + PUBLIC_KEY_SIZE <= script.size() && script[pos] == PUBLIC_KEY_SIZE) {
+        pos += 1 + PUBLIC_KEY_SIZE;
+        return true;
+    }
+    return false;
+}
+
+/// Read a small integer push at pos: PUSH1..PUSH16, PUSHINT8 or PUSHINT16
+bool readCount(const Bytes& script, size_t& pos, int& value) {
+    if (pos >= script.size()) {
+        return false;
+    }
+    uint8_t opcode = script[pos];
+    if (opcode >= static_cast<uint8_t>(OpCode::PUSH1) && opcode <= static_cast<uint8_t>(OpCode::PUSH16)) {
+        value = opcode - static_cast<uint8_t>(OpCode::PUSH0);
+        pos += 1;
+        return true;
+    }
+    if (opcode == static_cast<uint8_t>(OpCode::PUSHINT8) && pos + 2 <= script.size()) {
+        value = static_cast<int8_t>(script[pos + 1]);
+        pos += 2;
+        return value > 0;
+    }
+    if (opcode == static_cast<uint8_t>(OpCode::PUSHINT16) && pos + 3 <= script.size()) {
+        value = static_cast<int16_t>(script[pos + 1] | (script[pos + 2] << 8));
+        pos += 3;
+        return value > 0;
+    }
+    return false;
+}
+
+/// Check that the script ends at pos with a SYSCALL to the given interop service
+bool isFinalSysCall(const Bytes& script, size_t pos, InteropId service) {
+    if (pos + 5 != script.size() || script[pos] != static_cast<uint8_t>(OpCode::SYSCALL)) {
+        return false;
+    }
+    uint32_t hash = 0;
+    for (int i = 0; i < 4; ++i) {
+        hash |= static_cast<uint32_t>(script[pos + 1 + i]) << (i * 8);
+    }
+    return hash == InteropService::getHash(service);
+}
+
+} // namespace
+
+NetworkFeeCalculator::NetworkFeeCalculator(int64_t feePerByte, int32_t execFeeFactor)
+    : refreshInterval_(std::chrono::steady_clock::duration::max()),
+      policy_{feePerByte, execFeeFactor}, fetched_(true) {
+}
+
+NetworkFeeCalculator::NetworkFeeCalculator(const SharedPtr<EpicChainRpcClient>& client,
+                                           std::chrono::steady_clock::duration refreshInterval)
+    : client_(client), refreshInterval_(refreshInterval), policy_{0, 0}, fetched_(false) {
+    if (!client_) {
+        throw IllegalArgumentException("RPC client cannot be null");
+    }
+}
+
+NetworkFeeCalculator::Policy NetworkFeeCalculator::getPolicy() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!client_) {
+        return policy_;
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (!fetched_ || now - fetchedAt_ >= refreshInterval_) {
+        policy_ = fetchPolicy();
+        fetchedAt_ = now;
+        fetched_ = true;
+    }
+    return policy_;
+}
+
+void NetworkFeeCalculator::setRefreshInterval(std::chrono::steady_clock::duration refreshInterval) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    refreshInterval_ = refreshInterval;
+}
+
+void NetworkFeeCalculator::invalidate() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (client_) {
+        fetched_ = false;
+    }
+}
+
+NetworkFeeCalculator::Policy NetworkFeeCalculator::fetchPolicy() const {
+    auto policy = PolicyContract::create(client_);
+    return {policy->getFeePerByte(), policy->getExecFeeFactor()};
+}
+
+int64_t NetworkFeeCalculator::calculate(const Transaction& transaction, const std::vector<Bytes>& verificationScripts) {
+    return calculate(transaction, verificationScripts, getPolicy());
+}
+
+int64_t NetworkFeeCalculator::calculate(const Transaction& transaction, const std::vector<Bytes>& verificationScripts,
+                                        const Policy& policy) {
+    if (verificationScripts.size() != transaction.getSigners().size()) {
+        throw IllegalArgumentException("Expected one verification script per signer");
+    }
+    
+    size_t size = transaction.getUnsignedSize() + BinaryWriter::getVarSize(verificationScripts.size());
+    int64_t executionCost = 0;
+    for (const auto& script : verificationScripts) {
+        VerificationScriptInfo info;
+        if (!parseVerificationScript(script, info)) {
+            throw UnsupportedOperationException("Cannot calculate the network fee of a non-standard verification script offline");
+        }
+        size_t invocationSize = SIGNATURE_PUSH_SIZE * info.m;
+        size += BinaryWriter::getVarSize(invocationSize) + invocationSize;
+        size += BinaryWriter::getVarSize(script.size()) + script.size();
+        executionCost += info.multiSig ? multiSignatureContractCost(info.m, info.n) : signatureContractCost();
+    }
+    
+    return executionCost * policy.execFeeFactor + static_cast<int64_t>(size) * policy.feePerByte;
+}
+
+bool NetworkFeeCalculator::parseVerificationScript(const Bytes& script, VerificationScriptInfo& info) {
+    // Signature: <public key> SYSCALL System.Crypto.CheckSig
+    size_t pos = 0;
+    if (readPublicKey(script, pos) && isFinalSysCall(script, pos, InteropId::SYSTEM_CRYPTO_CHECK_SIG)) {
+        info = {false, 1, 1};
+        return true;
+    }
+    
+    // Multi-signature: PUSH<m> <public key> x n PUSH<n> SYSCALL System.Crypto.CheckMultiSig
+    pos = 0;
+    int m = 0;
+    if (!readCount(script, pos, m)) {
+        return false;
+    }
+    int keys = 0;
+    while (readPublicKey(script, pos)) {
+        ++keys;
+    }
+    int n = 0;
+    if (keys == 0 || !readCount(script, pos, n) || n != keys || m > n ||
+        !isFinalSysCall(script, pos, InteropId::SYSTEM_CRYPTO_CHECK_MULTISIG)) {
+        return false;
+    }
+    info = {true, m, n};
+    return true;
+}
+
+int64_t NetworkFeeCalculator::signatureContractCost() {
+    // PUSHDATA1 <signature>, PUSHDATA1 <public key>, SYSCALL CheckSig
+    return PUSHDATA1_PRICE * 2 + SYSCALL_PRICE + CHECK_SIG_PRICE;
+}
+
+int64_t NetworkFeeCalculator::multiSignatureContractCost(int m, int n) {
+    // m signature pushes, PUSH<m>, n key pushes, PUSH<n>, SYSCALL CheckMultiSig
+    return PUSHDATA1_PRICE * (m + n) + PUSHINT_PRICE * 2 + SYSCALL_PRICE + CHECK_SIG_PRICE * n;
+}
+
+} // namespace epicchaincpp
@@ -44,15 +44,18 @@ size_t Signer::getSize() const {
     size_t size = NeoConstants::HASH160_SIZE + 1; // account + scopes
     
     if (hasScope(WitnessScope::CUSTOM_CONTRACTS)) {
-        size += 1 + allowedContracts_.size() * NeoConstants::HASH160_SIZE;
+        size += BinaryWriter::getVarSize(allowedContracts_.size()) + allowedContracts_.size() * NeoConstants::HASH160_SIZE;
     }
     
     if (hasScope(WitnessScope::CUSTOM_GROUPS)) {
-        size += 1 + allowedGroups_.size() * 33; // Assuming compressed public keys
+        size += BinaryWriter::getVarSize(allowedGroups_.size());
+        for (const auto& group : allowedGroups_) {
+            size += group.size();
+        }
     }
     
     if (hasScope(WitnessScope::WITNESS_RULES)) {
-        size += 1;
+        size += BinaryWriter::getVarSize(rules_.size());
         for (const auto& rule : rules_) {
             size += rule->getSize();
         }
@@ -103,7 +106,8 @@ SharedPtr<Signer> Signer::deserialize(BinaryReader& reader) {
     if (signer->hasScope(WitnessScope::CUSTOM_GROUPS)) {
         uint64_t count = reader.readVarInt();
         for (uint64_t i = 0; i < count; ++i) {
-            signer->allowedGroups_.push_back(reader.readBytes(33));
+            ByteSpan group = reader.readSpan(33);
+            signer->allowedGroups_.emplace_back(group.begin(), group.end());
         }
     }
     
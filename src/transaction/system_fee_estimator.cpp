@@ -0,0 +1,188 @@
+#include "epicchaincpp/transaction/system_fee_estimator.hpp"
+#include "epicchaincpp/transaction/signer.hpp"
+#include "epicchaincpp/script/op_code.hpp"
+#include "epicchaincpp/script/interop_service.hpp"
+
+namespace epicchaincpp {
+
+namespace {
+
+/// A decoded instruction: its position, opcode and operand range
+struct Instruction {
+    size_t offset;
+    OpCode opcode;
+    size_t operandOffset;
+    size_t operandSize;
+};
+
+/// Decode a script into instructions; returns false if an operand runs past the end
+bool decode(const Bytes& script, std::vector<Instruction>& instructions) {
+    size_t pos = 0;
+    while (pos < script.size()) {
+        OpCode opcode = OpCodeHelper::fromByte(script[pos]);
+        size_t operandOffset = pos + 1;
+        size_t operandSize = OpCodeHelper::getOperandSize(opcode);
+        
+        // PUSHDATA operands are a length prefix followed by the data
+        if (opcode == OpCode::PUSHDATA1 || opcode == OpCode::PUSHDATA2 || opcode == OpCode::PUSHDATA4) {
+            if (operandOffset + operandSize > script.size()) {
+                return false;
+            }
+            size_t length = 0;
+            for (size_t i = 0; i < operandSize; ++i) {
+                length |= static_cast<size_t>(script[operandOffset + i]) << (i * 8);
+            }
+            operandOffset += operandSize;
+            operandSize = length;
+        }
+        if (operandOffset + operandSize > script.size()) {
+            return false;
+        }
+        instructions.push_back({pos, opcode, operandOffset, operandSize});
+        pos = operandOffset + operandSize;
+    }
+    return true;
+}
+
+/// Whether an opcode builds an argument array or map out of pushed items
+bool isPacking(OpCode opcode) {
+    return opcode == OpCode::PACK || opcode == OpCode::PACKMAP || opcode == OpCode::PACKSTRUCT ||
+           opcode == OpCode::NEWARRAY0 || opcode == OpCode::NEWMAP;
+}
+
+} // namespace
+
+SystemFeeEstimator::SystemFeeEstimator(std::chrono::steady_clock::duration ttl, size_t maxEntries)
+    : ttl_(ttl), maxEntries_(maxEntries), lastBlockIndex_(0), hasBlockIndex_(false), hits_(0), misses_(0) {
+}
+
+int64_t SystemFeeEstimator::getSystemFee(const Bytes& script, const std::vector<SharedPtr<Signer>>& signers,
+                                         const std::function<int64_t()>& estimate) {
+    std::string key = makeKey(script, signers);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it != entries_.end() && std::chrono::steady_clock::now() < it->second.expiresAt) {
+            ++hits_;
+            return it->second.systemFee;
+        }
+        ++misses_;
+    }
+    
+    // Estimate without holding the lock; concurrent misses on one key may both estimate
+    int64_t systemFee = estimate();
+    
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.size() >= maxEntries_ && !entries_.count(key)) {
+        entries_.clear();
+    }
+    entries_[key] = {systemFee, std::chrono::steady_clock::now() + ttl_};
+    return systemFee;
+}
+
+void SystemFeeEstimator::onNewBlock(uint32_t blockIndex) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!hasBlockIndex_ || blockIndex > lastBlockIndex_) {
+        if (hasBlockIndex_) {
+            entries_.clear();
+        }
+        lastBlockIndex_ = blockIndex;
+        hasBlockIndex_ = true;
+    }
+}
+
+void SystemFeeEstimator::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+}
+
+SystemFeeEstimator::Stats SystemFeeEstimator::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return {hits_, misses_, entries_.size()};
+}
+
+std::string SystemFeeEstimator::makeKey(const Bytes& script, const std::vector<SharedPtr<Signer>>& signers) {
+    // Signer count first, so the key splits unambiguously into scopes and script
+    Bytes normalized = normalizeScript(script);
+    std::string key;
+    key.reserve(1 + signers.size() + normalized.size());
+    key.push_back(static_cast<char>(signers.size()));
+    for (const auto& signer : signers) {
+        key.push_back(static_cast<char>(signer->getScopes()));
+    }
+    key.append(normalized.begin(), normalized.end());
+    return key;
+}
+
+Bytes SystemFeeEstimator::normalizeScript(const Bytes& script) {
+    std::vector<Instruction> instructions;
+    if (!decode(script, instructions)) {
+        return script;
+    }
+    
+    // Only plain contract calls are normalized. Any other SYSCALL may read its
+    // arguments, and a misaligned decode is unlikely to hit this exact hash.
+    for (const auto& instruction : instructions) {
+        if (instruction.opcode != OpCode::SYSCALL) {
+            continue;
+        }
+        uint32_t hash = 0;
+        for (size_t i = 0; i < 4; ++i) {
+            hash |= static_cast<uint32_t>(script[instruction.operandOffset + i]) << (i * 8);
+        }
+        if (hash != InteropService::getHash(InteropId::SYSTEM_CONTRACT_CALL)) {
+            return script;
+        }
+    }
+    
+    // A call segment is the instructions since the previous SYSCALL. Its last
+    // two pushes are the method and the contract hash and are always kept.
+    // Arguments are the pushes before them: up to the last PACK for the node's
+    // encoding (args, count, PACK, flags, method, hash), or all of them for
+    // ScriptBuilder's (args, method, hash). Element counts are kept, and a
+    // segment with any other opcode in that range is left as it is.
+    std::vector<bool> isArgument(instructions.size(), false);
+    size_t segmentStart = 0;
+    for (size_t i = 0; i < instructions.size(); ++i) {
+        if (instructions[i].opcode != OpCode::SYSCALL) {
+            continue;
+        }
+        size_t start = segmentStart;
+        segmentStart = i + 1;
+        if (i < start + 2 || !OpCodeHelper::isPush(instructions[i - 1].opcode) ||
+            !OpCodeHelper::isPush(instructions[i - 2].opcode)) {
+            continue;
+        }
+        size_t end = i - 2;
+        for (size_t j = start; j < i - 2; ++j) {
+            if (instructions[j].opcode == OpCode::PACK) {
+                end = j;
+            }
+        }
+        bool argumentsOnly = true;
+        for (size_t j = start; j < end && argumentsOnly; ++j) {
+            argumentsOnly = OpCodeHelper::isPush(instructions[j].opcode) || isPacking(instructions[j].opcode);
+        }
+        if (!argumentsOnly) {
+            continue;
+        }
+        for (size_t j = start; j < end; ++j) {
+            OpCode next = instructions[j + 1].opcode;
+            bool isCount = next == OpCode::PACK || next == OpCode::PACKMAP || next == OpCode::PACKSTRUCT;
+            if (!isCount && OpCodeHelper::isPush(instructions[j].opcode)) {
+                isArgument[j] = true;
+            }
+        }
+    }
+    
+    Bytes normalized;
+    normalized.reserve(script.size());
+    for (size_t i = 0; i < instructions.size(); ++i) {
+        const auto& instruction = instructions[i];
+        size_t end = isArgument[i] ? instruction.operandOffset : instruction.operandOffset + instruction.operandSize;
+        normalized.insert(normalized.end(), script.begin() + instruction.offset, script.begin() + end);
+    }
+    return normalized;
+}
+
+} // namespace epicchaincpp
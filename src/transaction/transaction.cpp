@@ -45,11 +45,11 @@ void Transaction::addWitness(const SharedPtr<Witness>& witness) {
 }
 
 void Transaction::sign(const SharedPtr<Account>& account) {
-    // Calculate the hash of the transaction
+    // Calculate the hash of the transaction; the digest is signed in wire order
     Hash256 hash = getHash();
     
     // Sign the hash with the account's key pair
-    SharedPtr<ECDSASignature> signature = account->getKeyPair()->sign(hash.toArray());
+    SharedPtr<ECDSASignature> signature = account->getKeyPair()->sign(hash.toLittleEndianArray());
     
     // Create a witness from the signature and public key
     SharedPtr<Witness> witness = Witness::fromSignature(signature->getBytes(), account->getKeyPair()->getPublicKey()->getEncoded());
@@ -71,15 +71,58 @@ std::string Transaction::getTxId() const {
 }
 
 Hash256 Transaction::calculateHash() const {
-    Bytes hashData = getHashData();
-    Bytes hash = HashUtils::sha256(hashData);
+    // Serialize straight into the hash instead of building getHashData() first
+    Sha256Hasher hasher;
+    BinaryWriter writer(hasher);
+    serializeUnsigned(writer);
+    // The digest is a little-endian UInt256; Hash256 stores big-endian, like Header::getHash
+    Digest256 hash = hasher.final();
+    std::reverse(hash.begin(), hash.end());
     return Hash256(hash);
 }
 
+void Transaction::calculateHashes(const std::vector<SharedPtr<Transaction>>& transactions) {
+    std::vector<const Transaction*> pending;
+    size_t total = 0;
+    for (const auto& tx : transactions) {
+        if (!tx->hashCalculated_) {
+            pending.push_back(tx.get());
+            total += tx->getUnsignedSize();
+        }
+    }
+    
+    // Serialize everything into one buffer, then hash the pieces side by side
+    BinaryWriter writer;
+    writer.reserve(total);
+    std::vector<size_t> offsets;
+    offsets.reserve(pending.size() + 1);
+    for (const Transaction* tx : pending) {
+        offsets.push_back(writer.size());
+        tx->serializeUnsigned(writer);
+    }
+    offsets.push_back(writer.size());
+    
+    const uint8_t* data = writer.toArray().data();
+    std::vector<ByteSpan> inputs;
+    inputs.reserve(pending.size());
+    for (size_t i = 0; i < pending.size(); ++i) {
+        inputs.emplace_back(data + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    std::vector<Digest256> digests(pending.size());
+    HashUtils::sha256Many(inputs.data(), digests.data(), inputs.size());
+    
+    for (size_t i = 0; i < pending.size(); ++i) {
+        std::reverse(digests[i].begin(), digests[i].end());
+        pending[i]->hash_ = Hash256(digests[i]);
+        pending[i]->hashCalculated_ = true;
+    }
+}
+
 Bytes Transaction::getHashData() const {
     BinaryWriter writer;
+    writer.reserve(getUnsignedSize());
     serializeUnsigned(writer);
-    return writer.toArray();
+    return writer.release();
 }
 
 bool Transaction::verify() const {
@@ -137,9 +180,26 @@ int64_t Transaction::calculateNetworkFee() const {
 }
 
 size_t Transaction::getSize() const {
-    BinaryWriter writer;
-    serialize(writer);
-    return writer.size();
+    size_t size = getUnsignedSize() + BinaryWriter::getVarSize(witnesses_.size());
+    for (const auto& witness : witnesses_) {
+        size += witness->getSize();
+    }
+    return size;
+}
+
+size_t Transaction::getUnsignedSize() const {
+    // version + nonce + system fee + network fee + valid until block
+    size_t size = 1 + 4 + 8 + 8 + 4;
+    size += BinaryWriter::getVarSize(signers_.size());
+    for (const auto& signer : signers_) {
+        size += signer->getSize();
+    }
+    size += BinaryWriter::getVarSize(attributes_.size());
+    for (const auto& attribute : attributes_) {
+        size += attribute->getSize();
+    }
+    size += BinaryWriter::getVarSize(script_.size()) + script_.size();
+    return size;
 }
 
 void Transaction::serialize(BinaryWriter& writer) const {
@@ -186,56 +246,32 @@ SharedPtr<Transaction> Transaction::deserialize(BinaryReader& reader) {
     
     // Read signers
     uint64_t signerCount = reader.readVarInt();
+    if (signerCount > static_cast<uint64_t>(NeoConstants::MAX_SIGNERS)) {
+        throw DeserializationException("Too many transaction signers: " + std::to_string(signerCount));
+    }
+    tx->signers_.reserve(static_cast<size_t>(signerCount));
     for (uint64_t i = 0; i < signerCount; ++i) {
         tx->signers_.push_back(Signer::deserialize(reader));
     }
     
     // Read attributes
     uint64_t attrCount = reader.readVarInt();
-    tx->attributes_.clear();
+    if (attrCount > static_cast<uint64_t>(NeoConstants::MAX_TRANSACTION_ATTRIBUTES)) {
+        throw DeserializationException("Too many transaction attributes: " + std::to_string(attrCount));
+    }
+    tx->attributes_.reserve(static_cast<size_t>(attrCount));
     for (uint64_t i = 0; i < attrCount; ++i) {
-        // Read attribute type
-        uint8_t type = reader.readByte();
-        
-        // EpicChain supports the following attribute types:
-        // 0x01 - HighPriority
-        // 0x11 - OracleResponse
-        // 0x20 - NotValidBefore
-        // 0x21 - Conflicts
-        
-        switch (type) {
-            case 0x01: // HighPriority
-                // No additional data for HighPriority
-                break;
-            case 0x11: { // OracleResponse
-                [[maybe_unused]] uint64_t id = reader.readUInt64();
-                [[maybe_unused]] uint8_t code = reader.readUInt8();
-                Bytes result = reader.readVarBytes();
-                // Store the oracle response data (would need proper attribute structure)
-                break;
-            }
-            case 0x20: { // NotValidBefore
-                [[maybe_unused]] uint32_t height = reader.readUInt32();
-                // Store the height
-                break;
-            }
-            case 0x21: { // Conflicts
-                Hash256 hash = Hash256::deserialize(reader);
-                // Store the conflicting transaction hash
-                break;
-            }
-            default:
-                // Unknown attribute type, skip remaining data based on type
-                // For safety, throw an exception for unknown types
-                throw DeserializationException("Unknown transaction attribute type: " + std::to_string(type));
-        }
+        // Keep the attributes: they are part of the signed data and the hash
+        tx->attributes_.push_back(TransactionAttribute::deserialize(reader));
     }
     
     // Read script
-    tx->script_ = reader.readVarBytes();
+    ByteSpan script = reader.readVarSpan();
+    tx->script_.assign(script.begin(), script.end());
     
     // Read witnesses
     uint64_t witnessCount = reader.readVarInt();
+    tx->witnesses_.reserve(std::min(static_cast<size_t>(witnessCount), tx->signers_.size()));
     for (uint64_t i = 0; i < witnessCount; ++i) {
         tx->witnesses_.push_back(Witness::deserialize(reader));
     }
@@ -2,7 +2,9 @@
 #include "epicchaincpp/transaction/transaction.hpp"
 #include "epicchaincpp/transaction/signer.hpp"
 #include "epicchaincpp/transaction/witness.hpp"
-#include "epicchaincpp/protocol/neo_rpc_client.hpp"
+#include "epicchaincpp/transaction/network_fee_calculator.hpp"
+#include "epicchaincpp/transaction/system_fee_estimator.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
 #include "epicchaincpp/wallet/account.hpp"
 #include "epicchaincpp/script/script_builder.hpp"
 #include "epicchaincpp/types/contract_parameter.hpp"
@@ -19,16 +21,26 @@
 
 namespace epicchaincpp {
 
-TransactionBuilder::TransactionBuilder(const SharedPtr<NeoRpcClient>& client)
+TransactionBuilder::TransactionBuilder(const SharedPtr<EpicChainRpcClient>& client)
     : client_(client) {
     initializeTransaction();
 }
 
-TransactionBuilder& TransactionBuilder::setClient(const SharedPtr<NeoRpcClient>& client) {
+TransactionBuilder& TransactionBuilder::setClient(const SharedPtr<EpicChainRpcClient>& client) {
     client_ = client;
     return *this;
 }
 
+TransactionBuilder& TransactionBuilder::setNetworkFeeCalculator(const SharedPtr<NetworkFeeCalculator>& calculator) {
+    networkFeeCalculator_ = calculator;
+    return *this;
+}
+
+TransactionBuilder& TransactionBuilder::setSystemFeeEstimator(const SharedPtr<SystemFeeEstimator>& estimator) {
+    systemFeeEstimator_ = estimator;
+    return *this;
+}
+
 TransactionBuilder& TransactionBuilder::setNonce(uint32_t nonce) {
     transaction_->setNonce(nonce);
     return *this;
@@ -167,7 +179,7 @@ TransactionBuilder& TransactionBuilder::callContract(const Hash160& scriptHash,
     builder.pushData(scriptHash.toArray());
     
     // System call
-    builder.emitSysCall("System.Contract.Call");
+    builder.emitSysCall(InteropId::SYSTEM_CONTRACT_CALL);
     
     transaction_->setScript(builder.toArray());
     return *this;
@@ -176,7 +188,7 @@ TransactionBuilder& TransactionBuilder::callContract(const Hash160& scriptHash,
 TransactionBuilder& TransactionBuilder::transferNeo(const SharedPtr<Account>& from, 
                                                     const std::string& to, 
                                                     int64_t amount) {
-    return transferNep17(NeoToken::SCRIPT_HASH, from, to, amount, 0);
+    return transferNep17(EpicChainToken::SCRIPT_HASH, from, to, amount, 0);
 }
 
 TransactionBuilder& TransactionBuilder::transferGas(const SharedPtr<Account>& from, 
@@ -271,7 +283,7 @@ SharedPtr<Transaction> TransactionBuilder::getUnsignedTransaction() {
     return transaction_;
 }
 
-SharedPtr<NeoInvokeResultResponse> TransactionBuilder::callInvokeScript() {
+SharedPtr<EpicChainInvokeResultResponse> TransactionBuilder::callInvokeScript() {
     auto script = transaction_->getScript();
     if (script.empty()) {
         throw IllegalStateException("Cannot make an 'invokescript' call without the script being configured.");
@@ -364,7 +376,7 @@ void TransactionBuilder::addWitnessForAccount(const SharedPtr<Account>& account)
     auto txHash = transaction_->getHash();
     
     // Sign the transaction hash
-    auto signature = account->sign(txHash.toArray());
+    auto signature = account->sign(txHash.toLittleEndianArray());
     
     // Create witness
     auto witness = std::make_shared<Witness>();
@@ -530,6 +542,14 @@ bool TransactionBuilder::signersContainMultiSigWithCommitteeMember(const std::ve
 }
 
 int64_t TransactionBuilder::getSystemFeeForScript() {
+    if (systemFeeEstimator_) {
+        return systemFeeEstimator_->getSystemFee(transaction_->getScript(), transaction_->getSigners(),
+                                                 [this]() { return invokeSystemFeeForScript(); });
+    }
+    return invokeSystemFeeForScript();
+}
+
+int64_t TransactionBuilder::invokeSystemFeeForScript() {
     if (!client_) {
         throw IllegalStateException("RPC client not set");
     }
@@ -586,6 +606,36 @@ int64_t TransactionBuilder::getSystemFeeForScript() {
 }
 
 int64_t TransactionBuilder::calcNetworkFee() {
+    if (networkFeeCalculator_) {
+        if (signingAccounts_.empty()) {
+            throw IllegalStateException("A transaction requires at least one signing account. None was provided.");
+        }
+        
+        // One verification script per signer, in signer order
+        std::vector<Bytes> verificationScripts;
+        for (const auto& signer : transaction_->getSigners()) {
+            auto account = std::find_if(signingAccounts_.begin(), signingAccounts_.end(),
+                                        [&signer](const SharedPtr<Account>& acc) {
+                                            return acc->getScriptHash() == signer->getAccount();
+                                        });
+            if (account == signingAccounts_.end()) {
+                throw IllegalStateException("No signing account for signer " + signer->getAccount().toAddress());
+            }
+            verificationScripts.push_back((*account)->getVerificationScript());
+        }
+        
+        // Contract-based and other non-standard scripts are priced by the node,
+        // which runs their verification through calculatenetworkfee
+        bool standard = std::all_of(verificationScripts.begin(), verificationScripts.end(),
+                                    [](const Bytes& script) {
+                                        NetworkFeeCalculator::VerificationScriptInfo info;
+                                        return NetworkFeeCalculator::parseVerificationScript(script, info);
+                                    });
+        if (standard) {
+            return networkFeeCalculator_->calculate(*transaction_, verificationScripts);
+        }
+    }
+    
     // Create a temporary transaction for fee calculation
     auto tx = std::make_shared<Transaction>();
     tx->setVersion(transaction_->getVersion());
@@ -41,10 +41,8 @@ SharedPtr<Witness> Witness::fromMultiSignature(const std::vector<Bytes>& signatu
 }
 
 size_t Witness::getSize() const {
-    BinaryWriter writer;
-    writer.writeVarInt(invocationScript_.size());
-    writer.writeVarInt(verificationScript_.size());
-    return writer.size() + invocationScript_.size() + verificationScript_.size();
+    return BinaryWriter::getVarSize(invocationScript_.size()) + invocationScript_.size() +
+           BinaryWriter::getVarSize(verificationScript_.size()) + verificationScript_.size();
 }
 
 void Witness::serialize(BinaryWriter& writer) const {
@@ -53,9 +51,13 @@ void Witness::serialize(BinaryWriter& writer) const {
 }
 
 SharedPtr<Witness> Witness::deserialize(BinaryReader& reader) {
-    Bytes invocation = reader.readVarBytes();
-    Bytes verification = reader.readVarBytes();
-    return std::make_shared<Witness>(invocation, verification);
+    // Copy each script straight from the reader's buffer into the witness
+    auto witness = std::make_shared<Witness>();
+    ByteSpan invocation = reader.readVarSpan();
+    witness->invocationScript_.assign(invocation.begin(), invocation.end());
+    ByteSpan verification = reader.readVarSpan();
+    witness->verificationScript_.assign(verification.begin(), verification.end());
+    return witness;
 }
 
 bool Witness::operator==(const Witness& other) const {
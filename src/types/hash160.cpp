@@ -4,6 +4,7 @@
 #include "epicchaincpp/serialization/binary_reader.hpp"
 #include "epicchaincpp/exceptions.hpp"
 #include "epicchaincpp/utils/address.hpp"
+#include "epicchaincpp/utils/hex.hpp"
 #include "epicchaincpp/crypto/hash.hpp"
 #include "epicchaincpp/script/script_builder.hpp"
 #include <algorithm>
@@ -39,7 +40,9 @@ Hash160::Hash160(const std::string& hash) {
 }
 
 std::string Hash160::toString() const {
-    return ByteUtils::toHex(Bytes(hash_.begin(), hash_.end()), false);
+    std::string result(2 * hash_.size(), '\0');
+    Hex::encode(hash_.data(), hash_.size(), &result[0]);
+    return result;
 }
 
 Bytes Hash160::toArray() const {
@@ -53,15 +56,20 @@ Bytes Hash160::toLittleEndianArray() const {
 }
 
 std::string Hash160::toAddress() const {
-    return AddressUtils::scriptHashToAddress(toArray());
+    return AddressUtils::scriptHashToAddress(hash_.data());
 }
 
 Hash160 Hash160::fromAddress(const std::string& address) {
-    return Hash160(AddressUtils::addressToScriptHash(address));
+    Digest160 hash;
+    if (!AddressUtils::tryAddressToScriptHash(address, hash.data())) {
+        throw IllegalArgumentException("Invalid EpicChain address");
+    }
+    return Hash160(hash);
 }
 
 Hash160 Hash160::fromScript(const Bytes& script) {
-    Bytes hash = HashUtils::sha256ThenRipemd160(script);
+    Digest160 hash;
+    HashUtils::sha256ThenRipemd160(script.data(), script.size(), hash);
     std::reverse(hash.begin(), hash.end());
     return Hash160(hash);
 }
@@ -78,19 +86,44 @@ Hash160 Hash160::fromPublicKeys(const std::vector<SharedPtr<ECPublicKey>>& pubKe
     return fromScript(ScriptBuilder::buildVerificationScript(pubKeys, signingThreshold));
 }
 
+std::vector<Hash160> Hash160::fromScripts(const std::vector<Bytes>& scripts) {
+    std::vector<ByteSpan> inputs(scripts.begin(), scripts.end());
+    std::vector<Digest160> digests(scripts.size());
+    HashUtils::hash160Many(inputs.data(), digests.data(), inputs.size());
+    
+    std::vector<Hash160> hashes;
+    hashes.reserve(digests.size());
+    for (auto& digest : digests) {
+        std::reverse(digest.begin(), digest.end());
+        hashes.emplace_back(digest);
+    }
+    return hashes;
+}
+
+std::vector<Hash160> Hash160::fromEachPublicKey(const std::vector<Bytes>& encodedPublicKeys) {
+    std::vector<Bytes> scripts;
+    scripts.reserve(encodedPublicKeys.size());
+    for (const auto& key : encodedPublicKeys) {
+        scripts.push_back(ScriptBuilder::buildVerificationScript(key));
+    }
+    return fromScripts(scripts);
+}
+
 size_t Hash160::getSize() const {
     return NeoConstants::HASH160_SIZE;
 }
 
 void Hash160::serialize(BinaryWriter& writer) const {
-    Bytes littleEndian = toLittleEndianArray();
-    writer.writeBytes(littleEndian);
+    std::array<uint8_t, NeoConstants::HASH160_SIZE> littleEndian;
+    std::reverse_copy(hash_.begin(), hash_.end(), littleEndian.begin());
+    writer.writeBytes(littleEndian.data(), littleEndian.size());
 }
 
 Hash160 Hash160::deserialize(BinaryReader& reader) {
-    Bytes bytes = reader.readBytes(NeoConstants::HASH160_SIZE);
-    std::reverse(bytes.begin(), bytes.end());
-    return Hash160(bytes);
+    ByteSpan bytes = reader.readSpan(NeoConstants::HASH160_SIZE);
+    std::array<uint8_t, NeoConstants::HASH160_SIZE> hash;
+    std::reverse_copy(bytes.begin(), bytes.end(), hash.begin());
+    return Hash160(hash);
 }
 
 bool Hash160::operator==(const Hash160& other) const {
@@ -37,7 +37,9 @@ Hash256::Hash256(const std::string& hash) {
 }
 
 std::string Hash256::toString() const {
-    return Hex::encode(Bytes(hash_.begin(), hash_.end()));
+    std::string result(2 * hash_.size(), '\0');
+    Hex::encode(hash_.data(), hash_.size(), &result[0]);
+    return result;
 }
 
 Bytes Hash256::toArray() const {
@@ -55,14 +57,16 @@ size_t Hash256::getSize() const {
 }
 
 void Hash256::serialize(BinaryWriter& writer) const {
-    Bytes littleEndian = toLittleEndianArray();
-    writer.writeBytes(littleEndian);
+    std::array<uint8_t, NeoConstants::HASH256_SIZE> littleEndian;
+    std::reverse_copy(hash_.begin(), hash_.end(), littleEndian.begin());
+    writer.writeBytes(littleEndian.data(), littleEndian.size());
 }
 
 Hash256 Hash256::deserialize(BinaryReader& reader) {
-    Bytes bytes = reader.readBytes(NeoConstants::HASH256_SIZE);
-    std::reverse(bytes.begin(), bytes.end());
-    return Hash256(bytes);
+    ByteSpan bytes = reader.readSpan(NeoConstants::HASH256_SIZE);
+    std::array<uint8_t, NeoConstants::HASH256_SIZE> hash;
+    std::reverse_copy(bytes.begin(), bytes.end(), hash.begin());
+    return Hash256(hash);
 }
 
 bool Hash256::operator==(const Hash256& other) const {
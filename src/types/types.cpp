@@ -1,43 +1,42 @@
 #include "epicchaincpp/types/types.hpp"
+#include "epicchaincpp/utils/hex.hpp"
 #include <algorithm>
-#include <sstream>
-#include <iomanip>
 #include <cstring>
+#include <stdexcept>
 
 namespace epicchaincpp {
 
 std::string ByteUtils::toHex(const Bytes& bytes, bool with_prefix) {
-    std::stringstream ss;
+    size_t prefix = with_prefix ? 2 : 0;
+    std::string result(prefix + 2 * bytes.size(), '0');
     if (with_prefix) {
-        ss << "0x";
+        result[1] = 'x';
     }
-    for (const auto& byte : bytes) {
-        ss << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte);
-    }
-    return ss.str();
+    Hex::encode(bytes.data(), bytes.size(), &result[prefix]);
+    return result;
 }
 
 Bytes ByteUtils::fromHex(const std::string& hex) {
-    std::string cleanHex = hex;
+    const char* digits = hex.data();
+    size_t length = hex.size();
     // Remove 0x prefix if present
-    if (cleanHex.size() >= 2 && cleanHex[0] == '0' && (cleanHex[1] == 'x' || cleanHex[1] == 'X')) {
-        cleanHex = cleanHex.substr(2);
+    if (length >= 2 && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X')) {
+        digits += 2;
+        length -= 2;
     }
     
-    // Ensure even length
-    if (cleanHex.length() % 2 != 0) {
-        cleanHex = "0" + cleanHex;
+    // An odd length means an implied leading zero
+    Bytes result((length + 1) / 2);
+    size_t odd = length % 2;
+    if (odd != 0) {
+        char padded[2] = {'0', digits[0]};
+        if (!Hex::tryDecode(padded, 2, result.data())) {
+            throw std::invalid_argument("Invalid hex string");
+        }
+    }
+    if (!Hex::tryDecode(digits + odd, length - odd, result.data() + odd)) {
+        throw std::invalid_argument("Invalid hex string");
     }
-    
-    Bytes result;
-    result.reserve(cleanHex.length() / 2);
-    
-    for (size_t i = 0; i < cleanHex.length(); i += 2) {
-        std::string byteString = cleanHex.substr(i, 2);
-        uint8_t byte = static_cast<uint8_t>(std::stoul(byteString, nullptr, 16));
-        result.push_back(byte);
-    }
-    
     return result;
 }
 
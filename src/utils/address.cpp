@@ -3,6 +3,7 @@
 #include "epicchaincpp/crypto/hash.hpp"
 #include "epicchaincpp/epicchain_constants.hpp"
 #include "epicchaincpp/exceptions.hpp"
+#include <algorithm>
 
 namespace epicchaincpp {
 
@@ -11,44 +12,43 @@ std::string AddressUtils::scriptHashToAddress(const Bytes& scriptHash) {
         throw IllegalArgumentException("Script hash must be 20 bytes");
     }
     
-    Bytes data;
-    data.push_back(getAddressVersion());
-    data.insert(data.end(), scriptHash.begin(), scriptHash.end());
+    return scriptHashToAddress(scriptHash.data());
+}
+
+std::string AddressUtils::scriptHashToAddress(const uint8_t* scriptHash) {
+    uint8_t data[NeoConstants::HASH160_SIZE + 1];
+    data[0] = getAddressVersion();
+    std::copy_n(scriptHash, NeoConstants::HASH160_SIZE, data + 1);
     
-    return Base58::encodeCheck(data);
+    return Base58::encodeCheck(data, sizeof(data));
 }
 
 Bytes AddressUtils::addressToScriptHash(const std::string& address) {
-    if (!isValidAddress(address)) {
+    Bytes scriptHash(NeoConstants::HASH160_SIZE);
+    if (!tryAddressToScriptHash(address, scriptHash.data())) {
         throw IllegalArgumentException("Invalid EpicChain address");
     }
-    
-    Bytes decoded = Base58::decodeCheck(address);
-    
-    if (decoded.empty() || decoded[0] != getAddressVersion()) {
-        throw IllegalArgumentException("Invalid address version");
-    }
-    
-    return Bytes(decoded.begin() + 1, decoded.end());
+    return scriptHash;
 }
 
-bool AddressUtils::isValidAddress(const std::string& address) {
-    if (address.empty() || address.length() != 34) {
+bool AddressUtils::tryAddressToScriptHash(const std::string& address, uint8_t* scriptHash) {
+    if (address.length() != 34) {
         return false;
     }
     
-    try {
-        Bytes decoded = Base58::decodeCheck(address);
-        return !decoded.empty() && 
-               decoded.size() == 21 && 
-               decoded[0] == getAddressVersion();
-    } catch (const IllegalArgumentException&) {
-        // Invalid Base58 format or checksum
-        return false;
-    } catch (const std::exception&) {
-        // Other decoding errors
+    // Version byte plus script hash, checksum verified while decoding
+    uint8_t decoded[NeoConstants::HASH160_SIZE + 1];
+    if (!Base58::tryDecodeCheck(address, decoded, sizeof(decoded)) || decoded[0] != getAddressVersion()) {
         return false;
     }
+    
+    std::copy_n(decoded + 1, NeoConstants::HASH160_SIZE, scriptHash);
+    return true;
+}
+
+bool AddressUtils::isValidAddress(const std::string& address) {
+    uint8_t scriptHash[NeoConstants::HASH160_SIZE];
+    return tryAddressToScriptHash(address, scriptHash);
 }
 
 uint8_t AddressUtils::getAddressVersion() {
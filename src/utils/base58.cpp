@@ -2,151 +2,359 @@
 #include "epicchaincpp/crypto/hash.hpp"
 #include "epicchaincpp/exceptions.hpp"
 #include <algorithm>
+#include <array>
+#include <cstring>
 #include <vector>
 
 namespace epicchaincpp {
 
-const char* Base58::ALPHABET = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
-const int Base58::BASE = 58;
+namespace {
 
-std::string Base58::encode(const Bytes& data) {
-    if (data.empty()) {
-        return "";
+constexpr char kAlphabet[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+constexpr uint8_t kInvalid = 0xff;
+
+/// Five Base58 digits fit in a 32-bit limb, so both directions work on five digits at a time
+constexpr size_t kDigitsPerLimb = 5;
+constexpr uint32_t kPowers[kDigitsPerLimb + 1] = {1, 58, 3364, 195112, 11316496, 656356768};
+constexpr uint32_t kLimbBase = kPowers[kDigitsPerLimb];
+
+/// Payload sizes with checksum that get their own instantiation:
+/// addresses (21 bytes), WIF keys (34 bytes) and XEP-2 keys (39 bytes)
+constexpr size_t kAddressSize = 25;
+constexpr size_t kWifSize = 38;
+constexpr size_t kXep2Size = 43;
+
+constexpr std::array<uint8_t, 256> makeDecodeTable() {
+    std::array<uint8_t, 256> table{};
+    for (auto& entry : table) {
+        entry = kInvalid;
     }
-    
-    // Count leading zeros
-    size_t zeros = 0;
-    for (const auto& byte : data) {
-        if (byte == 0) {
-            zeros++;
-        } else {
-            break;
+    for (uint8_t digit = 0; digit < 58; ++digit) {
+        table[static_cast<uint8_t>(kAlphabet[digit])] = digit;
+    }
+    return table;
+}
+
+constexpr std::array<uint8_t, 256> kDecodeTable = makeDecodeTable();
+
+/// Working storage on the stack for typical payloads, on the heap beyond that
+template<typename T, size_t Local>
+class Scratch {
+public:
+    explicit Scratch(size_t size) {
+        if (size > Local) {
+            heap_.resize(size);
         }
     }
     
-    // Allocate enough space
-    size_t size = (data.size() * 138 / 100) + 1;
-    std::vector<uint8_t> buffer(size);
+    T* data() { return heap_.empty() ? local_.data() : heap_.data(); }
+
+private:
+    std::array<T, Local> local_;
+    std::vector<T> heap_;
+};
+
+/// Limbs needed to encode length bytes (log 256 / log 58 < 1.38)
+constexpr size_t encodeLimbCount(size_t length) {
+    return (length * 138 / 100 + 1) / kDigitsPerLimb + 1;
+}
+
+/// Characters needed to encode length bytes
+constexpr size_t encodedCapacity(size_t length) {
+    return length * 138 / 100 + 1;
+}
+
+/// Limbs needed to decode length characters (log 58 / log 256 < 0.733)
+constexpr size_t decodeLimbCount(size_t length) {
+    return (length * 733 / 1000 + 1) / 4 + 1;
+}
+
+/// Encode into out and return the number of characters written. Fixed, when
+/// non-zero, is the input length known at compile time.
+template<size_t Fixed>
+size_t encodeInto(const uint8_t* data, size_t length, uint32_t* limbs, char* out) {
+    if (Fixed != 0) {
+        length = Fixed;
+    }
     
-    size_t length = 0;
-    for (const auto& byte : data) {
-        int carry = byte;
-        for (size_t i = 0; i < length || carry; ++i) {
-            carry += 256 * buffer[i];
-            buffer[i] = carry % BASE;
-            carry /= BASE;
-            if (i >= length) {
-                length = i + 1;
-            }
-        }
+    size_t zeros = 0;
+    while (zeros < length && data[zeros] == 0) {
+        zeros++;
     }
     
-    // Build result string
-    std::string result;
-    result.reserve(zeros + length);
+    // Limbs hold the value in base 58^5, least significant first
+    size_t used = 0;
+    auto feed = [&](uint64_t value, unsigned bits) {
+        uint64_t carry = value;
+        for (size_t i = 0; i < used; ++i) {
+            uint64_t acc = (static_cast<uint64_t>(limbs[i]) << bits) + carry;
+            limbs[i] = static_cast<uint32_t>(acc % kLimbBase);
+            carry = acc / kLimbBase;
+        }
+        while (carry != 0) {
+            limbs[used++] = static_cast<uint32_t>(carry % kLimbBase);
+            carry /= kLimbBase;
+        }
+    };
     
-    for (size_t i = 0; i < zeros; ++i) {
-        result += ALPHABET[0];
+    // A partial word first, then whole 32-bit words
+    size_t pos = zeros;
+    size_t head = (length - zeros) % 4;
+    if (head != 0) {
+        uint64_t value = 0;
+        for (size_t i = 0; i < head; ++i) {
+            value = (value << 8) | data[pos++];
+        }
+        feed(value, static_cast<unsigned>(8 * head));
     }
-    
-    for (size_t i = 0; i < length; ++i) {
-        result += ALPHABET[buffer[length - 1 - i]];
+    for (; pos < length; pos += 4) {
+        uint32_t word = (static_cast<uint32_t>(data[pos]) << 24) | (static_cast<uint32_t>(data[pos + 1]) << 16) |
+                        (static_cast<uint32_t>(data[pos + 2]) << 8) | data[pos + 3];
+        feed(word, 32);
     }
     
-    return result;
-}
-
-Bytes Base58::decode(const std::string& encoded) {
-    if (encoded.empty()) {
-        return Bytes();
+    char* p = std::fill_n(out, zeros, kAlphabet[0]);
+    if (used == 0) {
+        return p - out;
     }
     
-    // Count leading '1's
-    size_t zeros = 0;
-    for (const auto& c : encoded) {
-        if (c == ALPHABET[0]) {
-            zeros++;
-        } else {
-            break;
+    // The most significant limb without its leading zero digits, then five digits per limb
+    char top[kDigitsPerLimb];
+    size_t topDigits = 0;
+    for (uint32_t value = limbs[used - 1]; value != 0; value /= 58) {
+        top[topDigits++] = kAlphabet[value % 58];
+    }
+    while (topDigits != 0) {
+        *p++ = top[--topDigits];
+    }
+    for (size_t i = used - 1; i-- > 0;) {
+        uint32_t value = limbs[i];
+        for (size_t k = kDigitsPerLimb; k-- > 0;) {
+            p[k] = kAlphabet[value % 58];
+            value /= 58;
         }
+        p += kDigitsPerLimb;
     }
+    return p - out;
+}
+
+template<size_t Size>
+std::string encodeFixed(const uint8_t* data) {
+    std::array<uint32_t, encodeLimbCount(Size)> limbs;
+    std::array<char, encodedCapacity(Size)> text;
+    size_t length = encodeInto<Size>(data, Size, limbs.data(), text.data());
+    return std::string(text.data(), length);
+}
+
+/// Decode the digits into base 2^32 limbs, least significant first. Fails on an
+/// invalid character or when the value needs more than capacity limbs.
+bool decodeInto(const std::string& encoded, uint32_t* limbs, size_t capacity, size_t& used, size_t& ones) {
+    const char* text = encoded.data();
+    size_t length = encoded.size();
     
-    // Decode
-    size_t size = encoded.size() * 733 / 1000 + 1;
-    std::vector<uint8_t> buffer(size);
-    size_t length = 0;
+    ones = 0;
+    while (ones < length && text[ones] == kAlphabet[0]) {
+        ones++;
+    }
     
-    for (const auto& c : encoded) {
-        const char* p = std::strchr(ALPHABET, c);
-        if (p == nullptr) {
-            // Return empty bytes for invalid characters instead of throwing
-            return Bytes();
+    used = 0;
+    auto feed = [&](uint32_t value, uint32_t scale) {
+        uint64_t carry = value;
+        for (size_t i = 0; i < used; ++i) {
+            uint64_t acc = static_cast<uint64_t>(limbs[i]) * scale + carry;
+            limbs[i] = static_cast<uint32_t>(acc);
+            carry = acc >> 32;
         }
-        
-        int carry = p - ALPHABET;
-        for (size_t i = 0; i < length || carry; ++i) {
-            carry += BASE * buffer[i];
-            buffer[i] = carry % 256;
-            carry /= 256;
-            if (i >= length) {
-                length = i + 1;
+        if (carry != 0) {
+            if (used == capacity) {
+                return false;
             }
+            limbs[used++] = static_cast<uint32_t>(carry);
         }
-    }
+        return true;
+    };
     
-    // Build result
-    Bytes result;
-    result.reserve(zeros + length);
+    // A partial group first, then five digits at a time
+    size_t pos = ones;
+    size_t group = (length - ones) % kDigitsPerLimb;
+    if (group == 0) {
+        group = kDigitsPerLimb;
+    }
+    while (pos < length) {
+        uint32_t value = 0;
+        for (size_t i = 0; i < group; ++i) {
+            uint8_t digit = kDecodeTable[static_cast<uint8_t>(text[pos++])];
+            if (digit == kInvalid) {
+                return false;
+            }
+            value = value * 58 + digit;
+        }
+        if (!feed(value, kPowers[group])) {
+            return false;
+        }
+        group = kDigitsPerLimb;
+    }
+    return true;
+}
+
+/// Number of bytes in the value held by the limbs
+size_t significantBytes(const uint32_t* limbs, size_t used) {
+    if (used == 0) {
+        return 0;
+    }
+    uint32_t top = limbs[used - 1];
+    size_t bytes = (used - 1) * 4;
+    while (top != 0) {
+        bytes++;
+        top >>= 8;
+    }
+    return bytes;
+}
+
+/// Write the low bytes of the value held by the limbs, most significant first
+void storeBytes(const uint32_t* limbs, size_t bytes, uint8_t* out) {
+    for (size_t i = 0; i < bytes; ++i) {
+        size_t index = bytes - 1 - i;
+        out[i] = static_cast<uint8_t>(limbs[index / 4] >> (8 * (index % 4)));
+    }
+}
+
+/// Decode a string that must hold exactly length bytes. Fixed, when non-zero,
+/// is that length known at compile time.
+template<size_t Fixed>
+bool decodeExact(const std::string& encoded, uint8_t* out, size_t length, uint32_t* limbs) {
+    if (Fixed != 0) {
+        length = Fixed;
+    }
+    size_t used;
+    size_t ones;
+    if (!decodeInto(encoded, limbs, (length + 3) / 4, used, ones)) {
+        return false;
+    }
+    size_t bytes = significantBytes(limbs, used);
+    if (ones + bytes != length) {
+        return false;
+    }
+    std::fill_n(out, ones, 0);
+    storeBytes(limbs, bytes, out + ones);
+    return true;
+}
+
+template<size_t Size>
+bool decodeFixed(const std::string& encoded, uint8_t* out) {
+    std::array<uint32_t, (Size + 3) / 4> limbs;
+    return decodeExact<Size>(encoded, out, Size, limbs.data());
+}
+
+} // namespace
+
+const char* Base58::ALPHABET = kAlphabet;
+const int Base58::BASE = 58;
+
+std::string Base58::encode(const Bytes& data) {
+    return encode(data.data(), data.size());
+}
+
+std::string Base58::encode(const uint8_t* data, size_t length) {
+    switch (length) {
+        case kAddressSize:
+            return encodeFixed<kAddressSize>(data);
+        case kWifSize:
+            return encodeFixed<kWifSize>(data);
+        case kXep2Size:
+            return encodeFixed<kXep2Size>(data);
+        default:
+            break;
+    }
     
-    for (size_t i = 0; i < zeros; ++i) {
-        result.push_back(0);
+    Scratch<uint32_t, 32> limbs(encodeLimbCount(length));
+    std::string result(encodedCapacity(length), '\0');
+    result.resize(encodeInto<0>(data, length, limbs.data(), &result[0]));
+    return result;
+}
+
+Bytes Base58::decode(const std::string& encoded) {
+    if (encoded.empty()) {
+        return Bytes();
     }
     
-    for (size_t i = 0; i < length; ++i) {
-        result.push_back(buffer[length - 1 - i]);
+    size_t capacity = decodeLimbCount(encoded.size());
+    Scratch<uint32_t, 32> limbs(capacity);
+    size_t used;
+    size_t ones;
+    if (!decodeInto(encoded, limbs.data(), capacity, used, ones)) {
+        // Return empty bytes for invalid characters instead of throwing
+        return Bytes();
     }
     
+    size_t bytes = significantBytes(limbs.data(), used);
+    Bytes result(ones + bytes);
+    storeBytes(limbs.data(), bytes, result.data() + ones);
     return result;
 }
 
+bool Base58::tryDecode(const std::string& encoded, uint8_t* out, size_t length) {
+    switch (length) {
+        case kAddressSize:
+            return decodeFixed<kAddressSize>(encoded, out);
+        case kWifSize:
+            return decodeFixed<kWifSize>(encoded, out);
+        case kXep2Size:
+            return decodeFixed<kXep2Size>(encoded, out);
+        default:
+            break;
+    }
+    
+    Scratch<uint32_t, 32> limbs((length + 3) / 4);
+    return decodeExact<0>(encoded, out, length, limbs.data());
+}
+
 std::string Base58::encodeCheck(const Bytes& data) {
-    Bytes checksum = calculateChecksum(data);
-    Bytes dataWithChecksum = data;
-    dataWithChecksum.insert(dataWithChecksum.end(), checksum.begin(), checksum.end());
-    return encode(dataWithChecksum);
+    return encodeCheck(data.data(), data.size());
+}
+
+std::string Base58::encodeCheck(const uint8_t* data, size_t length) {
+    Scratch<uint8_t, 64> buffer(length + 4);
+    std::copy_n(data, length, buffer.data());
+    calculateChecksum(data, length, buffer.data() + length);
+    return encode(buffer.data(), length + 4);
 }
 
 Bytes Base58::decodeCheck(const std::string& encoded) {
     Bytes decoded = decode(encoded);
     
-    // Return empty if decode failed or too short
-    if (decoded.empty() || decoded.size() < 4) {
+    // Return empty if decode failed, too short or the checksum is invalid
+    if (decoded.size() < 4 || !verifyChecksum(decoded.data(), decoded.size())) {
         return Bytes();
     }
     
-    // Return empty if checksum is invalid
-    if (!verifyChecksum(decoded)) {
-        return Bytes();
+    decoded.resize(decoded.size() - 4);
+    return decoded;
+}
+
+bool Base58::tryDecodeCheck(const std::string& encoded, uint8_t* out, size_t length) {
+    Scratch<uint8_t, 64> buffer(length + 4);
+    if (!tryDecode(encoded, buffer.data(), length + 4) || !verifyChecksum(buffer.data(), length + 4)) {
+        return false;
     }
-    
-    return Bytes(decoded.begin(), decoded.end() - 4);
+    std::copy_n(buffer.data(), length, out);
+    return true;
 }
 
-Bytes Base58::calculateChecksum(const Bytes& data) {
-    Bytes hash = HashUtils::doubleSha256(data);
-    return Bytes(hash.begin(), hash.begin() + 4);
+void Base58::calculateChecksum(const uint8_t* data, size_t length, uint8_t* checksum) {
+    Digest256 hash;
+    HashUtils::doubleSha256(data, length, hash);
+    std::copy_n(hash.begin(), 4, checksum);
 }
 
-bool Base58::verifyChecksum(const Bytes& dataWithChecksum) {
-    if (dataWithChecksum.size() < 4) {
+bool Base58::verifyChecksum(const uint8_t* dataWithChecksum, size_t length) {
+    if (length < 4) {
         return false;
     }
     
-    Bytes data(dataWithChecksum.begin(), dataWithChecksum.end() - 4);
-    Bytes checksum(dataWithChecksum.end() - 4, dataWithChecksum.end());
-    Bytes calculatedChecksum = calculateChecksum(data);
-    
-    return std::equal(checksum.begin(), checksum.end(), calculatedChecksum.begin());
+    uint8_t checksum[4];
+    calculateChecksum(dataWithChecksum, length - 4, checksum);
+    return std::memcmp(checksum, dataWithChecksum + length - 4, 4) == 0;
 }
 
-} // namespace epicchaincpp
\ No newline at end of file
+} // namespace epicchaincpp
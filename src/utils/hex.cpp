@@ -1,55 +1,236 @@
 #include "epicchaincpp/utils/hex.hpp"
-#include <sstream>
-#include <iomanip>
 #include <algorithm>
-#include <stdexcept>
+#include <array>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && defined(__SSE2__)
+#define EPICCHAIN_HEX_X86 1
+#include <immintrin.h>
+#endif
 
 namespace epicchaincpp {
 
+namespace {
+
+constexpr char kLowerDigits[] = "0123456789abcdef";
+constexpr char kUpperDigits[] = "0123456789ABCDEF";
+constexpr uint8_t kInvalid = 0xff;
+
+/// Two characters per byte value
+constexpr std::array<char, 512> makeEncodeTable(const char* digits) {
+    std::array<char, 512> table{};
+    for (size_t byte = 0; byte < 256; ++byte) {
+        table[2 * byte] = digits[byte >> 4];
+        table[2 * byte + 1] = digits[byte & 0x0f];
+    }
+    return table;
+}
+
+/// Nibble value per character, kInvalid for non-hex characters
+constexpr std::array<uint8_t, 256> makeDecodeTable() {
+    std::array<uint8_t, 256> table{};
+    for (auto& entry : table) {
+        entry = kInvalid;
+    }
+    for (uint8_t i = 0; i < 16; ++i) {
+        table[static_cast<uint8_t>(kLowerDigits[i])] = i;
+        table[static_cast<uint8_t>(kUpperDigits[i])] = i;
+    }
+    return table;
+}
+
+constexpr std::array<char, 512> kLowerTable = makeEncodeTable(kLowerDigits);
+constexpr std::array<char, 512> kUpperTable = makeEncodeTable(kUpperDigits);
+constexpr std::array<uint8_t, 256> kDecodeTable = makeDecodeTable();
+
+bool hasPrefix(const std::string& hex) {
+    return hex.size() >= 2 && hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X');
+}
+
+#ifdef EPICCHAIN_HEX_X86
+
+bool hasAvx2() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+/// Encode blocks of 16 bytes. SSE2 has no byte shuffle, so nibbles above 9
+/// are moved to the letters by a compare and add.
+void encodeSse2(const uint8_t* data, size_t blocks, char* out, const char* digits) {
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i zero = _mm_set1_epi8('0');
+    const __m128i letters = _mm_set1_epi8(static_cast<char>(digits[10] - '0' - 10));
+    for (size_t i = 0; i < blocks; ++i) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * i));
+        __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+        __m128i low = _mm_and_si128(bytes, mask);
+        high = _mm_add_epi8(_mm_add_epi8(high, zero), _mm_and_si128(_mm_cmpgt_epi8(high, nine), letters));
+        low = _mm_add_epi8(_mm_add_epi8(low, zero), _mm_and_si128(_mm_cmpgt_epi8(low, nine), letters));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 32 * i), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 32 * i + 16), _mm_unpackhi_epi8(high, low));
+    }
+}
+
+/// Decode blocks of 32 characters into 16 bytes
+bool decodeSse2(const char* hex, size_t blocks, uint8_t* out) {
+    const __m128i belowZero = _mm_set1_epi8('0' - 1);
+    const __m128i aboveNine = _mm_set1_epi8('9' + 1);
+    const __m128i belowA = _mm_set1_epi8('a' - 1);
+    const __m128i aboveF = _mm_set1_epi8('f' + 1);
+    const __m128i lowerCase = _mm_set1_epi8(0x20);
+    const __m128i zero = _mm_set1_epi8('0');
+    const __m128i letters = _mm_set1_epi8('a' - 10);
+    const __m128i lowByte = _mm_set1_epi16(0x00ff);
+    for (size_t i = 0; i < blocks; ++i) {
+        __m128i valid = _mm_set1_epi8(-1);
+        __m128i pairs[2];
+        for (int half = 0; half < 2; ++half) {
+            __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hex + 32 * i + 16 * half));
+            __m128i lower = _mm_or_si128(chars, lowerCase);
+            __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(chars, belowZero), _mm_cmpgt_epi8(aboveNine, chars));
+            __m128i isLetter = _mm_and_si128(_mm_cmpgt_epi8(lower, belowA), _mm_cmpgt_epi8(aboveF, lower));
+            valid = _mm_and_si128(valid, _mm_or_si128(isDigit, isLetter));
+            __m128i nibbles = _mm_or_si128(_mm_and_si128(isDigit, _mm_sub_epi8(chars, zero)),
+                                           _mm_and_si128(isLetter, _mm_sub_epi8(lower, letters)));
+            // Each 16-bit lane holds the high nibble in its low byte and the low nibble above it
+            pairs[half] = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(nibbles, lowByte), 4), _mm_srli_epi16(nibbles, 8));
+        }
+        if (_mm_movemask_epi8(valid) != 0xffff) {
+            return false;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16 * i), _mm_packus_epi16(pairs[0], pairs[1]));
+    }
+    return true;
+}
+
+/// Encode blocks of 32 bytes, looking the digits up with a byte shuffle
+__attribute__((target("avx2")))
+void encodeAvx2(const uint8_t* data, size_t blocks, char* out, const char* digits) {
+    const __m256i mask = _mm256_set1_epi8(0x0f);
+    const __m256i table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digits)));
+    for (size_t i = 0; i < blocks; ++i) {
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32 * i));
+        __m256i high = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), mask));
+        __m256i low = _mm256_shuffle_epi8(table, _mm256_and_si256(bytes, mask));
+        // Unpacking works within 128-bit lanes, so put the lanes back in order
+        __m256i first = _mm256_unpacklo_epi8(high, low);
+        __m256i second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 64 * i), _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 64 * i + 32), _mm256_permute2x128_si256(first, second, 0x31));
+    }
+}
+
+/// Decode blocks of 64 characters into 32 bytes
+__attribute__((target("avx2")))
+bool decodeAvx2(const char* hex, size_t blocks, uint8_t* out) {
+    const __m256i belowZero = _mm256_set1_epi8('0' - 1);
+    const __m256i aboveNine = _mm256_set1_epi8('9' + 1);
+    const __m256i belowA = _mm256_set1_epi8('a' - 1);
+    const __m256i aboveF = _mm256_set1_epi8('f' + 1);
+    const __m256i lowerCase = _mm256_set1_epi8(0x20);
+    const __m256i zero = _mm256_set1_epi8('0');
+    const __m256i letters = _mm256_set1_epi8('a' - 10);
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+    for (size_t i = 0; i < blocks; ++i) {
+        __m256i valid = _mm256_set1_epi8(-1);
+        __m256i pairs[2];
+        for (int half = 0; half < 2; ++half) {
+            __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hex + 64 * i + 32 * half));
+            __m256i lower = _mm256_or_si256(chars, lowerCase);
+            __m256i isDigit = _mm256_and_si256(_mm256_cmpgt_epi8(chars, belowZero), _mm256_cmpgt_epi8(aboveNine, chars));
+            __m256i isLetter = _mm256_and_si256(_mm256_cmpgt_epi8(lower, belowA), _mm256_cmpgt_epi8(aboveF, lower));
+            valid = _mm256_and_si256(valid, _mm256_or_si256(isDigit, isLetter));
+            __m256i nibbles = _mm256_or_si256(_mm256_and_si256(isDigit, _mm256_sub_epi8(chars, zero)),
+                                              _mm256_and_si256(isLetter, _mm256_sub_epi8(lower, letters)));
+            // high * 16 + low for each pair of characters
+            pairs[half] = _mm256_maddubs_epi16(nibbles, weights);
+        }
+        if (_mm256_movemask_epi8(valid) != -1) {
+            return false;
+        }
+        // Packing also works within lanes
+        __m256i packed = _mm256_packus_epi16(pairs[0], pairs[1]);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 32 * i), _mm256_permute4x64_epi64(packed, 0xD8));
+    }
+    return true;
+}
+
+#endif // EPICCHAIN_HEX_X86
+
+} // namespace
+
 std::string Hex::encode(const Bytes& data, bool uppercase) {
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-    
-    if (uppercase) {
-        ss << std::uppercase;
+    std::string result(2 * data.size(), '\0');
+    encode(data.data(), data.size(), &result[0], uppercase);
+    return result;
+}
+
+void Hex::encode(const uint8_t* data, size_t length, char* out, bool uppercase) {
+    size_t done = 0;
+#ifdef EPICCHAIN_HEX_X86
+    const char* digits = uppercase ? kUpperDigits : kLowerDigits;
+    if (length >= 32 && hasAvx2()) {
+        size_t blocks = length / 32;
+        encodeAvx2(data, blocks, out, digits);
+        done = blocks * 32;
     }
-    
-    for (const auto& byte : data) {
-        ss << std::setw(2) << static_cast<int>(byte);
+    if (length - done >= 16) {
+        size_t blocks = (length - done) / 16;
+        encodeSse2(data + done, blocks, out + 2 * done, digits);
+        done += blocks * 16;
+    }
+#endif
+    const char* table = uppercase ? kUpperTable.data() : kLowerTable.data();
+    for (size_t i = done; i < length; ++i) {
+        std::memcpy(out + 2 * i, table + 2 * data[i], 2);
     }
-    
-    return ss.str();
 }
 
 Bytes Hex::decode(const std::string& hex) {
-    std::string cleanHex = withoutPrefix(hex);
+    size_t offset = hasPrefix(hex) ? 2 : 0;
+    size_t length = hex.size() - offset;
     
-    // Return empty for odd-length strings
-    if (cleanHex.length() % 2 != 0) {
+    // Return empty for odd-length strings and invalid hex characters
+    Bytes result(length / 2);
+    if (!tryDecode(hex.data() + offset, length, result.data())) {
         return Bytes();
     }
+    return result;
+}
+
+bool Hex::tryDecode(const char* hex, size_t length, uint8_t* out) {
+    if (length % 2 != 0) {
+        return false;
+    }
     
-    Bytes result;
-    result.reserve(cleanHex.length() / 2);
-    
-    for (size_t i = 0; i < cleanHex.length(); i += 2) {
-        std::string byteString = cleanHex.substr(i, 2);
-        
-        // Validate that both characters are valid hex
-        for (char c : byteString) {
-            if (!((c >= '0' && c <= '9') || 
-                  (c >= 'a' && c <= 'f') || 
-                  (c >= 'A' && c <= 'F'))) {
-                // Return empty for invalid hex characters
-                return Bytes();
-            }
+    size_t bytes = length / 2;
+    size_t done = 0;
+#ifdef EPICCHAIN_HEX_X86
+    if (bytes >= 32 && hasAvx2()) {
+        size_t blocks = bytes / 32;
+        if (!decodeAvx2(hex, blocks, out)) {
+            return false;
         }
-        
-        uint8_t byte = static_cast<uint8_t>(std::stoul(byteString, nullptr, 16));
-        result.push_back(byte);
+        done = blocks * 32;
     }
-    
-    return result;
+    if (bytes - done >= 16) {
+        size_t blocks = (bytes - done) / 16;
+        if (!decodeSse2(hex + 2 * done, blocks, out + done)) {
+            return false;
+        }
+        done += blocks * 16;
+    }
+#endif
+    for (size_t i = done; i < bytes; ++i) {
+        uint8_t high = kDecodeTable[static_cast<uint8_t>(hex[2 * i])];
+        uint8_t low = kDecodeTable[static_cast<uint8_t>(hex[2 * i + 1])];
+        if ((high | low) & 0xf0) {
+            return false;
+        }
+        out[i] = static_cast<uint8_t>((high << 4) | low);
+    }
+    return true;
 }
 
 bool Hex::isValid(const std::string& str) {
@@ -58,38 +239,31 @@ bool Hex::isValid(const std::string& str) {
         return false;
     }
     
-    std::string cleanStr = withoutPrefix(str);
-    
-    if (cleanStr.empty()) {
-        // Empty string (no prefix) is valid, but "0x" alone is not
-        return str.empty() || (str != "0x" && str != "0X");
-    }
+    size_t offset = hasPrefix(str) ? 2 : 0;
     
     // Check for odd length (invalid hex must have even number of characters)
-    if (cleanStr.length() % 2 != 0) {
+    if ((str.size() - offset) % 2 != 0) {
         return false;
     }
     
     // Check all characters are valid hex
-    return std::all_of(cleanStr.begin(), cleanStr.end(), [](char c) {
-        return (c >= '0' && c <= '9') ||
-               (c >= 'a' && c <= 'f') ||
-               (c >= 'A' && c <= 'F');
+    return std::all_of(str.begin() + offset, str.end(), [](char c) {
+        return kDecodeTable[static_cast<uint8_t>(c)] != kInvalid;
     });
 }
 
 std::string Hex::withPrefix(const std::string& hex) {
-    if (hex.size() >= 2 && hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X')) {
+    if (hasPrefix(hex)) {
         return hex;
     }
     return "0x" + hex;
 }
 
 std::string Hex::withoutPrefix(const std::string& hex) {
-    if (hex.size() >= 2 && hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X')) {
+    if (hasPrefix(hex)) {
         return hex.substr(2);
     }
     return hex;
 }
 
-} // namespace epicchaincpp
\ No newline at end of file
+} // namespace epicchaincpp
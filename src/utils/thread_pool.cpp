@@ -0,0 +1,134 @@
+#include "epicchaincpp/utils/thread_pool.hpp"
+#include <atomic>
+#include <exception>
+
+namespace epicchaincpp {
+
+ThreadPool::ThreadPool(size_t threads)
+    : stopping_(false) {
+    if (threads == 0) {
+        threads = hardwareConcurrency();
+    }
+    workers_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        workers_.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    condition_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+    }
+    condition_.notify_one();
+}
+
+void ThreadPool::workerLoop() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+
+namespace {
+
+/// State shared between the caller of parallelFor and its helper tasks,
+/// which may start after the caller has already returned
+struct ParallelForState {
+    std::function<void(size_t)> fn;
+    size_t count;
+    std::atomic<size_t> next{0};
+    std::atomic<bool> failed{false};
+    
+    std::mutex mutex;
+    std::condition_variable done;
+    size_t finished = 0;
+    std::exception_ptr error;
+    
+    /// Claim and run indices until none are left
+    void run() {
+        size_t completed = 0;
+        for (;;) {
+            size_t index = next.fetch_add(1);
+            if (index >= count) {
+                break;
+            }
+            if (!failed.load()) {
+                try {
+                    fn(index);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                    failed.store(true);
+                }
+            }
+            ++completed;
+        }
+        if (completed > 0) {
+            std::lock_guard<std::mutex> lock(mutex);
+            finished += completed;
+            if (finished == count) {
+                done.notify_all();
+            }
+        }
+    }
+};
+
+} // namespace
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& fn) {
+    if (count == 0) {
+        return;
+    }
+    
+    auto state = std::make_shared<ParallelForState>();
+    state->fn = fn;
+    state->count = count;
+    
+    // The caller works too, so one helper fewer than the work requires
+    size_t helpers = std::min(workers_.size(), count - 1);
+    for (size_t i = 0; i < helpers; ++i) {
+        enqueue([state]() { state->run(); });
+    }
+    state->run();
+    
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&state]() { return state->finished == state->count; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+size_t ThreadPool::hardwareConcurrency() {
+    unsigned int threads = std::thread::hardware_concurrency();
+    return threads == 0 ? 1 : threads;
+}
+
+} // namespace epicchaincpp
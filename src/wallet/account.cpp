@@ -34,6 +34,15 @@ Account::Account(const std::string& xep2, const std::string& password, const std
     // Don't store decrypted key
 }
 
+Account::Account(const std::string& xep2, const Hash160& scriptHash, const std::string& label)
+    : label_(label),
+      address_(scriptHash.toAddress()),
+      scriptHash_(scriptHash),
+      isDefault_(false),
+      isLocked_(true),
+      encryptedPrivateKey_(xep2) {
+}
+
 Account::Account(const std::vector<SharedPtr<ECPublicKey>>& publicKeys, int signingThreshold, const std::string& label)
     : label_(label),
       isDefault_(false),
@@ -72,9 +81,7 @@ bool Account::unlock(const std::string& password) {
     }
     
     try {
-        keyPair_ = std::make_shared<ECKeyPair>(XEP2::decryptToKeyPair(encryptedPrivateKey_, password));
-        isLocked_ = false;
-        return true;
+        return unlock(std::make_shared<ECKeyPair>(XEP2::decryptToKeyPair(encryptedPrivateKey_, password)));
     } catch (const XEP2Exception&) {
         // Invalid password or corrupted encrypted key
         return false;
@@ -87,6 +94,21 @@ bool Account::unlock(const std::string& password) {
     }
 }
 
+bool Account::unlock(const SharedPtr<ECKeyPair>& keyPair) {
+    if (!isLocked_) {
+        return true;
+    }
+    
+    // The script hash may have come from the wallet file rather than the key
+    if (!keyPair || Hash160::fromPublicKey(keyPair->getPublicKey()->getEncoded()) != scriptHash_) {
+        return false;
+    }
+    
+    keyPair_ = keyPair;
+    isLocked_ = false;
+    return true;
+}
+
 bool Account::isMultiSig() const {
     return keyPair_ == nullptr && !isLocked_;
 }
@@ -159,4 +181,8 @@ SharedPtr<Account> Account::fromXEP2(const std::string& xep2, const std::string&
     return std::make_shared<Account>(xep2, password, label);
 }
 
+SharedPtr<Account> Account::fromXEP2(const std::string& xep2, const Hash160& scriptHash, const std::string& label) {
+    return std::make_shared<Account>(xep2, scriptHash, label);
+}
+
 } // namespace epicchaincpp
\ No newline at end of file
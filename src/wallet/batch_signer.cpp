@@ -0,0 +1,112 @@
+#include "epicchaincpp/wallet/batch_signer.hpp"
+#include "epicchaincpp/wallet/wallet.hpp"
+#include "epicchaincpp/wallet/account.hpp"
+#include "epicchaincpp/transaction/transaction.hpp"
+#include "epicchaincpp/transaction/signer.hpp"
+#include "epicchaincpp/transaction/witness.hpp"
+#include "epicchaincpp/script/script_builder.hpp"
+#include "epicchaincpp/types/hash160.hpp"
+#include "epicchaincpp/utils/thread_pool.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <unordered_map>
+
+namespace epicchaincpp {
+
+namespace {
+
+/// A wallet account resolved for signing, with its verification script built once
+struct SigningAccount {
+    SharedPtr<Account> account;
+    Bytes verificationScript;
+};
+
+using SigningAccounts = std::unordered_map<Hash160, SharedPtr<const SigningAccount>, Hash160::Hasher>;
+
+void signTransaction(Transaction& transaction, const SigningAccounts& accounts) {
+    if (transaction.getSigners().empty()) {
+        throw TransactionException("Transaction has no signers");
+    }
+    if (!transaction.getWitnesses().empty()) {
+        throw TransactionException("Transaction is already signed");
+    }
+    
+    Bytes hashData = transaction.getHashData();
+    std::vector<SharedPtr<Witness>> witnesses;
+    witnesses.reserve(transaction.getSigners().size());
+    for (const auto& signer : transaction.getSigners()) {
+        const auto& signing = accounts.at(signer->getAccount());
+        if (!signing) {
+            throw WalletException("No unlocked account in the wallet for signer " + signer->getAccount().toAddress());
+        }
+        Bytes signature = signing->account->sign(hashData);
+        witnesses.push_back(std::make_shared<Witness>(ScriptBuilder::buildInvocationScript({signature}),
+                                                      signing->verificationScript));
+    }
+    
+    // Only touch the transaction once every signer has signed
+    for (const auto& witness : witnesses) {
+        transaction.addWitness(witness);
+    }
+}
+
+} // namespace
+
+BatchSigner::BatchSigner(const SharedPtr<Wallet>& wallet)
+    : BatchSigner(wallet, SharedPtr<ThreadPool>(&ThreadPool::shared(), [](ThreadPool*) {})) {
+}
+
+BatchSigner::BatchSigner(const SharedPtr<Wallet>& wallet, const SharedPtr<ThreadPool>& pool)
+    : wallet_(wallet), pool_(pool) {
+    if (!wallet_) {
+        throw IllegalArgumentException("Wallet cannot be null");
+    }
+}
+
+std::vector<BatchSignResult> BatchSigner::sign(const std::vector<SharedPtr<Transaction>>& transactions) const {
+    // Resolve every distinct signer up front so the workers only read
+    SigningAccounts accounts;
+    for (const auto& transaction : transactions) {
+        if (!transaction) {
+            continue;
+        }
+        for (const auto& signer : transaction->getSigners()) {
+            const Hash160& scriptHash = signer->getAccount();
+            if (accounts.count(scriptHash)) {
+                continue;
+            }
+            auto account = wallet_->getAccount(scriptHash);
+            SharedPtr<const SigningAccount> signing;
+            if (account && !account->isLocked() && account->getKeyPair()) {
+                signing = std::make_shared<SigningAccount>(SigningAccount{account, account->getVerificationScript()});
+            }
+            accounts.emplace(scriptHash, signing);
+        }
+    }
+    
+    std::vector<BatchSignResult> results(transactions.size());
+    pool_->parallelFor(transactions.size(), [&transactions, &accounts, &results](size_t i) {
+        BatchSignResult& result = results[i];
+        result.transaction = transactions[i];
+        if (!result.transaction) {
+            result.error = "Transaction cannot be null";
+            return;
+        }
+        try {
+            signTransaction(*result.transaction, accounts);
+        } catch (const std::exception& e) {
+            result.error = e.what();
+        }
+    });
+    return results;
+}
+
+std::vector<BatchSignResult> BatchSigner::sign(const std::vector<Transaction>& transactions) const {
+    std::vector<SharedPtr<Transaction>> copies;
+    copies.reserve(transactions.size());
+    for (const auto& transaction : transactions) {
+        copies.push_back(std::make_shared<Transaction>(transaction));
+    }
+    return sign(copies);
+}
+
+} // namespace epicchaincpp
@@ -138,6 +138,36 @@ void Wallet::clear() {
 }
 
 void Wallet::save(const std::string& filepath, const std::string& password) const {
+    save(filepath, password, XEP2BulkOptions());
+}
+
+void Wallet::save(const std::string& filepath, const std::string& password, const XEP2BulkOptions& options) const {
+    // Encrypt every unlocked account up front, all scrypt derivations in one batch
+    std::vector<std::string> keys(accounts_.size());
+    if (!password.empty()) {
+        std::vector<size_t> indices;
+        std::vector<Bytes> privateKeys;
+        for (size_t i = 0; i < accounts_.size(); ++i) {
+            const auto& account = accounts_[i];
+            if (account->isLocked()) {
+                continue;
+            }
+            if (!account->getKeyPair()) {
+                throw WalletException("Cannot export multi-signature account");
+            }
+            indices.push_back(i);
+            privateKeys.push_back(account->getKeyPair()->getPrivateKey()->getBytes());
+        }
+        
+        auto results = XEP2::encryptAll(privateKeys, password, ScryptParams::getDefault(), options);
+        for (size_t i = 0; i < results.size(); ++i) {
+            if (!results[i].succeeded()) {
+                throw XEP2Exception(results[i].error);
+            }
+            keys[indices[i]] = results[i].xep2;
+        }
+    }
+    
     nlohmann::json json;
     json["name"] = name_;
     json["version"] = version_;
@@ -149,15 +179,16 @@ void Wallet::save(const std::string& filepath, const std::string& password) cons
     };
     
     json["accounts"] = nlohmann::json::array();
-    for (const auto& account : accounts_) {
+    for (size_t i = 0; i < accounts_.size(); ++i) {
+        const auto& account = accounts_[i];
         nlohmann::json accJson;
         accJson["address"] = account->getAddress();
         accJson["label"] = account->getLabel();
         accJson["isDefault"] = account->getIsDefault();
         accJson["lock"] = account->isLocked();
         
-        if (!password.empty() && !account->isLocked()) {
-            accJson["key"] = account->exportXEP2(password);
+        if (!keys[i].empty()) {
+            accJson["key"] = keys[i];
         } else if (!account->getEncryptedPrivateKey().empty()) {
             accJson["key"] = account->getEncryptedPrivateKey();
         }
@@ -184,6 +215,10 @@ void Wallet::save(const std::string& filepath, const std::string& password) cons
 }
 
 SharedPtr<Wallet> Wallet::load(const std::string& filepath, const std::string& password) {
+    return load(filepath, password, WalletLoadOptions());
+}
+
+SharedPtr<Wallet> Wallet::load(const std::string& filepath, const std::string& password, const WalletLoadOptions& options) {
     std::ifstream file(filepath);
     if (!file.is_open()) {
         throw WalletException("Failed to open wallet file");
@@ -198,32 +233,81 @@ SharedPtr<Wallet> Wallet::load(const std::string& filepath, const std::string& p
         json.value("version", "1.0")
     );
     
+    // Collect the XEP-2 keys first so their scrypt derivations run as one batch
+    std::vector<const nlohmann::json*> entries;
+    std::vector<std::string> encryptedKeys;
     for (const auto& accJson : json["accounts"]) {
+        if (!accJson.contains("key") || accJson["key"].is_null()) {
+            // Watch-only account
+            continue;
+        }
+        entries.push_back(&accJson);
+        std::string key = accJson["key"];
+        if (key.length() == 58) { // XEP-2 encrypted
+            encryptedKeys.push_back(key);
+        }
+    }
+    
+    std::vector<XEP2DecryptResult> decrypted;
+    if (!options.decryptOnFirstUse) {
+        decrypted = XEP2::decryptAll(encryptedKeys, password, ScryptParams::getDefault(), options.xep2);
+    }
+    
+    size_t next = 0;
+    for (const auto* entry : entries) {
+        const auto& accJson = *entry;
         std::string address = accJson["address"];
         std::string label = accJson.value("label", "");
-        bool isDefault = accJson.value("isDefault", false);
+        std::string key = accJson["key"];
         
         SharedPtr<Account> account;
-        
-        if (accJson.contains("key") && !accJson["key"].is_null()) {
-            std::string key = accJson["key"];
-            if (key.length() == 58) { // XEP-2 encrypted
-                account = Account::fromXEP2(key, password, label);
-            } else {
-                account = Account::fromWIF(key, label);
-            }
+        if (key.length() != 58) {
+            account = Account::fromWIF(key, label);
+        } else if (options.decryptOnFirstUse) {
+            next++;
+            account = Account::fromXEP2(key, Hash160::fromAddress(address), label);
         } else {
-            // Watch-only account
-            continue;
+            const XEP2DecryptResult& result = decrypted[next++];
+            if (!result.succeeded()) {
+                throw XEP2Exception("Cannot decrypt account " + address + " (" + result.error + ")");
+            }
+            // Unless asked to keep the key, only the script hash is kept and the
+            // account stays locked as with Account::fromXEP2
+            auto keyPair = std::make_shared<ECKeyPair>(result.privateKey);
+            account = Account::fromXEP2(key, Hash160::fromPublicKey(keyPair->getPublicKey()->getEncoded()), label);
+            if (options.keepDecryptedKeys) {
+                account->unlock(keyPair);
+            }
         }
         
-        account->setIsDefault(isDefault);
+        account->setIsDefault(accJson.value("isDefault", false));
         wallet->addAccount(account);
     }
     
     return wallet;
 }
 
+size_t Wallet::unlockAll(const std::string& password, const XEP2BulkOptions& options) {
+    std::vector<SharedPtr<Account>> locked;
+    std::vector<std::string> keys;
+    for (const auto& account : accounts_) {
+        if (account->isLocked() && !account->getEncryptedPrivateKey().empty()) {
+            locked.push_back(account);
+            keys.push_back(account->getEncryptedPrivateKey());
+        }
+    }
+    
+    auto results = XEP2::decryptAll(keys, password, ScryptParams::getDefault(), options);
+    size_t unlocked = 0;
+    for (size_t i = 0; i < results.size(); ++i) {
+        if (results[i].succeeded() &&
+            locked[i]->unlock(std::make_shared<ECKeyPair>(results[i].privateKey))) {
+            unlocked++;
+        }
+    }
+    return unlocked;
+}
+
 void Wallet::updateIndices() {
     accountsByAddress_.clear();
     accountsByScriptHash_.clear();
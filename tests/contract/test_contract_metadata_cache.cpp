@@ -0,0 +1,180 @@
+#include <catch2/catch_test_macros.hpp>
+#include "epicchaincpp/contract/contract_metadata_cache.hpp"
+#include "epicchaincpp/utils/base64.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace epicchaincpp;
+
+namespace {
+
+constexpr uint32_t MAINNET = 860833102;
+constexpr uint32_t TESTNET = 894710606;
+
+ContractMetadata makeMetadata(int id) {
+    ContractMetadata metadata;
+    metadata.id = id;
+    metadata.updateCounter = 1;
+    metadata.nef = "TkVGMw==";
+    metadata.manifest = {{"name", "Token" + std::to_string(id)}};
+    return metadata;
+}
+
+} // namespace
+
+TEST_CASE("ContractMetadataCache Tests", "[contract]") {
+    ContractMetadataCache cache;
+    Hash160 token("0xd2a4cff31913016155e38e474a2c06d08be276cf");
+    
+    SECTION("Fetches once and serves hits") {
+        int fetches = 0;
+        auto fetch = [&fetches]() { fetches++; return makeMetadata(7); };
+        
+        REQUIRE(cache.getContractMetadata(MAINNET, token, fetch)->id == 7);
+        REQUIRE(cache.getContractMetadata(MAINNET, token, fetch)->manifest["name"] == "Token7");
+        REQUIRE(fetches == 1);
+        
+        auto stats = cache.getStats();
+        REQUIRE(stats.hits == 1);
+        REQUIRE(stats.misses == 1);
+        REQUIRE(stats.contracts == 1);
+    }
+    
+    SECTION("Concurrent callers share one fetch") {
+        std::atomic<int> fetches{0};
+        auto fetch = [&fetches]() {
+            fetches++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            TokenMetadata metadata;
+            metadata.symbol = "GAS";
+            metadata.decimals = 8;
+            return metadata;
+        };
+        
+        std::vector<std::thread> threads;
+        std::atomic<int> correct{0};
+        for (int i = 0; i < 8; ++i) {
+            threads.emplace_back([&]() {
+                if (cache.getTokenMetadata(MAINNET, token, fetch)->symbol == "GAS") {
+                    correct++;
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        REQUIRE(fetches == 1);
+        REQUIRE(correct == 8);
+    }
+    
+    SECTION("Failed fetches are not cached") {
+        int fetches = 0;
+        auto failing = [&fetches]() -> ContractMetadata {
+            fetches++;
+            throw std::runtime_error("node unavailable");
+        };
+        REQUIRE_THROWS_AS(cache.getContractMetadata(MAINNET, token, failing), std::runtime_error);
+        REQUIRE(cache.getContractMetadata(MAINNET, token, [&fetches]() { fetches++; return makeMetadata(1); })->id == 1);
+        REQUIRE(fetches == 2);
+    }
+    
+    SECTION("ContractManagement Update notification invalidates") {
+        cache.getContractMetadata(MAINNET, token, []() { return makeMetadata(1); });
+        cache.getTokenMetadata(MAINNET, token, []() { return TokenMetadata{"GAS", 8}; });
+        
+        Bytes littleEndian = token.toLittleEndianArray();
+        nlohmann::json notification = {
+            {"contract", "0xfffdc93764dbaddd97c48f252a53ea4643faa3fd"},
+            {"eventname", "Update"},
+            {"state", {{"type", "Array"}, {"value", {{{"type", "ByteString"}, {"value", Base64::encode(littleEndian)}}}}}}
+        };
+        
+        nlohmann::json transfer = notification;
+        transfer["eventname"] = "Transfer";
+        REQUIRE_FALSE(cache.onNotification(MAINNET, transfer));
+        REQUIRE(cache.getStats().contracts == 1);
+        
+        REQUIRE(cache.onNotification(TESTNET, notification));
+        REQUIRE(cache.getStats().contracts == 1);
+        
+        REQUIRE(cache.onNotification(MAINNET, notification));
+        REQUIRE(cache.getStats().contracts == 0);
+        REQUIRE(cache.getStats().tokens == 0);
+    }
+    
+    SECTION("Networks do not share entries") {
+        cache.getContractMetadata(MAINNET, token, []() { return makeMetadata(1); });
+        REQUIRE(cache.getContractMetadata(TESTNET, token, []() { return makeMetadata(2); })->id == 2);
+        REQUIRE(cache.getContractMetadata(MAINNET, token, []() { return makeMetadata(3); })->id == 1);
+        REQUIRE(cache.getStats().contracts == 2);
+        
+        cache.invalidate(TESTNET, token);
+        REQUIRE(cache.getContractMetadata(MAINNET, token, []() { return makeMetadata(3); })->id == 1);
+        REQUIRE(cache.getStats().contracts == 1);
+    }
+    
+    SECTION("Persistence round trip") {
+        std::string path = "contract_metadata_cache_test.json";
+        std::remove(path.c_str());
+        
+        {
+            ContractMetadataCache persisted;
+            persisted.setPersistencePath(path);
+            persisted.getContractMetadata(MAINNET, token, []() { return makeMetadata(3); });
+            persisted.getTokenMetadata(MAINNET, token, []() { return TokenMetadata{"GAS", 8}; });
+            persisted.getContractMetadata(TESTNET, token, []() { return makeMetadata(4); });
+            persisted.flush();
+        }
+        
+        ContractMetadataCache restored;
+        restored.setPersistencePath(path);
+        REQUIRE(restored.getStats().contracts == 2);
+        auto metadata = restored.getContractMetadata(MAINNET, token, []() -> ContractMetadata {
+            throw std::runtime_error("should be cached");
+        });
+        REQUIRE(metadata->id == 3);
+        REQUIRE(metadata->manifest["name"] == "Token3");
+        REQUIRE(restored.getContractMetadata(TESTNET, token, []() -> ContractMetadata {
+            throw std::runtime_error("should be cached");
+        })->id == 4);
+        REQUIRE(restored.getTokenMetadata(MAINNET, token, []() -> TokenMetadata {
+            throw std::runtime_error("should be cached");
+        })->decimals == 8);
+        
+        std::remove(path.c_str());
+    }
+    
+    SECTION("A failed flush keeps the changes pending") {
+        std::string path = "contract_metadata_cache_pending.json";
+        std::remove(path.c_str());
+        
+        {
+            ContractMetadataCache pending;
+            pending.setPersistencePath("missing_directory/contract_metadata_cache.json");
+            pending.getContractMetadata(MAINNET, token, []() { return makeMetadata(5); });
+            REQUIRE_THROWS_AS(pending.flush(), RuntimeException);
+            REQUIRE_THROWS_AS(pending.flush(), RuntimeException);
+            
+            pending.setPersistencePath(path);
+            pending.flush();
+        }
+        
+        ContractMetadataCache restored;
+        restored.setPersistencePath(path);
+        REQUIRE(restored.getStats().contracts == 1);
+        
+        std::remove(path.c_str());
+    }
+    
+    SECTION("The shared cache is one owned instance") {
+        SharedPtr<ContractMetadataCache> shared = ContractMetadataCache::shared();
+        REQUIRE(shared);
+        REQUIRE(shared == ContractMetadataCache::shared());
+    }
+}
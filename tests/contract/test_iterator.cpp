@@ -0,0 +1,178 @@
+#include <catch2/catch_test_macros.hpp>
+#include "epicchaincpp/contract/iterator.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace epicchaincpp;
+
+namespace {
+
+/// Serves [0, total) in pages of pageSize, like traverseiterator
+ItemStream::PageFetcher countingFetcher(int total, int pageSize, std::atomic<int>& calls) {
+    auto next = std::make_shared<int>(0);
+    return [total, pageSize, next, &calls]() {
+        calls++;
+        IteratorPage page;
+        for (int i = 0; i < pageSize && *next < total; ++i) {
+            page.items.push_back({{"type", "Integer"}, {"value", std::to_string((*next)++)}});
+        }
+        page.hasMore = static_cast<int>(page.items.size()) == pageSize;
+        return page;
+    };
+}
+
+/// Serves [0, total) like traverseiterator on a node that caps pages at maxItems
+std::function<nlohmann::json(uint32_t)> cappedTraverse(int total, int maxItems, std::vector<uint32_t>& requests) {
+    auto next = std::make_shared<int>(0);
+    return [total, maxItems, next, &requests](uint32_t count) {
+        requests.push_back(count);
+        nlohmann::json items = nlohmann::json::array();
+        for (int i = 0; i < static_cast<int>(count) && i < maxItems && *next < total; ++i) {
+            items.push_back({{"type", "Integer"}, {"value", std::to_string((*next)++)}});
+        }
+        return items;
+    };
+}
+
+} // namespace
+
+TEST_CASE("ItemStream Tests", "[contract]") {
+    
+    SECTION("Streams every item across pages in order") {
+        for (bool prefetch : {false, true}) {
+            std::atomic<int> calls{0};
+            int closed = 0;
+            ItemStream stream(countingFetcher(250, 100, calls), [&closed]() { closed++; }, prefetch);
+            
+            std::vector<int> values;
+            for (const auto& item : stream) {
+                values.push_back(std::stoi(item["value"].get<std::string>()));
+            }
+            
+            REQUIRE(values.size() == 250);
+            for (int i = 0; i < 250; ++i) {
+                REQUIRE(values[i] == i);
+            }
+            REQUIRE(calls == 3);
+            REQUIRE(stream.isClosed());
+            REQUIRE(closed == 1);
+        }
+    }
+    
+    SECTION("Close stops early and runs the close callback once") {
+        std::atomic<int> calls{0};
+        int closed = 0;
+        {
+            ItemStream stream(countingFetcher(1000, 10, calls), [&closed]() { closed++; });
+            REQUIRE(stream.take(15).size() == 15);
+            stream.close();
+            
+            nlohmann::json item;
+            REQUIRE_FALSE(stream.next(item));
+            REQUIRE(closed == 1);
+        }
+        REQUIRE(closed == 1);
+        // The first two pages plus at most one prefetched page
+        REQUIRE(calls <= 3);
+    }
+    
+    SECTION("Destructor closes an unfinished stream") {
+        std::atomic<int> calls{0};
+        int closed = 0;
+        {
+            ItemStream stream(countingFetcher(1000, 10, calls), [&closed]() { closed++; });
+            nlohmann::json item;
+            REQUIRE(stream.next(item));
+        }
+        REQUIRE(closed == 1);
+    }
+    
+    SECTION("Fetch errors reach the caller") {
+        ItemStream stream([]() -> IteratorPage { throw std::runtime_error("session expired"); });
+        nlohmann::json item;
+        REQUIRE_THROWS_AS(stream.next(item), std::runtime_error);
+    }
+    
+    SECTION("Inline results need no fetching") {
+        ItemStream stream(std::vector<nlohmann::json>{1, 2, 3});
+        REQUIRE(stream.take().size() == 3);
+        REQUIRE(stream.isClosed());
+    }
+}
+
+TEST_CASE("Iterator result parsing", "[contract]") {
+    
+    SECTION("Array stack item is streamed directly") {
+        nlohmann::json result = {
+            {"state", "HALT"},
+            {"stack", {{{"type", "Array"}, {"value", {{{"type", "ByteString"}, {"value", "AQ=="}}}}}}}
+        };
+        auto stream = Iterator::fromInvokeResult(result, nullptr);
+        auto items = stream->take();
+        REQUIRE(items.size() == 1);
+        REQUIRE(items[0]["value"] == "AQ==");
+    }
+    
+    SECTION("Iterator expanded by a node without sessions") {
+        nlohmann::json result = {
+            {"state", "HALT"},
+            {"stack", {{{"type", "InteropInterface"}, {"iterator", {{{"type", "ByteString"}, {"value", "Ag=="}}}}, {"truncated", false}}}}
+        };
+        auto stream = Iterator::fromInvokeResult(result, nullptr);
+        REQUIRE(stream->take().size() == 1);
+    }
+    
+    SECTION("Empty stack yields an empty stream") {
+        nlohmann::json result = {{"state", "FAULT"}, {"stack", nlohmann::json::array()}};
+        REQUIRE(Iterator::fromInvokeResult(result, nullptr)->take().empty());
+    }
+}
+
+TEST_CASE("Iterator paging", "[contract]") {
+    
+    SECTION("Page size above the node cap still reads everything") {
+        std::vector<uint32_t> requests;
+        ItemStream stream(Iterator::makePageFetcher(cappedTraverse(250, 100, requests), 500), nullptr, false);
+        REQUIRE(stream.take().size() == 250);
+        // 100, 100, then 50 is shorter than the first page
+        REQUIRE(requests.size() == 3);
+        REQUIRE(requests[0] == 500);
+    }
+    
+    SECTION("Page size above the node cap with an exact multiple") {
+        std::vector<uint32_t> requests;
+        ItemStream stream(Iterator::makePageFetcher(cappedTraverse(200, 100, requests), 500), nullptr, false);
+        REQUIRE(stream.take().size() == 200);
+        REQUIRE(requests.size() == 3);
+    }
+    
+    SECTION("A short page within the default cap ends the stream") {
+        std::vector<uint32_t> requests;
+        ItemStream stream(Iterator::makePageFetcher(cappedTraverse(130, 100, requests), 50), nullptr, false);
+        REQUIRE(stream.take().size() == 130);
+        REQUIRE(requests.size() == 3);
+    }
+    
+    SECTION("A node cap below the default still reads everything") {
+        std::vector<uint32_t> requests;
+        ItemStream stream(Iterator::makePageFetcher(cappedTraverse(45, 20, requests), 50), nullptr, false);
+        REQUIRE(stream.take().size() == 45);
+        // 20, 20, then 5 is shorter than the first page
+        REQUIRE(requests.size() == 3);
+    }
+    
+    SECTION("A short first page needs one more call to confirm the end") {
+        std::vector<uint32_t> requests;
+        ItemStream stream(Iterator::makePageFetcher(cappedTraverse(30, 100, requests), 50), nullptr, false);
+        REQUIRE(stream.take().size() == 30);
+        REQUIRE(requests.size() == 2);
+    }
+    
+    SECTION("Empty iterator") {
+        std::vector<uint32_t> requests;
+        ItemStream stream(Iterator::makePageFetcher(cappedTraverse(0, 100, requests), 500), nullptr, false);
+        REQUIRE(stream.take().empty());
+        REQUIRE(requests.size() == 1);
+    }
+}
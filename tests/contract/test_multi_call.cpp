@@ -0,0 +1,151 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../mock/local_http_server.hpp"
+#include "epicchaincpp/contract/multi_call.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
+#include "epicchaincpp/script/op_code.hpp"
+#include "epicchaincpp/utils/base64.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <algorithm>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace epicchaincpp;
+using json = nlohmann::json;
+
+namespace {
+
+/// Recover the method names of the contract calls in a MultiCall script, in call order.
+/// The tests only call methods named "call<N>" or "fail", which are pushed verbatim.
+std::vector<std::string> calledMethods(const Bytes& script) {
+    static const std::regex methodName("call[0-9]+|fail");
+    std::string text(script.begin(), script.end());
+    std::vector<std::string> methods;
+    for (std::sregex_iterator it(text.begin(), text.end(), methodName), end; it != end; ++it) {
+        methods.push_back(it->str());
+    }
+    // Calls are pushed in reverse so PACK restores their order
+    std::reverse(methods.begin(), methods.end());
+    return methods;
+}
+
+/// Answer invokescript like a node: each call returns its own method name,
+/// and a batch containing a "fail" call faults
+test::LocalHttpServer::Reply invokeScriptReply(const test::LocalHttpServer::Request& request) {
+    json body = json::parse(request.body);
+    json result = {{"script", body["params"][0]}, {"epicpulseConsumed", "1000"}};
+    json items = json::array();
+    bool fault = false;
+    for (const auto& method : calledMethods(Base64::decode(body["params"][0].get<std::string>()))) {
+        fault = fault || method == "fail";
+        items.push_back({{"type", "ByteString"}, {"value", Base64::encode(Bytes(method.begin(), method.end()))}});
+    }
+    if (fault) {
+        result["state"] = "FAULT";
+        result["exception"] = "called fail";
+        result["stack"] = json::array();
+    } else {
+        result["state"] = "HALT";
+        result["stack"] = json::array({{{"type", "Array"}, {"value", items}}});
+    }
+    
+    test::LocalHttpServer::Reply reply;
+    reply.body = json({{"jsonrpc", "2.0"}, {"id", body["id"]}, {"result", result}}).dump();
+    return reply;
+}
+
+} // namespace
+
+TEST_CASE("MultiCall Tests", "[contract]") {
+    Hash160 token("0xd2a4cff31913016155e38e474a2c06d08be276cf");
+    Hash160 other("0xef4073a0f2b305a38ec4050e4d3d28bc40ea63f5");
+    
+    SECTION("Calls are split into packed batches") {
+        MultiCall multiCall(nullptr, 2);
+        REQUIRE(multiCall.add(token, "symbol") == 0);
+        REQUIRE(multiCall.add(token, "decimals") == 1);
+        REQUIRE(multiCall.add(other, "symbol") == 2);
+        REQUIRE(multiCall.size() == 3);
+        
+        auto scripts = multiCall.buildScripts();
+        REQUIRE(scripts.size() == 2);
+        for (const auto& script : scripts) {
+            REQUIRE(script.back() == static_cast<uint8_t>(OpCode::PACK));
+        }
+        REQUIRE(scripts[0][scripts[0].size() - 2] == static_cast<uint8_t>(OpCode::PUSH2));
+        REQUIRE(scripts[1][scripts[1].size() - 2] == static_cast<uint8_t>(OpCode::PUSH1));
+        
+        multiCall.clear();
+        REQUIRE(multiCall.buildScripts().empty());
+    }
+    
+    SECTION("Execute without a client fails") {
+        MultiCall multiCall(nullptr);
+        multiCall.add(token, "symbol");
+        REQUIRE_THROWS_AS(multiCall.execute(), IllegalStateException);
+    }
+    
+    SECTION("Typed decoders") {
+        Bytes littleEndian = token.toLittleEndianArray();
+        MultiCallResult result({
+            {{"type", "ByteString"}, {"value", Base64::encode(Bytes{'G', 'A', 'S'})}},
+            {{"type", "Integer"}, {"value", "8"}},
+            {{"type", "Boolean"}, {"value", true}},
+            {{"type", "ByteString"}, {"value", Base64::encode(littleEndian)}},
+            {{"type", "Integer"}, {"value", "-5200000000000"}}
+        });
+        
+        REQUIRE(result.size() == 5);
+        REQUIRE(result.getString(0) == "GAS");
+        REQUIRE(result.getInteger(1) == 8);
+        REQUIRE(result.getBoolean(2));
+        REQUIRE(result.getInteger(2) == 1);
+        REQUIRE(result.getHash160(3) == token);
+        REQUIRE(result.getInteger(4) == -5200000000000LL);
+        
+        REQUIRE_THROWS_AS(result.getInteger(0), IllegalStateException);
+        REQUIRE_THROWS_AS(result.getString(1), IllegalStateException);
+        REQUIRE_THROWS_AS(result.getItem(5), IllegalArgumentException);
+    }
+}
+
+TEST_CASE("MultiCall execute", "[contract]") {
+    Hash160 token("0xd2a4cff31913016155e38e474a2c06d08be276cf");
+    Hash160 other("0xef4073a0f2b305a38ec4050e4d3d28bc40ea63f5");
+    test::LocalHttpServer server(invokeScriptReply);
+    auto client = std::make_shared<EpicChainRpcClient>(server.url());
+    
+    SECTION("Results map back to their calls across batches") {
+        MultiCall multiCall(client, 3);
+        std::vector<size_t> indices;
+        for (int i = 0; i < 7; ++i) {
+            indices.push_back(multiCall.add(i % 2 == 0 ? token : other, "call" + std::to_string(i)));
+        }
+        
+        auto results = multiCall.execute();
+        REQUIRE(server.requests() == 3);
+        REQUIRE(results.size() == 7);
+        for (int i = 0; i < 7; ++i) {
+            REQUIRE(results.getString(indices[i]) == "call" + std::to_string(i));
+        }
+    }
+    
+    SECTION("A fault in the middle of a batch aborts the execution") {
+        MultiCall multiCall(client, 3);
+        multiCall.add(token, "call0");
+        multiCall.add(token, "call1");
+        multiCall.add(token, "call2");
+        multiCall.add(token, "call3");
+        multiCall.add(other, "fail");
+        multiCall.add(token, "call5");
+        
+        try {
+            multiCall.execute();
+            FAIL("Expected a ScriptException");
+        } catch (const ScriptException& e) {
+            REQUIRE(std::string(e.what()).find("called fail") != std::string::npos);
+        }
+        // The first batch ran; the faulting one was the last request sent
+        REQUIRE(server.requests() == 2);
+    }
+}
@@ -13,7 +13,7 @@ TEST_CASE("SmartContract Tests", "[contract]") {
     
     SECTION("Constructor with script hash") {
         Hash160 scriptHash("0x0102030405060708090a0b0c0d0e0f1011121314");
-        SharedPtr<NeoRpcClient> client = nullptr; // Mock client
+        SharedPtr<EpicChainRpcClient> client = nullptr; // Mock client
         
         SmartContract contract(scriptHash, client);
         
@@ -23,8 +23,8 @@ TEST_CASE("SmartContract Tests", "[contract]") {
     
     SECTION("Set and get RPC client") {
         Hash160 scriptHash("0x1234567890abcdef1234567890abcdef12345678");
-        SharedPtr<NeoRpcClient> client1 = nullptr;
-        SharedPtr<NeoRpcClient> client2 = nullptr;
+        SharedPtr<EpicChainRpcClient> client1 = nullptr;
+        SharedPtr<EpicChainRpcClient> client2 = nullptr;
         
         SmartContract contract(scriptHash, client1);
         REQUIRE(contract.getClient() == client1);
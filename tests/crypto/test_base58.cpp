@@ -1,11 +1,42 @@
 #include <catch2/catch_test_macros.hpp>
 #include "epicchaincpp/utils/base58.hpp"
 #include "epicchaincpp/utils/hex.hpp"
+#include <random>
 #include <string>
 #include <vector>
 
 using namespace epicchaincpp;
 
+namespace {
+
+/// Textbook digit-at-a-time encoding to check the limb arithmetic against
+std::string referenceEncode(const Bytes& data) {
+    const char* alphabet = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+    std::vector<int> digits;
+    for (uint8_t byte : data) {
+        int carry = byte;
+        for (int& digit : digits) {
+            carry += digit * 256;
+            digit = carry % 58;
+            carry /= 58;
+        }
+        while (carry > 0) {
+            digits.push_back(carry % 58);
+            carry /= 58;
+        }
+    }
+    std::string result;
+    for (size_t i = 0; i < data.size() && data[i] == 0; ++i) {
+        result += '1';
+    }
+    for (auto it = digits.rbegin(); it != digits.rend(); ++it) {
+        result += alphabet[*it];
+    }
+    return result;
+}
+
+} // namespace
+
 TEST_CASE("Base58 Tests", "[crypto]") {
     
     // Test vectors of strings and their Base58 encodings
@@ -140,4 +171,60 @@ TEST_CASE("Base58 Tests", "[crypto]") {
         REQUIRE(encoded2[0] == '1');
         REQUIRE(encoded2[1] == '1'); // Two leading zeros become "11"
     }
-}
\ No newline at end of file
+    
+    SECTION("Limb arithmetic matches digit-at-a-time encoding") {
+        std::mt19937 random(58);
+        for (size_t length = 0; length <= 100; ++length) {
+            for (size_t leadingZeros : {size_t(0), size_t(1), size_t(3)}) {
+                Bytes data(length);
+                for (size_t i = 0; i < length; ++i) {
+                    data[i] = i < leadingZeros ? 0 : static_cast<uint8_t>(random());
+                }
+                std::string encoded = Base58::encode(data);
+                REQUIRE(encoded == referenceEncode(data));
+                REQUIRE(Base58::decode(encoded) == data);
+                
+                Bytes exact(length);
+                REQUIRE(Base58::tryDecode(encoded, exact.data(), length));
+                REQUIRE(exact == data);
+            }
+        }
+    }
+    
+    SECTION("Fixed size payloads") {
+        // Address, WIF and XEP-2 sizes with checksum take their own paths
+        for (size_t length : {size_t(25), size_t(38), size_t(43)}) {
+            for (uint8_t fill : {uint8_t(0x00), uint8_t(0x01), uint8_t(0x80), uint8_t(0xff)}) {
+                Bytes data(length, fill);
+                data[length - 1] = 0x5a;
+                std::string encoded = Base58::encode(data);
+                REQUIRE(encoded == referenceEncode(data));
+                
+                Bytes exact(length);
+                REQUIRE(Base58::tryDecode(encoded, exact.data(), length));
+                REQUIRE(exact == data);
+                
+                // One byte more or less than the string holds is rejected
+                Bytes other(length + 1);
+                REQUIRE_FALSE(Base58::tryDecode(encoded, other.data(), length + 1));
+                REQUIRE_FALSE(Base58::tryDecode(encoded, other.data(), length - 1));
+            }
+        }
+    }
+    
+    SECTION("Single pass Base58Check decoding") {
+        Bytes expected = {
+            6, 161, 159, 136, 34, 110, 33, 238, 14, 79, 14, 218, 133, 13, 
+            109, 40, 194, 236, 153, 44, 61, 157, 254
+        };
+        Bytes decoded(expected.size());
+        REQUIRE(Base58::tryDecodeCheck("tz1Y3qqTg9HdrzZGbEjiCPmwuZ7fWVxpPtRw", decoded.data(), decoded.size()));
+        REQUIRE(decoded == expected);
+        
+        REQUIRE_FALSE(Base58::tryDecodeCheck("tz1Y3qqTg9HdrzZGbEjiCPmwuZ7fWVxpPtrW", decoded.data(), decoded.size()));
+        REQUIRE_FALSE(Base58::tryDecodeCheck("tz1Y3qqTg9HdrzZGbEjiCPmwuZ7fWVxpPtRw", decoded.data(), decoded.size() - 1));
+        REQUIRE_FALSE(Base58::tryDecodeCheck("tz1Y3qqTg0HdrzZGbEjiCPmwuZ7fWVxpPtRw", decoded.data(), decoded.size()));
+        REQUIRE_FALSE(Base58::tryDecodeCheck("", decoded.data(), decoded.size()));
+        REQUIRE(Base58::encodeCheck(expected.data(), expected.size()) == "tz1Y3qqTg9HdrzZGbEjiCPmwuZ7fWVxpPtRw");
+    }
+}
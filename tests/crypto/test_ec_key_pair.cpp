@@ -1,9 +1,12 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 #include "epicchaincpp/crypto/ec_key_pair.hpp"
+#include "epicchaincpp/crypto/ecdsa_signature.hpp"
 #include "epicchaincpp/crypto/wif.hpp"
 #include "epicchaincpp/utils/hex.hpp"
 #include "epicchaincpp/exceptions.hpp"
+#include <thread>
+#include <vector>
 
 using namespace epicchaincpp;
 using Catch::Matchers::Equals;
@@ -134,4 +137,50 @@ TEST_CASE("ECKeyPair Tests", "[crypto]") {
         ECKeyPair keyPair3 = ECKeyPair::generate();
         REQUIRE_FALSE(keyPair1.getPrivateKey()->getBytes() == keyPair3.getPrivateKey()->getBytes());
     }
+    
+    SECTION("Public key is derived once") {
+        ECKeyPair keyPair(Hex::decode("c7134d6fd8e73d819e82755c64c93788d8db0961929e025a53363c4cc02a6962"));
+        auto privateKey = keyPair.getPrivateKey();
+        
+        REQUIRE(privateKey->getPublicKey() == privateKey->getPublicKey());
+        REQUIRE(*keyPair.getPublicKey() == *privateKey->getPublicKey());
+        
+        // Copies share the cached key
+        ECPrivateKey copy = *privateKey;
+        REQUIRE(copy.getPublicKey() == privateKey->getPublicKey());
+    }
+    
+    SECTION("Repeated signing with a cached key") {
+        ECKeyPair keyPair = ECKeyPair::generate();
+        Bytes message = {0x01, 0x02, 0x03};
+        
+        for (int i = 0; i < 10; ++i) {
+            auto signature = keyPair.sign(message);
+            REQUIRE(signature->getBytes().size() == 64);
+            REQUIRE(keyPair.getPublicKey()->verify(message, signature));
+        }
+    }
+    
+    SECTION("Concurrent signing with one key") {
+        ECKeyPair keyPair(Hex::decode("c7134d6fd8e73d819e82755c64c93788d8db0961929e025a53363c4cc02a6962"));
+        Bytes message = {0x0A, 0x0B};
+        std::vector<SharedPtr<ECDSASignature>> signatures(8);
+        
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < signatures.size(); ++i) {
+            threads.emplace_back([&, i]() { signatures[i] = keyPair.sign(message); });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        
+        for (const auto& signature : signatures) {
+            REQUIRE(keyPair.getPublicKey()->verify(message, signature));
+        }
+    }
+    
+    SECTION("Reject private keys outside the curve order") {
+        REQUIRE_THROWS_AS(ECPrivateKey(Bytes(32, 0x00)), IllegalArgumentException);
+        REQUIRE_THROWS_AS(ECPrivateKey(Bytes(32, 0xFF)), IllegalArgumentException);
+    }
 }
\ No newline at end of file
@@ -100,4 +100,107 @@ TEST_CASE("Hash Tests", "[crypto]") {
         Bytes result4 = HashUtils::ripemd160(input);
         REQUIRE(result3 == result4);
     }
-}
\ No newline at end of file
+    
+    SECTION("Fixed-size digests match the Bytes overloads") {
+        Bytes input = {0x01, 0x02, 0x03, 0x04};
+        
+        Digest256 sha;
+        HashUtils::sha256(input.data(), input.size(), sha);
+        REQUIRE(Bytes(sha.begin(), sha.end()) == HashUtils::sha256(input));
+        
+        Digest256 doubleSha;
+        HashUtils::doubleSha256(input.data(), input.size(), doubleSha);
+        REQUIRE(Bytes(doubleSha.begin(), doubleSha.end()) == HashUtils::doubleSha256(input));
+        
+        Digest160 ripemd;
+        HashUtils::ripemd160(input.data(), input.size(), ripemd);
+        REQUIRE(Hex::encode(Bytes(ripemd.begin(), ripemd.end())) == "179bb366e5e224b8bf4ce302cefc5744961839c5");
+        
+        Digest160 hash160;
+        HashUtils::sha256ThenRipemd160(input.data(), input.size(), hash160);
+        REQUIRE(Bytes(hash160.begin(), hash160.end()) == HashUtils::sha256ThenRipemd160(input));
+        
+        Digest256 keccak;
+        HashUtils::keccak256(input.data(), input.size(), keccak);
+        REQUIRE(Bytes(keccak.begin(), keccak.end()) == HashUtils::keccak256(input));
+    }
+    
+    SECTION("Incremental SHA256") {
+        Bytes input(1000, 0xFF);
+        Sha256Hasher hasher;
+        hasher.update(input.data(), 1);
+        hasher.update(input.data() + 1, 499);
+        hasher.update(input.data() + 500, 500);
+        Digest256 hash = hasher.final();
+        REQUIRE(Bytes(hash.begin(), hash.end()) == HashUtils::sha256(input));
+        
+        // The hasher starts over after final()
+        hasher.update(Bytes{});
+        Digest256 empty = hasher.final();
+        REQUIRE(Hex::encode(Bytes(empty.begin(), empty.end())) ==
+                "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+        
+        // Hashers nest without sharing state
+        Sha256Hasher outer;
+        outer.update(input);
+        {
+            Sha256Hasher inner;
+            inner.update(Bytes{0x01, 0x02, 0x03, 0x04});
+            Digest256 innerHash = inner.final();
+            REQUIRE(Hex::encode(Bytes(innerHash.begin(), innerHash.end())) ==
+                    "9f64a747e1b97f131fabb6b447296c9b6f0201e79fb3c5356e6c77e89b6a806a");
+        }
+        Digest256 outerHash = outer.final();
+        REQUIRE(Bytes(outerHash.begin(), outerHash.end()) == HashUtils::sha256(input));
+    }
+    
+    SECTION("Sha256Hasher as a BinaryWriter sink") {
+        Bytes large(2000, 0x02);
+        Sha256Hasher hasher;
+        BinaryWriter writer(hasher);
+        writer.writeUInt32(0x01020304);
+        writer.writeVarBytes(large);
+        writer.writeByte(0x03);
+        REQUIRE(writer.size() == 0);
+        
+        BinaryWriter buffered;
+        buffered.writeUInt32(0x01020304);
+        buffered.writeVarBytes(large);
+        buffered.writeByte(0x03);
+        Digest256 hash = hasher.final();
+        REQUIRE(Bytes(hash.begin(), hash.end()) == HashUtils::sha256(buffered.toArray()));
+    }
+    
+    SECTION("Batch SHA256 and Hash160 match one-at-a-time hashing") {
+        // Lengths around the one- and two-block padding boundaries, plus long messages
+        std::vector<Bytes> messages;
+        for (size_t length = 0; length <= 130; ++length) {
+            Bytes message(length);
+            for (size_t i = 0; i < length; ++i) {
+                message[i] = static_cast<uint8_t>(length * 7 + i);
+            }
+            messages.push_back(message);
+        }
+        messages.push_back(Bytes(1000, 0x5a));
+        messages.push_back(Bytes(4096, 0xa5));
+        std::vector<ByteSpan> inputs(messages.begin(), messages.end());
+        
+        using Kernel = HashUtils::HashKernel;
+        for (Kernel kernel : {Kernel::Auto, Kernel::Scalar, Kernel::ShaNi, Kernel::Avx2, Kernel::Avx512}) {
+            if (!HashUtils::isKernelSupported(kernel)) {
+                continue;
+            }
+            std::vector<Digest256> hashes(inputs.size());
+            std::vector<Digest160> hash160s(inputs.size());
+            HashUtils::sha256Many(inputs.data(), hashes.data(), inputs.size(), kernel);
+            HashUtils::hash160Many(inputs.data(), hash160s.data(), inputs.size(), kernel);
+            for (size_t i = 0; i < messages.size(); ++i) {
+                REQUIRE(Bytes(hashes[i].begin(), hashes[i].end()) == HashUtils::sha256(messages[i]));
+                REQUIRE(Bytes(hash160s[i].begin(), hash160s[i].end()) == HashUtils::sha256ThenRipemd160(messages[i]));
+            }
+        }
+        
+        REQUIRE(HashUtils::sha256Many(std::vector<ByteSpan>{}).empty());
+        REQUIRE(HashUtils::isKernelSupported(HashUtils::preferredKernel()));
+    }
+}
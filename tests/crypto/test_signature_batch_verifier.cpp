@@ -0,0 +1,72 @@
+#include <catch2/catch_test_macros.hpp>
+#include "epicchaincpp/crypto/signature_batch_verifier.hpp"
+#include "epicchaincpp/crypto/ec_key_pair.hpp"
+#include "epicchaincpp/crypto/ecdsa_signature.hpp"
+#include "epicchaincpp/crypto/hash.hpp"
+#include "epicchaincpp/utils/thread_pool.hpp"
+#include <vector>
+
+using namespace epicchaincpp;
+
+TEST_CASE("SignatureBatchVerifier Tests", "[crypto]") {
+    auto pool = std::make_shared<ThreadPool>(4);
+    std::vector<ECKeyPair> keyPairs = {ECKeyPair::generate(), ECKeyPair::generate(), ECKeyPair::generate()};
+    
+    SECTION("Valid signatures") {
+        SignatureBatchVerifier verifier(pool);
+        for (size_t i = 0; i < 30; ++i) {
+            const auto& keyPair = keyPairs[i % keyPairs.size()];
+            Bytes message(1, static_cast<uint8_t>(i));
+            verifier.add(HashUtils::sha256(message), keyPair.sign(message), keyPair.getPublicKey());
+        }
+        REQUIRE(verifier.size() == 30);
+        
+        auto result = verifier.verify();
+        REQUIRE(result.allValid());
+        REQUIRE(result.valid.size() == 30);
+        for (bool valid : result.valid) {
+            REQUIRE(valid);
+        }
+    }
+    
+    SECTION("Failures are reported by index") {
+        SignatureBatchVerifier verifier(pool);
+        Bytes message = {0x01, 0x02, 0x03};
+        Bytes hash = HashUtils::sha256(message);
+        auto signature = keyPairs[0].sign(message);
+        
+        verifier.add(hash, signature, keyPairs[0].getPublicKey());
+        verifier.add(HashUtils::sha256(Bytes{0x04}), signature, keyPairs[0].getPublicKey());
+        verifier.add(hash, signature, keyPairs[1].getPublicKey());
+        verifier.add(Bytes(31, 0x00), signature, keyPairs[0].getPublicKey());
+        verifier.add(hash, nullptr, keyPairs[0].getPublicKey());
+        verifier.add(hash, signature, keyPairs[0].getPublicKey());
+        
+        auto result = verifier.verify();
+        REQUIRE_FALSE(result.allValid());
+        REQUIRE(result.valid == std::vector<bool>{true, false, false, false, false, true});
+        REQUIRE(result.failed == std::vector<size_t>{1, 2, 3, 4});
+    }
+    
+    SECTION("Empty batch") {
+        SignatureBatchVerifier verifier;
+        auto result = verifier.verify();
+        REQUIRE(result.allValid());
+        REQUIRE(result.valid.empty());
+    }
+    
+    SECTION("Clear") {
+        SignatureBatchVerifier verifier(pool);
+        verifier.add(Bytes(32, 0x00), keyPairs[0].sign(Bytes{0x00}), keyPairs[0].getPublicKey());
+        verifier.clear();
+        REQUIRE(verifier.size() == 0);
+    }
+    
+    SECTION("Single verification agrees with ECPublicKey::verify") {
+        Bytes message = {0xde, 0xad, 0xbe, 0xef};
+        auto signature = keyPairs[2].sign(message);
+        REQUIRE(keyPairs[2].getPublicKey()->verify(message, signature));
+        REQUIRE(SignatureBatchVerifier::verifyHash(HashUtils::sha256(message), signature, keyPairs[2].getPublicKey()));
+        REQUIRE_FALSE(SignatureBatchVerifier::verifyHash(HashUtils::sha256(message), signature, keyPairs[1].getPublicKey()));
+    }
+}
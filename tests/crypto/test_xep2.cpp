@@ -117,4 +117,80 @@ TEST_CASE("XEP2 Tests", "[crypto]") {
         Bytes decryptedBytes = XEP2::decrypt(encrypted, password);
         REQUIRE(decryptedBytes == keyPair.getPrivateKey()->getBytes());
     }
+    
+    SECTION("Bulk encrypt and decrypt") {
+        const std::string password = "BulkPassword";
+        ScryptParams params = ScryptParams::getLight();
+        std::vector<Bytes> privateKeys;
+        for (int i = 0; i < 6; ++i) {
+            privateKeys.push_back(ECKeyPair::generate().getPrivateKey()->getBytes());
+        }
+        
+        // Progress arrives on worker threads, so it is only recorded there
+        size_t lastCompleted = 0;
+        bool inOrder = true;
+        XEP2BulkProgress last;
+        XEP2BulkOptions options;
+        options.threads = 3;
+        options.onProgress = [&](const XEP2BulkProgress& progress) {
+            inOrder = inOrder && progress.completed == lastCompleted + 1;
+            lastCompleted = progress.completed;
+            last = progress;
+        };
+        
+        auto encrypted = XEP2::encryptAll(privateKeys, password, params, options);
+        REQUIRE(encrypted.size() == privateKeys.size());
+        REQUIRE(inOrder);
+        REQUIRE(last.completed == privateKeys.size());
+        REQUIRE(last.total == privateKeys.size());
+        REQUIRE(last.failed == 0);
+        REQUIRE(last.concurrency == 3);
+        
+        std::vector<std::string> keys;
+        for (size_t i = 0; i < encrypted.size(); ++i) {
+            REQUIRE(encrypted[i].succeeded());
+            REQUIRE(encrypted[i].seconds >= 0);
+            REQUIRE(encrypted[i].xep2 == XEP2::encrypt(privateKeys[i], password, params));
+            keys.push_back(encrypted[i].xep2);
+        }
+        
+        // A bad key and a wrong-password key fail on their own
+        keys.push_back("not a xep2 key");
+        keys.push_back(XEP2::encrypt(privateKeys[0], "OtherPassword", params));
+        
+        lastCompleted = 0;
+        auto decrypted = XEP2::decryptAll(keys, password, params, options);
+        REQUIRE(decrypted.size() == keys.size());
+        REQUIRE(inOrder);
+        REQUIRE(last.completed == keys.size());
+        REQUIRE(last.failed == 2);
+        for (size_t i = 0; i < privateKeys.size(); ++i) {
+            REQUIRE(decrypted[i].succeeded());
+            REQUIRE(decrypted[i].privateKey == privateKeys[i]);
+        }
+        REQUIRE(!decrypted[privateKeys.size()].succeeded());
+        REQUIRE(decrypted[privateKeys.size()].privateKey.empty());
+        REQUIRE(!decrypted[privateKeys.size() + 1].succeeded());
+        
+        REQUIRE(XEP2::decryptAll({}, password, params, options).empty());
+    }
+    
+    SECTION("Bulk concurrency is bounded by threads, memory and batch size") {
+        ScryptParams params = ScryptParams::getDefault();
+        size_t memory = XEP2::scryptMemory(params);
+        REQUIRE(memory == 128 * 8 * (16384 + 2 + 8));
+        
+        XEP2BulkOptions options;
+        options.threads = 8;
+        options.memoryLimit = 3 * memory;
+        REQUIRE(XEP2::bulkConcurrency(100, params, options) == 3);
+        REQUIRE(XEP2::bulkConcurrency(2, params, options) == 2);
+        
+        options.memoryLimit = memory / 2;
+        REQUIRE(XEP2::bulkConcurrency(100, params, options) == 1);
+        
+        options.memoryLimit = 100 * memory;
+        REQUIRE(XEP2::bulkConcurrency(100, params, options) == 8);
+        REQUIRE(XEP2::bulkConcurrency(0, params, options) == 1);
+    }
 }
\ No newline at end of file
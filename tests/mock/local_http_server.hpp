@@ -0,0 +1,220 @@
+#pragma once
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace epicchaincpp {
+namespace test {
+
+/// In-process HTTP/1.1 server standing in for a node's RPC endpoint.
+/// Connections are kept alive between requests, so tests can observe how
+/// many TCP connections a client opens.
+class LocalHttpServer {
+public:
+    struct Request {
+        std::string method;
+        std::string path;
+        std::string body;
+    };
+    
+    struct Reply {
+        int status = 200;
+        std::string body;
+        
+        /// Send the body chunk-encoded in pieces of this size (0 sends a Content-Length)
+        size_t chunkSize = 0;
+        
+        /// Wait before answering
+        std::chrono::milliseconds delay{0};
+        
+        /// Close the connection instead of answering
+        bool drop = false;
+    };
+    
+    /// Called on the connection's thread, possibly concurrently
+    using Handler = std::function<Reply(const Request&)>;
+    
+    explicit LocalHttpServer(Handler handler)
+        : handler_(std::move(handler)), stopping_(false), connections_(0), requests_(0) {
+        listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        int reuse = 1;
+        ::setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        ::bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        ::listen(listenFd_, 64);
+        socklen_t length = sizeof(address);
+        ::getsockname(listenFd_, reinterpret_cast<sockaddr*>(&address), &length);
+        port_ = ntohs(address.sin_port);
+        acceptThread_ = std::thread([this]() { acceptLoop(); });
+    }
+    
+    ~LocalHttpServer() {
+        stopping_ = true;
+        acceptThread_.join();
+        std::vector<std::thread> threads;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            threads.swap(threads_);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        ::close(listenFd_);
+    }
+    
+    LocalHttpServer(const LocalHttpServer&) = delete;
+    LocalHttpServer& operator=(const LocalHttpServer&) = delete;
+    
+    std::string url() const { return "http://127.0.0.1:" + std::to_string(port_); }
+    
+    /// TCP connections accepted so far
+    int connections() const { return connections_; }
+    
+    /// Requests answered or dropped so far
+    int requests() const { return requests_; }
+    
+private:
+    Handler handler_;
+    std::atomic<bool> stopping_;
+    std::atomic<int> connections_;
+    std::atomic<int> requests_;
+    int listenFd_;
+    uint16_t port_;
+    std::thread acceptThread_;
+    std::mutex mutex_;
+    std::vector<std::thread> threads_;
+    
+    void acceptLoop() {
+        while (!stopping_) {
+            pollfd descriptor{listenFd_, POLLIN, 0};
+            if (::poll(&descriptor, 1, 20) <= 0) {
+                continue;
+            }
+            int fd = ::accept(listenFd_, nullptr, nullptr);
+            if (fd >= 0) {
+                connections_++;
+                std::lock_guard<std::mutex> lock(mutex_);
+                threads_.emplace_back([this, fd]() { serve(fd); });
+            }
+        }
+    }
+    
+    /// Read more data, giving up when the server stops or the peer closes
+    bool receive(int fd, std::string& buffer) {
+        while (!stopping_) {
+            pollfd descriptor{fd, POLLIN, 0};
+            int ready = ::poll(&descriptor, 1, 20);
+            if (ready == 0) {
+                continue;
+            }
+            if (ready < 0) {
+                return false;
+            }
+            char chunk[8192];
+            ssize_t received = ::recv(fd, chunk, sizeof(chunk), 0);
+            if (received <= 0) {
+                return false;
+            }
+            buffer.append(chunk, static_cast<size_t>(received));
+            return true;
+        }
+        return false;
+    }
+    
+    static void sendAll(int fd, const std::string& data) {
+        size_t sent = 0;
+        while (sent < data.size()) {
+            ssize_t result = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (result <= 0) {
+                return;
+            }
+            sent += static_cast<size_t>(result);
+        }
+    }
+    
+    void serve(int fd) {
+        std::string buffer;
+        while (!stopping_) {
+            size_t headerEnd;
+            while ((headerEnd = buffer.find("\r\n\r\n")) == std::string::npos) {
+                if (!receive(fd, buffer)) {
+                    ::close(fd);
+                    return;
+                }
+            }
+            std::string head = buffer.substr(0, headerEnd);
+            buffer.erase(0, headerEnd + 4);
+            std::string lower = head;
+            std::transform(lower.begin(), lower.end(), lower.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            
+            Request request;
+            size_t methodEnd = head.find(' ');
+            request.method = head.substr(0, methodEnd);
+            request.path = head.substr(methodEnd + 1, head.find(' ', methodEnd + 1) - methodEnd - 1);
+            
+            if (lower.find("expect: 100-continue") != std::string::npos) {
+                sendAll(fd, "HTTP/1.1 100 Continue\r\n\r\n");
+            }
+            size_t lengthStart = lower.find("content-length: ");
+            size_t contentLength = lengthStart == std::string::npos ? 0 : std::stoul(head.substr(lengthStart + 16));
+            while (buffer.size() < contentLength) {
+                if (!receive(fd, buffer)) {
+                    ::close(fd);
+                    return;
+                }
+            }
+            request.body = buffer.substr(0, contentLength);
+            buffer.erase(0, contentLength);
+            
+            Reply reply = handler_(request);
+            requests_++;
+            if (reply.delay.count() > 0) {
+                std::this_thread::sleep_for(reply.delay);
+            }
+            if (reply.drop) {
+                ::close(fd);
+                return;
+            }
+            respond(fd, reply);
+        }
+        ::close(fd);
+    }
+    
+    static void respond(int fd, const Reply& reply) {
+        std::string head = "HTTP/1.1 " + std::to_string(reply.status) +
+                           (reply.status == 200 ? " OK" : " Error") +
+                           "\r\nContent-Type: application/json\r\nConnection: keep-alive\r\n";
+        if (reply.chunkSize == 0) {
+            sendAll(fd, head + "Content-Length: " + std::to_string(reply.body.size()) + "\r\n\r\n" + reply.body);
+            return;
+        }
+        
+        sendAll(fd, head + "Transfer-Encoding: chunked\r\n\r\n");
+        for (size_t offset = 0; offset < reply.body.size(); offset += reply.chunkSize) {
+            std::string piece = reply.body.substr(offset, reply.chunkSize);
+            char size[20];
+            std::snprintf(size, sizeof(size), "%zx\r\n", piece.size());
+            sendAll(fd, size + piece + "\r\n");
+        }
+        sendAll(fd, "0\r\n\r\n");
+    }
+};
+    
+} // namespace test
+} // namespace epicchaincpp
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <chrono>
+#include <thread>
+
+namespace epicchaincpp {
+namespace test {
+
+/// Poll a condition until it holds, for background threads in tests
+/// @param condition Checked every few milliseconds
+/// @param timeout How long to wait before giving up
+/// @return Whether the condition held in time
+template <typename Condition>
+bool eventually(Condition condition, std::chrono::milliseconds timeout = std::chrono::seconds(5)) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return true;
+}
+
+} // namespace test
+} // namespace epicchaincpp
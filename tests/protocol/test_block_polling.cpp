@@ -0,0 +1,160 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../mock/local_http_server.hpp"
+#include "../mock/test_utils.hpp"
+#include "epicchaincpp/protocol/core/polling/block_polling.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace epicchaincpp;
+using json = nlohmann::json;
+
+namespace {
+
+/// Stand-in node whose chain height the test controls
+class StandInChain {
+public:
+    std::atomic<uint32_t> blockCount{1};
+    
+    /// getblockcount calls still to fail
+    std::atomic<int> failures{0};
+    
+    test::LocalHttpServer::Reply answer(const test::LocalHttpServer::Request& request) {
+        json body = json::parse(request.body);
+        json response = {{"jsonrpc", "2.0"}, {"id", body["id"]}};
+        std::string method = body["method"];
+        if (method == "getblockcount" && failures > 0) {
+            failures--;
+            response["error"] = {{"code", -32603}, {"message", "Internal error"}};
+        } else if (method == "getblockcount") {
+            response["result"] = blockCount.load();
+        } else {
+            response["result"] = {{"index", body["params"][0]}, {"tx", json::array()}};
+        }
+        test::LocalHttpServer::Reply reply;
+        reply.body = response.dump();
+        return reply;
+    }
+};
+
+} // namespace
+
+TEST_CASE("BlockPolling", "[protocol]") {
+    StandInChain chain;
+    test::LocalHttpServer server([&chain](const test::LocalHttpServer::Request& request) {
+        return chain.answer(request);
+    });
+    auto client = std::make_shared<EpicChainRpcClient>(server.url());
+    
+    SECTION("Poll interval keeps its bounds ordered") {
+        BlockPolling polling(client);
+        REQUIRE_THROWS_AS(polling.setPollInterval(std::chrono::milliseconds(0)), IllegalArgumentException);
+        
+        // Below the default minimum of 100ms: the minimum follows it down
+        polling.setPollInterval(std::chrono::milliseconds(20));
+        chain.blockCount = 3;
+        std::atomic<uint32_t> last{0};
+        polling.subscribe([&last](uint32_t index) { last = index; });
+        polling.start(0);
+        polling.setPollInterval(std::chrono::milliseconds(30));
+        REQUIRE(test::eventually([&] { return last == 2; }));
+        polling.stop();
+    }
+    
+    SECTION("A full queue stops fetching but keeps the chain height current") {
+        BlockPollingConfig config;
+        config.queueCapacity = 2;
+        config.minPollInterval = std::chrono::milliseconds(10);
+        config.maxPollInterval = std::chrono::milliseconds(20);
+        config.fetchBlocks = true;
+        BlockPolling polling(client, config);
+        
+        std::mutex mutex;
+        std::condition_variable released;
+        bool open = false;
+        std::vector<uint32_t> delivered;
+        polling.subscribeBlocks([&](const BlockEvent& event) {
+            std::unique_lock<std::mutex> lock(mutex);
+            released.wait(lock, [&] { return open; });
+            REQUIRE(event.block["index"] == event.index);
+            delivered.push_back(event.index);
+        });
+        
+        chain.blockCount = 10;
+        polling.start(0);
+        // One block held by the subscriber, two queued
+        REQUIRE(test::eventually([&] { return polling.getMetrics().queueDepth == 2; }));
+        
+        chain.blockCount = 30;
+        REQUIRE(test::eventually([&] { return polling.getMetrics().chainHeight == 29; }));
+        auto metrics = polling.getMetrics();
+        REQUIRE(metrics.queueDepth == 2);
+        REQUIRE(metrics.delivered == 0);
+        REQUIRE(metrics.lagBlocks == 29);
+        
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            open = true;
+        }
+        released.notify_all();
+        REQUIRE(test::eventually([&] { return polling.getLastBlockIndex() == 29; }));
+        polling.stop();
+        
+        REQUIRE(delivered.size() == 30);
+        for (uint32_t i = 0; i < delivered.size(); ++i) {
+            REQUIRE(delivered[i] == i);
+        }
+        REQUIRE(polling.getMetrics().lagBlocks == 0);
+    }
+    
+    SECTION("The block time estimate follows the chain") {
+        BlockPollingConfig config;
+        config.expectedBlockTime = std::chrono::milliseconds(1000);
+        config.minPollInterval = std::chrono::milliseconds(5);
+        config.maxPollInterval = std::chrono::milliseconds(50);
+        BlockPolling polling(client, config);
+        
+        std::atomic<bool> producing{true};
+        std::thread producer([&]() {
+            while (producing) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                chain.blockCount++;
+            }
+        });
+        polling.start();
+        bool converged = test::eventually([&] {
+            return polling.getMetrics().estimatedBlockTime < std::chrono::milliseconds(300);
+        });
+        producing = false;
+        producer.join();
+        polling.stop();
+        
+        REQUIRE(converged);
+        REQUIRE(polling.getMetrics().estimatedBlockTime >= std::chrono::milliseconds(50));
+    }
+    
+    SECTION("Failed polls are counted and retried") {
+        BlockPollingConfig config;
+        config.minPollInterval = std::chrono::milliseconds(5);
+        config.maxPollInterval = std::chrono::milliseconds(10);
+        BlockPolling polling(client, config);
+        
+        std::atomic<uint32_t> last{0};
+        polling.subscribe([&last](uint32_t index) { last = index; });
+        chain.blockCount = 5;
+        chain.failures = 3;
+        polling.start(0);
+        
+        REQUIRE(test::eventually([&] { return last == 4; }));
+        polling.stop();
+        auto metrics = polling.getMetrics();
+        REQUIRE(metrics.errors == 3);
+        REQUIRE(metrics.delivered == 5);
+        REQUIRE(metrics.polls >= 1);
+    }
+}
@@ -0,0 +1,136 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../mock/local_http_server.hpp"
+#include "epicchaincpp/protocol/core/polling/block_range_fetcher.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <set>
+#include <vector>
+
+using namespace epicchaincpp;
+using json = nlohmann::json;
+
+namespace {
+
+/// Verbose block as a node returns it from getblock
+json blockAt(uint32_t index) {
+    char hash[67];
+    std::snprintf(hash, sizeof(hash), "0x%064x", index + 1);
+    char previous[67];
+    std::snprintf(previous, sizeof(previous), "0x%064x", index);
+    return {
+        {"hash", hash},
+        {"size", 700 + index},
+        {"version", 0},
+        {"previousblockhash", previous},
+        {"merkleroot", previous},
+        {"time", 1609459200000 + index * 15000},
+        {"nonce", "1234567890ABCDEF"},
+        {"index", index},
+        {"primary", 0},
+        {"nextconsensus", "NZNos2WqTbu5oCgyfss9kUJgBXJqhuYAaj"},
+        {"witnesses", json::array()},
+        {"tx", json::array()},
+        {"confirmations", 1}
+    };
+}
+
+/// Answer getblock after a delay that varies by height, so responses arrive out of order
+test::LocalHttpServer::Reply answerBlock(const json& body, uint32_t index) {
+    test::LocalHttpServer::Reply reply;
+    reply.delay = std::chrono::milliseconds((index * 37) % 23);
+    reply.body = json({{"jsonrpc", "2.0"}, {"id", body["id"]}, {"result", blockAt(index)}}).dump();
+    return reply;
+}
+
+} // namespace
+
+TEST_CASE("BlockRangeFetcher", "[protocol]") {
+    
+    SECTION("Blocks arriving out of order are delivered in height order") {
+        test::LocalHttpServer server([](const test::LocalHttpServer::Request& request) {
+            json body = json::parse(request.body);
+            return answerBlock(body, body["params"][0].get<uint32_t>());
+        });
+        auto client = std::make_shared<EpicChainRpcClient>(server.url());
+        BlockRangeFetcherConfig config;
+        config.workers = 6;
+        config.reorderBufferSize = 8;
+        BlockRangeFetcher fetcher(client, config);
+        
+        std::vector<uint32_t> delivered;
+        fetcher.fetch(100, 160, [&delivered](uint32_t index, const SharedPtr<EpicChainGetBlockResponse>& block) {
+            REQUIRE(block);
+            delivered.push_back(index);
+        });
+        
+        REQUIRE(delivered.size() == 60);
+        for (size_t i = 0; i < delivered.size(); ++i) {
+            REQUIRE(delivered[i] == 100 + i);
+        }
+        REQUIRE(server.requests() == 60);
+        auto metrics = fetcher.getMetrics();
+        REQUIRE(metrics.blocks == 60);
+        REQUIRE(metrics.retries == 0);
+    }
+    
+    SECTION("Failed heights are retried without breaking the order") {
+        std::mutex mutex;
+        std::set<uint32_t> failedOnce;
+        test::LocalHttpServer server([&](const test::LocalHttpServer::Request& request) {
+            json body = json::parse(request.body);
+            uint32_t index = body["params"][0].get<uint32_t>();
+            std::lock_guard<std::mutex> lock(mutex);
+            if (index % 5 == 0 && failedOnce.insert(index).second) {
+                test::LocalHttpServer::Reply reply;
+                reply.body = json({{"jsonrpc", "2.0"}, {"id", body["id"]},
+                                   {"error", {{"code", -100}, {"message", "Unknown block"}}}}).dump();
+                return reply;
+            }
+            return answerBlock(body, index);
+        });
+        auto client = std::make_shared<EpicChainRpcClient>(server.url());
+        BlockRangeFetcherConfig config;
+        config.workers = 4;
+        config.initialBackoff = std::chrono::milliseconds(1);
+        BlockRangeFetcher fetcher(client, config);
+        
+        std::vector<uint32_t> delivered;
+        fetcher.fetch(0, 20, [&delivered](uint32_t index, const SharedPtr<EpicChainGetBlockResponse>&) {
+            delivered.push_back(index);
+        });
+        
+        REQUIRE(delivered.size() == 20);
+        for (uint32_t i = 0; i < 20; ++i) {
+            REQUIRE(delivered[i] == i);
+        }
+        REQUIRE(fetcher.getMetrics().retries == 4);
+    }
+    
+    SECTION("A height that runs out of attempts fails the fetch") {
+        test::LocalHttpServer server([](const test::LocalHttpServer::Request& request) {
+            json body = json::parse(request.body);
+            uint32_t index = body["params"][0].get<uint32_t>();
+            if (index == 3) {
+                test::LocalHttpServer::Reply reply;
+                reply.drop = true;
+                return reply;
+            }
+            return answerBlock(body, index);
+        });
+        auto client = std::make_shared<EpicChainRpcClient>(server.url());
+        BlockRangeFetcherConfig config;
+        config.workers = 2;
+        config.maxAttempts = 2;
+        config.initialBackoff = std::chrono::milliseconds(1);
+        BlockRangeFetcher fetcher(client, config);
+        
+        std::vector<uint32_t> delivered;
+        REQUIRE_THROWS(fetcher.fetch(0, 10, [&delivered](uint32_t index, const SharedPtr<EpicChainGetBlockResponse>&) {
+            delivered.push_back(index);
+        }));
+        REQUIRE(delivered == std::vector<uint32_t>{0, 1, 2});
+    }
+}
@@ -0,0 +1,196 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../mock/local_http_server.hpp"
+#include "epicchaincpp/protocol/http_service.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace epicchaincpp;
+using json = nlohmann::json;
+
+namespace {
+
+/// Answer every JSON-RPC request with its own method name
+test::LocalHttpServer::Reply echoMethod(const test::LocalHttpServer::Request& request) {
+    json body = json::parse(request.body);
+    test::LocalHttpServer::Reply reply;
+    reply.body = json({{"jsonrpc", "2.0"}, {"id", body["id"]}, {"result", body["method"]}}).dump();
+    return reply;
+}
+
+json rpcRequest(int id, const std::string& method) {
+    return {{"jsonrpc", "2.0"}, {"id", id}, {"method", method}, {"params", json::array()}};
+}
+
+} // namespace
+
+TEST_CASE("HttpService connection pool", "[protocol]") {
+    
+    SECTION("Sequential requests reuse one handle and connection") {
+        test::LocalHttpServer server(echoMethod);
+        HttpService http(server.url());
+        for (int i = 0; i < 5; ++i) {
+            REQUIRE(http.post(rpcRequest(i, "getblockcount"))["result"] == "getblockcount");
+        }
+        
+        REQUIRE(server.connections() == 1);
+        auto stats = http.getPoolStats();
+        REQUIRE(stats.requests == 5);
+        REQUIRE(stats.handleHits == 4);
+        REQUIRE(stats.newConnections == 1);
+        REQUIRE(stats.reuseRatio() == 0.8);
+    }
+    
+    SECTION("Concurrent requests stay within the per-host limit") {
+        test::LocalHttpServer server([](const test::LocalHttpServer::Request& request) {
+            auto reply = echoMethod(request);
+            reply.delay = std::chrono::milliseconds(30);
+            return reply;
+        });
+        HttpService http(server.url());
+        HttpPoolConfig config;
+        config.maxConnectionsPerHost = 2;
+        http.setPoolConfig(config);
+        
+        std::atomic<int> succeeded{0};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 6; ++i) {
+            threads.emplace_back([&http, &succeeded, i]() {
+                if (http.post(rpcRequest(i, "getversion"))["id"] == i) {
+                    succeeded++;
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        
+        REQUIRE(succeeded == 6);
+        REQUIRE(server.connections() <= 2);
+        REQUIRE(http.getPoolStats().requests == 6);
+    }
+    
+    SECTION("A failed request returns its handle to the pool") {
+        std::atomic<bool> drop{true};
+        test::LocalHttpServer server([&drop](const test::LocalHttpServer::Request& request) {
+            auto reply = echoMethod(request);
+            reply.drop = drop.exchange(false);
+            return reply;
+        });
+        HttpService http(server.url());
+        HttpPoolConfig config;
+        config.maxConnectionsPerHost = 1;
+        http.setPoolConfig(config);
+        
+        REQUIRE_THROWS_AS(http.post(rpcRequest(1, "getblockcount")), RpcException);
+        // With one connection allowed, a leaked lease would block here forever
+        REQUIRE(http.post(rpcRequest(2, "getblockcount"))["id"] == 2);
+        REQUIRE(http.getPoolStats().handleHits == 1);
+    }
+}
+
+TEST_CASE("HttpService async requests", "[protocol]") {
+    
+    SECTION("Futures complete from the event loop") {
+        test::LocalHttpServer server([](const test::LocalHttpServer::Request& request) {
+            auto reply = echoMethod(request);
+            reply.delay = std::chrono::milliseconds(20);
+            return reply;
+        });
+        HttpService http(server.url());
+        
+        std::vector<std::future<json>> futures;
+        for (int i = 0; i < 8; ++i) {
+            futures.push_back(http.postAsync(rpcRequest(i, "getblock")));
+        }
+        for (int i = 0; i < 8; ++i) {
+            REQUIRE(futures[i].get()["id"] == i);
+        }
+        REQUIRE(http.getPendingAsyncRequests() == 0);
+        REQUIRE(server.requests() == 8);
+    }
+    
+    SECTION("Callbacks receive the response or the error, never both") {
+        test::LocalHttpServer server([](const test::LocalHttpServer::Request& request) {
+            auto reply = echoMethod(request);
+            if (json::parse(request.body)["method"] == "fail") {
+                reply.status = 500;
+                reply.body = "Internal error";
+            } else if (json::parse(request.body)["method"] == "drop") {
+                reply.drop = true;
+            }
+            return reply;
+        });
+        HttpService http(server.url());
+        
+        std::mutex mutex;
+        std::condition_variable done;
+        std::vector<std::pair<json, std::exception_ptr>> results(3);
+        int completed = 0;
+        const std::vector<std::string> methods = {"getversion", "fail", "drop"};
+        for (size_t i = 0; i < methods.size(); ++i) {
+            http.postAsync(rpcRequest(static_cast<int>(i), methods[i]),
+                           [&, i](const json& response, std::exception_ptr error) {
+                std::lock_guard<std::mutex> lock(mutex);
+                results[i] = {response, error};
+                completed++;
+                done.notify_all();
+            });
+        }
+        
+        std::unique_lock<std::mutex> lock(mutex);
+        REQUIRE(done.wait_for(lock, std::chrono::seconds(10), [&] { return completed == 3; }));
+        REQUIRE(results[0].first["result"] == "getversion");
+        REQUIRE_FALSE(results[0].second);
+        for (size_t i = 1; i < results.size(); ++i) {
+            REQUIRE(results[i].first.is_null());
+            REQUIRE_THROWS_AS(std::rethrow_exception(results[i].second), RpcException);
+        }
+        REQUIRE(http.getPendingAsyncRequests() == 0);
+    }
+    
+    SECTION("Pool config changes reach the running event loop") {
+        test::LocalHttpServer server([](const test::LocalHttpServer::Request& request) {
+            auto reply = echoMethod(request);
+            reply.delay = std::chrono::milliseconds(30);
+            return reply;
+        });
+        HttpService http(server.url());
+        REQUIRE(http.postAsync(rpcRequest(0, "getversion")).get()["id"] == 0);
+        
+        HttpPoolConfig config;
+        config.maxConnectionsPerHost = 1;
+        http.setPoolConfig(config);
+        std::vector<std::future<json>> futures;
+        for (int i = 1; i <= 6; ++i) {
+            futures.push_back(http.postAsync(rpcRequest(i, "getblock")));
+        }
+        for (int i = 1; i <= 6; ++i) {
+            REQUIRE(futures[i - 1].get()["id"] == i);
+        }
+        // Without the new limit each of the six requests would open its own connection
+        REQUIRE(server.connections() <= 2);
+    }
+    
+    SECTION("A refused connection fails the future") {
+        HttpService http("http://127.0.0.1:1");
+        auto future = http.postAsync(rpcRequest(1, "getblockcount"));
+        REQUIRE(future.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+        REQUIRE_THROWS_AS(future.get(), RpcException);
+        REQUIRE(http.getPendingAsyncRequests() == 0);
+    }
+    
+    SECTION("A throwing callback does not stall later requests") {
+        test::LocalHttpServer server(echoMethod);
+        HttpService http(server.url());
+        
+        http.postAsync(rpcRequest(1, "getversion"), [](const json&, std::exception_ptr) {
+            throw std::runtime_error("callback failure");
+        });
+        REQUIRE(http.postAsync(rpcRequest(2, "getversion")).get()["id"] == 2);
+    }
+}
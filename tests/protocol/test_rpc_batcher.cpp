@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../mock/local_http_server.hpp"
+#include "epicchaincpp/protocol/rpc_batcher.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <future>
+#include <mutex>
+#include <vector>
+
+using namespace epicchaincpp;
+using json = nlohmann::json;
+
+namespace {
+
+/// Answer single requests and batches, echoing each request's method as its result
+test::LocalHttpServer::Reply echoBatch(const test::LocalHttpServer::Request& request) {
+    auto answer = [](const json& call) {
+        return json({{"jsonrpc", "2.0"}, {"id", call["id"]}, {"result", call["method"]}});
+    };
+    json body = json::parse(request.body);
+    json response;
+    if (body.is_array()) {
+        response = json::array();
+        for (const auto& call : body) {
+            response.push_back(answer(call));
+        }
+    } else {
+        response = answer(body);
+    }
+    test::LocalHttpServer::Reply reply;
+    reply.body = response.dump();
+    return reply;
+}
+
+json rpcRequest(int id, const std::string& method) {
+    return {{"jsonrpc", "2.0"}, {"id", id}, {"method", method}, {"params", json::array()}};
+}
+
+} // namespace
+
+TEST_CASE("RpcBatcher", "[protocol]") {
+    std::mutex mutex;
+    std::vector<size_t> batchSizes;
+    test::LocalHttpServer server([&](const test::LocalHttpServer::Request& request) {
+        json body = json::parse(request.body);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            batchSizes.push_back(body.is_array() ? body.size() : 0);
+        }
+        return echoBatch(request);
+    });
+    auto http = std::make_shared<HttpService>(server.url());
+    
+    SECTION("Batches are split at the maximum size") {
+        RpcBatchConfig config;
+        config.maxBatchSize = 3;
+        config.maxDelay = std::chrono::milliseconds(50);
+        RpcBatcher batcher(http, config);
+        
+        std::vector<std::future<json>> futures;
+        for (int i = 0; i < 7; ++i) {
+            futures.push_back(batcher.submit(rpcRequest(i, "method" + std::to_string(i))));
+        }
+        for (int i = 0; i < 7; ++i) {
+            json response = futures[i].get();
+            REQUIRE(response["id"] == i);
+            REQUIRE(response["result"] == "method" + std::to_string(i));
+        }
+        
+        std::lock_guard<std::mutex> lock(mutex);
+        REQUIRE(batchSizes == std::vector<size_t>{3, 3, 1});
+        REQUIRE(batcher.getStats().batches == 3);
+        REQUIRE(batcher.getStats().requests == 7);
+    }
+    
+    SECTION("A call from inside a callback is sent directly") {
+        RpcBatcher batcher(http);
+        
+        std::promise<json> nested;
+        auto nestedResult = nested.get_future();
+        batcher.submit(rpcRequest(1, "getblockcount"), [&](const json&, std::exception_ptr) {
+            try {
+                nested.set_value(batcher.call(rpcRequest(2, "getblock")));
+            } catch (...) {
+                nested.set_exception(std::current_exception());
+            }
+        });
+        
+        REQUIRE(nestedResult.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+        REQUIRE(nestedResult.get()["result"] == "getblock");
+        REQUIRE_FALSE(http->isEventLoopThread());
+        
+        std::lock_guard<std::mutex> lock(mutex);
+        REQUIRE(batchSizes == std::vector<size_t>{1, 0});
+    }
+    
+    SECTION("A throwing callback does not stop the rest of the batch") {
+        RpcBatchConfig config;
+        config.maxDelay = std::chrono::milliseconds(50);
+        RpcBatcher batcher(http, config);
+        
+        batcher.submit(rpcRequest(1, "getversion"), [](const json&, std::exception_ptr) {
+            throw std::runtime_error("callback failure");
+        });
+        auto second = batcher.submit(rpcRequest(2, "getblockcount"));
+        
+        REQUIRE(second.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+        REQUIRE(second.get()["result"] == "getblockcount");
+        
+        std::lock_guard<std::mutex> lock(mutex);
+        REQUIRE(batchSizes == std::vector<size_t>{2});
+    }
+}
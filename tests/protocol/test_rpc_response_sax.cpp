@@ -0,0 +1,149 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../mock/local_http_server.hpp"
+#include "epicchaincpp/protocol/rpc_response_sax.hpp"
+#include "epicchaincpp/protocol/http_service.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <string>
+#include <vector>
+
+using namespace epicchaincpp;
+using json = nlohmann::json;
+
+namespace {
+
+json parseWith(RpcResponseSax& handler, const json& response) {
+    std::string text = response.dump();
+    json::sax_parse(text, &handler);
+    return handler.takeResult();
+}
+
+} // namespace
+
+TEST_CASE("RpcResponseSax Tests", "[protocol]") {
+    json block = {
+        {"hash", "0x01"},
+        {"index", 42},
+        {"tx", {{{"hash", "0xa1"}, {"signers", {{{"account", "0x02"}}}}}, {{"hash", "0xa2"}, {"signers", json::array()}}}},
+        {"witnesses", {{{"invocation", "AA=="}}}}
+    };
+    json response = {{"jsonrpc", "2.0"}, {"id", 1}, {"result", block}};
+    
+    SECTION("Without streamed paths the result is complete") {
+        RpcResponseSax handler;
+        REQUIRE(parseWith(handler, response) == block);
+        REQUIRE(handler.getStreamedElements() == 0);
+    }
+    
+    SECTION("Streamed array elements go to the callback") {
+        std::vector<json> transactions;
+        std::vector<std::string> paths;
+        RpcResponseSax handler({"tx"}, [&](const std::string& path, json&& tx) {
+            paths.push_back(path);
+            transactions.push_back(std::move(tx));
+        });
+        json result = parseWith(handler, response);
+        
+        REQUIRE(transactions.size() == 2);
+        REQUIRE(transactions[0] == block["tx"][0]);
+        REQUIRE(transactions[1] == block["tx"][1]);
+        REQUIRE(paths == std::vector<std::string>{"tx", "tx"});
+        REQUIRE(handler.getStreamedElements() == 2);
+        
+        // Everything else is kept, the streamed array is left empty
+        REQUIRE(result["tx"] == json::array());
+        REQUIRE(result["index"] == 42);
+        REQUIRE(result["witnesses"] == block["witnesses"]);
+    }
+    
+    SECTION("Paths skip array levels") {
+        json log = {
+            {"txid", "0x03"},
+            {"executions", {
+                {{"trigger", "Application"}, {"notifications", {{{"eventname", "Transfer"}}, {{"eventname", "Mint"}}}}},
+                {{"trigger", "PostPersist"}, {"notifications", {{{"eventname", "Burn"}}}}}
+            }}
+        };
+        std::vector<std::string> names;
+        RpcResponseSax handler({"executions/notifications"}, [&](const std::string&, json&& notification) {
+            names.push_back(notification["eventname"]);
+        });
+        json result = parseWith(handler, {{"jsonrpc", "2.0"}, {"id", 1}, {"result", log}});
+        
+        REQUIRE(names == std::vector<std::string>{"Transfer", "Mint", "Burn"});
+        REQUIRE(result["executions"].size() == 2);
+        REQUIRE(result["executions"][1]["trigger"] == "PostPersist");
+        REQUIRE(result["executions"][0]["notifications"] == json::array());
+    }
+    
+    SECTION("Scalar elements are streamed too") {
+        std::vector<json> values;
+        RpcResponseSax handler({"values"}, [&](const std::string&, json&& value) { values.push_back(value); });
+        parseWith(handler, {{"jsonrpc", "2.0"}, {"id", 1}, {"result", {{"values", {1, "two", nullptr, {3}}}}}});
+        REQUIRE(values == std::vector<json>{1, "two", nullptr, json::array({3})});
+    }
+    
+    SECTION("Errors and malformed input") {
+        RpcResponseSax handler;
+        parseWith(handler, {{"jsonrpc", "2.0"}, {"id", 1}, {"result", 1}});
+        
+        RpcResponseSax failed;
+        std::string text = json({{"jsonrpc", "2.0"}, {"id", 1}, {"error", {{"code", -100}, {"message", "Unknown block"}}}}).dump();
+        json::sax_parse(text, &failed);
+        REQUIRE_THROWS_AS(failed.takeResult(), RpcException);
+        
+        RpcResponseSax truncated;
+        REQUIRE_THROWS_AS(json::sax_parse(std::string("{\"result\": [1, 2"), &truncated), RpcException);
+    }
+}
+
+TEST_CASE("Streaming post through HttpService", "[protocol]") {
+    json block = {{"hash", "0x01"}, {"index", 7}, {"tx", json::array()}};
+    for (int i = 0; i < 500; ++i) {
+        block["tx"].push_back({{"hash", "0x" + std::to_string(i)}, {"script", std::string(64, 'A')}});
+    }
+    
+    SECTION("Elements arrive from a chunked response") {
+        json request;
+        test::LocalHttpServer server([&](const test::LocalHttpServer::Request& httpRequest) {
+            request = json::parse(httpRequest.body);
+            test::LocalHttpServer::Reply reply;
+            reply.body = json({{"jsonrpc", "2.0"}, {"id", request["id"]}, {"result", block}}).dump();
+            reply.chunkSize = 1000;
+            return reply;
+        });
+        
+        HttpService http(server.url());
+        std::vector<json> transactions;
+        RpcResponseSax handler({"tx"}, [&](const std::string&, json&& tx) { transactions.push_back(std::move(tx)); });
+        http.post({{"jsonrpc", "2.0"}, {"id", 9}, {"method", "getblock"}, {"params", {7, true}}}, handler);
+        
+        REQUIRE(request["method"] == "getblock");
+        REQUIRE(transactions.size() == 500);
+        REQUIRE(transactions[499]["hash"] == "0x499");
+        json result = handler.takeResult();
+        REQUIRE(result["index"] == 7);
+        REQUIRE(result["tx"] == json::array());
+        REQUIRE(http.getPoolStats().requests == 1);
+    }
+    
+    SECTION("Node errors and truncated bodies") {
+        test::LocalHttpServer server([](const test::LocalHttpServer::Request& httpRequest) {
+            test::LocalHttpServer::Reply reply;
+            if (json::parse(httpRequest.body)["method"] == "getblock") {
+                reply.body = R"({"jsonrpc":"2.0","id":1,"error":{"code":-100,"message":"Unknown block"}})";
+            } else {
+                reply.body = R"({"jsonrpc":"2.0","id":1,"result":{"tx":[1,2)";
+            }
+            return reply;
+        });
+        
+        HttpService http(server.url());
+        RpcResponseSax failed;
+        http.post({{"jsonrpc", "2.0"}, {"id", 1}, {"method", "getblock"}, {"params", {99}}}, failed);
+        REQUIRE_THROWS_AS(failed.takeResult(), RpcException);
+        
+        RpcResponseSax truncated;
+        REQUIRE_THROWS_AS(http.post({{"jsonrpc", "2.0"}, {"id", 1}, {"method", "getrawmempool"}}, truncated),
+                          RpcException);
+    }
+}
@@ -0,0 +1,325 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../mock/test_utils.hpp"
+#include "epicchaincpp/protocol/subscription_client.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
+#include "epicchaincpp/utils/base64.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <openssl/sha.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace epicchaincpp;
+using json = nlohmann::json;
+
+namespace {
+
+/// Server side of one stand-in connection
+class Peer {
+public:
+    explicit Peer(int fd) : fd_(fd) {}
+    
+    /// Read one client frame, unmasking it
+    bool readMessage(std::string& message, int timeoutMs = 5000) {
+        for (;;) {
+            const auto* bytes = reinterpret_cast<const uint8_t*>(buffer_.data());
+            size_t length = buffer_.size() >= 2 ? bytes[1] & 0x7F : 0;
+            size_t header = length == 126 ? 4 : 2;
+            if (length == 126 && buffer_.size() >= 4) {
+                length = (bytes[2] << 8) | bytes[3];
+            }
+            if (buffer_.size() >= 2 && buffer_.size() >= header + 4 + length) {
+                message.assign(buffer_, header + 4, length);
+                for (size_t i = 0; i < length; ++i) {
+                    message[i] = static_cast<char>(message[i] ^ bytes[header + (i & 3)]);
+                }
+                uint8_t opcode = bytes[0] & 0x0F;
+                buffer_.erase(0, header + 4 + length);
+                if (opcode == 0x1) {
+                    return true;
+                }
+                continue;
+            }
+            
+            pollfd descriptor{fd_, POLLIN, 0};
+            if (::poll(&descriptor, 1, timeoutMs) <= 0) {
+                return false;
+            }
+            char chunk[4096];
+            ssize_t received = ::recv(fd_, chunk, sizeof(chunk), 0);
+            if (received <= 0) {
+                return false;
+            }
+            buffer_.append(chunk, static_cast<size_t>(received));
+        }
+    }
+    
+    /// Send an unmasked text frame
+    void send(const json& message) {
+        std::string text = message.dump();
+        std::string frame(1, static_cast<char>(0x81));
+        if (text.size() < 126) {
+            frame.push_back(static_cast<char>(text.size()));
+        } else {
+            frame.push_back(static_cast<char>(126));
+            frame.push_back(static_cast<char>(text.size() >> 8));
+            frame.push_back(static_cast<char>(text.size()));
+        }
+        frame += text;
+        ::send(fd_, frame.data(), frame.size(), MSG_NOSIGNAL);
+    }
+    
+    /// Answer subscribe requests until a number of them were received
+    void confirmSubscriptions(size_t count, std::vector<json>* requests = nullptr) {
+        std::string text;
+        while (count > 0 && readMessage(text)) {
+            json request = json::parse(text);
+            if (requests) {
+                requests->push_back(request);
+            }
+            send({{"jsonrpc", "2.0"}, {"id", request["id"]}, {"result", std::to_string(request["id"].get<int>())}});
+            count--;
+        }
+    }
+    
+    void sendEvent(const std::string& method, const json& payload) {
+        send({{"jsonrpc", "2.0"}, {"method", method}, {"params", {payload}}});
+    }
+    
+    std::string buffer_;
+
+private:
+    int fd_;
+};
+
+/// Minimal node: JSON-RPC over HTTP and the WebSocket endpoint on one port
+class StandInNode {
+public:
+    using RpcHandler = std::function<json(const std::string&, const json&)>;
+    using SocketHandler = std::function<void(Peer&, int)>;
+    
+    StandInNode(RpcHandler rpc, SocketHandler socket)
+        : rpc_(std::move(rpc)), socket_(std::move(socket)), stopping_(false), sockets_(0) {
+        listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        int reuse = 1;
+        ::setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        ::bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        ::listen(listenFd_, 16);
+        socklen_t length = sizeof(address);
+        ::getsockname(listenFd_, reinterpret_cast<sockaddr*>(&address), &length);
+        port_ = ntohs(address.sin_port);
+        acceptThread_ = std::thread([this]() { acceptLoop(); });
+    }
+    
+    ~StandInNode() {
+        stopping_ = true;
+        acceptThread_.join();
+        for (auto& thread : connections_) {
+            thread.join();
+        }
+        ::close(listenFd_);
+    }
+    
+    std::string httpUrl() const { return "http://127.0.0.1:" + std::to_string(port_); }
+    std::string wsUrl() const { return "ws://127.0.0.1:" + std::to_string(port_) + "/ws"; }
+
+private:
+    RpcHandler rpc_;
+    SocketHandler socket_;
+    std::atomic<bool> stopping_;
+    std::atomic<int> sockets_;
+    int listenFd_;
+    uint16_t port_;
+    std::thread acceptThread_;
+    std::vector<std::thread> connections_;
+    
+    void acceptLoop() {
+        while (!stopping_) {
+            pollfd descriptor{listenFd_, POLLIN, 0};
+            if (::poll(&descriptor, 1, 20) <= 0) {
+                continue;
+            }
+            int fd = ::accept(listenFd_, nullptr, nullptr);
+            if (fd >= 0) {
+                connections_.emplace_back([this, fd]() { serve(fd); });
+            }
+        }
+    }
+    
+    void serve(int fd) {
+        Peer peer(fd);
+        std::string& buffer = peer.buffer_;
+        size_t headerEnd;
+        char chunk[4096];
+        while ((headerEnd = buffer.find("\r\n\r\n")) == std::string::npos) {
+            ssize_t received = ::recv(fd, chunk, sizeof(chunk), 0);
+            if (received <= 0) {
+                ::close(fd);
+                return;
+            }
+            buffer.append(chunk, static_cast<size_t>(received));
+        }
+        std::string head = buffer.substr(0, headerEnd);
+        buffer.erase(0, headerEnd + 4);
+        
+        size_t keyStart = head.find("Sec-WebSocket-Key: ");
+        if (keyStart != std::string::npos) {
+            std::string key = head.substr(keyStart + 19, head.find("\r\n", keyStart) - keyStart - 19);
+            std::string input = key + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+            Bytes digest(SHA_DIGEST_LENGTH);
+            SHA1(reinterpret_cast<const unsigned char*>(input.data()), input.size(), digest.data());
+            std::string response = "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                                   "Sec-WebSocket-Accept: " + Base64::encode(digest) + "\r\n\r\n";
+            ::send(fd, response.data(), response.size(), MSG_NOSIGNAL);
+            socket_(peer, sockets_++);
+            ::close(fd);
+            return;
+        }
+        
+        size_t lengthStart = head.find("Content-Length: ");
+        size_t contentLength = lengthStart == std::string::npos ? 0 : std::stoul(head.substr(lengthStart + 16));
+        while (buffer.size() < contentLength) {
+            ssize_t received = ::recv(fd, chunk, sizeof(chunk), 0);
+            if (received <= 0) {
+                break;
+            }
+            buffer.append(chunk, static_cast<size_t>(received));
+        }
+        json request = json::parse(buffer.substr(0, contentLength));
+        json body = {{"jsonrpc", "2.0"}, {"id", request["id"]},
+                     {"result", rpc_(request["method"].get<std::string>(), request["params"])}};
+        std::string text = body.dump();
+        std::string response = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nConnection: close\r\n"
+                               "Content-Length: " + std::to_string(text.size()) + "\r\n\r\n" + text;
+        ::send(fd, response.data(), response.size(), MSG_NOSIGNAL);
+        ::close(fd);
+    }
+};
+
+std::string blockHash(uint32_t index) {
+    char hash[67];
+    std::snprintf(hash, sizeof(hash), "0x%064x", index + 1);
+    return hash;
+}
+
+json makeBlock(uint32_t index) {
+    return {{"index", index}, {"hash", blockHash(index)}, {"primary", 0}, {"tx", json::array()}};
+}
+
+} // namespace
+
+TEST_CASE("SubscriptionClient Tests", "[protocol]") {
+    Hash160 token("0xd2a4cff31913016155e38e474a2c06d08be276cf");
+    SubscriptionClientConfig config;
+    config.reconnectDelay = std::chrono::milliseconds(20);
+    
+    SECTION("Filters are sent to the server and events are typed") {
+        std::mutex mutex;
+        std::vector<json> requests;
+        StandInNode node(nullptr, [&](Peer& peer, int) {
+            std::vector<json> received;
+            peer.confirmSubscriptions(1, &received);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                requests = received;
+            }
+            peer.sendEvent("notification_from_execution", {
+                {"container", blockHash(7)},
+                {"contract", "0x" + token.toString()},
+                {"eventname", "Transfer"},
+                {"state", {{"type", "Array"}, {"value", json::array()}}}
+            });
+            std::string text;
+            peer.readMessage(text, 2000);
+        });
+        
+        SubscriptionClient client(node.wsUrl(), nullptr, config);
+        std::vector<ExecutionNotificationEvent> events;
+        NotificationFilter filter;
+        filter.contract = token;
+        filter.name = "Transfer";
+        client.subscribeNotifications([&](const ExecutionNotificationEvent& event) {
+            std::lock_guard<std::mutex> lock(mutex);
+            events.push_back(event);
+        }, filter);
+        client.start();
+        
+        REQUIRE(test::eventually([&]() { std::lock_guard<std::mutex> lock(mutex); return !events.empty(); }));
+        client.stop();
+        
+        REQUIRE(requests.size() == 1);
+        REQUIRE(requests[0]["method"] == "subscribe");
+        REQUIRE(requests[0]["params"][0] == "notification_from_execution");
+        REQUIRE(requests[0]["params"][1]["contract"] == "0x" + token.toString());
+        REQUIRE(requests[0]["params"][1]["name"] == "Transfer");
+        
+        REQUIRE(events.size() == 1);
+        REQUIRE(events[0].contract == token);
+        REQUIRE(events[0].eventName == "Transfer");
+        REQUIRE(events[0].container == Hash256(blockHash(7)));
+        REQUIRE(events[0].state["type"] == "Array");
+    }
+    
+    SECTION("Reconnects and resumes from the last block") {
+        std::atomic<uint32_t> blockCount{7};
+        StandInNode node([&](const std::string& method, const json& params) -> json {
+            if (method == "getblockcount") {
+                return blockCount.load();
+            }
+            if (method == "getblock") {
+                return makeBlock(params[0].get<uint32_t>());
+            }
+            throw std::runtime_error("unexpected " + method);
+        }, [&](Peer& peer, int connection) {
+            // The client's own block subscription plus the test's
+            peer.confirmSubscriptions(2);
+            if (connection == 0) {
+                peer.sendEvent("block_added", makeBlock(5));
+                peer.sendEvent("block_added", makeBlock(6));
+                // Blocks 7 to 9 are produced while the client is disconnected
+                blockCount = 10;
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                return;
+            }
+            peer.sendEvent("block_added", makeBlock(9));
+            peer.sendEvent("block_added", makeBlock(10));
+            std::string text;
+            peer.readMessage(text, 2000);
+        });
+        
+        auto rpcClient = std::make_shared<EpicChainRpcClient>(node.httpUrl());
+        SubscriptionClient client(node.wsUrl(), rpcClient, config);
+        std::mutex mutex;
+        std::vector<uint32_t> indices;
+        client.subscribeBlocks([&](const BlockAddedEvent& event) {
+            std::lock_guard<std::mutex> lock(mutex);
+            indices.push_back(event.index);
+        });
+        client.start();
+        
+        REQUIRE(test::eventually([&]() { std::lock_guard<std::mutex> lock(mutex); return indices.size() >= 6; }));
+        client.stop();
+        
+        REQUIRE(indices == std::vector<uint32_t>{5, 6, 7, 8, 9, 10});
+        REQUIRE(client.getLastBlockIndex() == 10);
+    }
+    
+    SECTION("Starting from an index requires an RPC client") {
+        SubscriptionClient client("ws://127.0.0.1:1/ws");
+        REQUIRE_THROWS_AS(client.start(3), IllegalStateException);
+        REQUIRE_THROWS_AS(SubscriptionClient("ftp://127.0.0.1/ws"), IllegalArgumentException);
+    }
+}
@@ -0,0 +1,45 @@
+#include <catch2/catch_test_macros.hpp>
+#include "epicchaincpp/script/interop_service.hpp"
+#include "epicchaincpp/script/script_builder.hpp"
+#include "epicchaincpp/script/op_code.hpp"
+#include "epicchaincpp/crypto/hash.hpp"
+#include "epicchaincpp/utils/hex.hpp"
+#include <string>
+
+using namespace epicchaincpp;
+
+TEST_CASE("InteropService Tests", "[script]") {
+    
+    SECTION("Precomputed hashes match SHA-256 of the names") {
+        for (const auto& descriptor : InteropService::DESCRIPTORS) {
+            REQUIRE(descriptor.hash == InteropService::computeHash(descriptor.name));
+        }
+    }
+    
+    SECTION("Known hashes") {
+        static_assert(InteropService::getHash(InteropId::SYSTEM_CONTRACT_CALL) == 0x525b7d62, "System.Contract.Call");
+        REQUIRE(InteropService::getHash(InteropId::SYSTEM_CRYPTO_CHECK_SIG) == 0x27b3e756);
+        REQUIRE(std::string(InteropService::getName(InteropId::SYSTEM_RUNTIME_CHECK_WITNESS)) == "System.Runtime.CheckWitness");
+        REQUIRE(InteropService::SYSTEM_STORAGE_GET == "System.Storage.Get");
+    }
+    
+    SECTION("Lookup by name") {
+        REQUIRE(InteropService::getHash("System.Contract.Call") == InteropService::getHash(InteropId::SYSTEM_CONTRACT_CALL));
+        
+        // Unknown names are hashed, and give the same hash when cached
+        std::string custom = "Custom.Service.Method";
+        uint32_t hash = InteropService::computeHash(custom);
+        REQUIRE(InteropService::getHash(custom) == hash);
+        REQUIRE(InteropService::getHash(custom) == hash);
+    }
+    
+    SECTION("Emit syscall by id") {
+        ScriptBuilder byId;
+        byId.emitSysCall(InteropId::SYSTEM_CONTRACT_CALL);
+        REQUIRE(Hex::encode(byId.toArray()) == "41627d5b52");
+        
+        ScriptBuilder byName;
+        byName.emitSysCall("System.Contract.Call");
+        REQUIRE(byName.toArray() == byId.toArray());
+    }
+}
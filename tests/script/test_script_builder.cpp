@@ -4,6 +4,7 @@
 #include "epicchaincpp/utils/hex.hpp"
 #include "epicchaincpp/types/hash160.hpp"
 #include "epicchaincpp/types/hash256.hpp"
+#include "epicchaincpp/types/contract_parameter.hpp"
 #include "epicchaincpp/crypto/ec_key_pair.hpp"
 
 using namespace epicchaincpp;
@@ -167,6 +168,36 @@ TEST_CASE("ScriptBuilder Tests", "[script]") {
         REQUIRE(script.size() >= 5);
     }
     
+    SECTION("Call contract and unwrap iterator") {
+        ScriptBuilder builder;
+        builder.callContractAndUnwrapIterator(Hash160("0x1234567890abcdef1234567890abcdef12345678"), "tokens", {}, 100);
+        Bytes script = builder.toArray();
+        
+        // PUSHINT8 100, then the contract call
+        REQUIRE(script[0] == static_cast<uint8_t>(OpCode::PUSHINT8));
+        REQUIRE(script[1] == 100);
+        
+        // The loop ends by dropping the iterator and the limit
+        size_t size = script.size();
+        REQUIRE(script[size - 1] == static_cast<uint8_t>(OpCode::NIP));
+        REQUIRE(script[size - 2] == static_cast<uint8_t>(OpCode::NIP));
+        
+        // The backward jump returns to the top of the loop
+        size_t loopJump = size - 4;
+        REQUIRE(script[loopJump] == static_cast<uint8_t>(OpCode::JMPIFNOT));
+        size_t loopStart = loopJump + static_cast<int8_t>(script[loopJump + 1]);
+        REQUIRE(script[loopStart - 1] == static_cast<uint8_t>(OpCode::NEWARRAY0));
+        REQUIRE(script[loopStart] == static_cast<uint8_t>(OpCode::OVER));
+        
+        // Iterator.Next is followed by the exit jump to the trailing NIPs
+        size_t exitJump = loopStart + 6;
+        REQUIRE(script[loopStart + 1] == static_cast<uint8_t>(OpCode::SYSCALL));
+        REQUIRE(script[exitJump] == static_cast<uint8_t>(OpCode::JMPIFNOT));
+        REQUIRE(exitJump + script[exitJump + 1] == size - 2);
+        
+        REQUIRE_THROWS(builder.callContractAndUnwrapIterator(Hash160("0x1234567890abcdef1234567890abcdef12345678"), "tokens", {}, 0));
+    }
+    
     SECTION("Build verification script") {
         ECKeyPair keyPair = ECKeyPair::generate();
         
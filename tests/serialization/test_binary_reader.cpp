@@ -248,4 +248,36 @@ TEST_CASE("BinaryReader Tests", "[serialization]") {
         REQUIRE(reader.position() == 0);
         REQUIRE_THROWS_AS(reader.readByte(), DeserializationException);
     }
+    
+    SECTION("Span views point into the source buffer") {
+        Bytes data = {0x03, 0xAA, 0xBB, 0xCC, 0x01, 0x02};
+        BinaryReader reader(data);
+        
+        ByteSpan var = reader.readVarSpan();
+        REQUIRE(var.size() == 3);
+        REQUIRE(var.data() == data.data() + 1);
+        REQUIRE(var.toBytes() == Bytes{0xAA, 0xBB, 0xCC});
+        
+        ByteSpan fixed = reader.readSpan(2);
+        REQUIRE(fixed.data() == data.data() + 4);
+        REQUIRE(fixed[1] == 0x02);
+        REQUIRE_FALSE(reader.hasMore());
+        REQUIRE_THROWS_AS(reader.readSpan(1), DeserializationException);
+    }
+    
+    SECTION("String views") {
+        Bytes data = {0x05, 'h', 'e', 'l', 'l', 'o', 'N', 'E', 0x00, 0x00};
+        BinaryReader reader(data);
+        
+        REQUIRE(reader.readVarStringView() == "hello");
+        REQUIRE(reader.readFixedStringView(4) == "NE");
+        REQUIRE(reader.position() == data.size());
+    }
+    
+    SECTION("Var span length beyond remaining data") {
+        Bytes data = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01};
+        BinaryReader reader(data);
+        
+        REQUIRE_THROWS_AS(reader.readVarSpan(), DeserializationException);
+    }
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include "epicchaincpp/serialization/binary_writer.hpp"
 #include "epicchaincpp/utils/hex.hpp"
+#include "epicchaincpp/exceptions.hpp"
 
 using namespace epicchaincpp;
 
@@ -169,4 +170,49 @@ TEST_CASE("BinaryWriter Tests", "[serialization]") {
         REQUIRE(result[3] == 0x00);
         REQUIRE(result[4] == 0x00);
     }
+    
+    SECTION("Fixed-width integers are little-endian") {
+        BinaryWriter writer;
+        
+        writer.writeUInt16(0x0102);
+        writer.writeInt32(-2);
+        writer.writeUInt64(0x0102030405060708ULL);
+        
+        REQUIRE(writer.toArray() == Bytes{0x02, 0x01,
+                                          0xFE, 0xFF, 0xFF, 0xFF,
+                                          0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01});
+    }
+    
+    SECTION("Fixed buffer mode") {
+        FixedBinaryWriter<8> writer;
+        
+        writer.writeUInt32(0x04030201);
+        writer.writeVarBytes(Bytes{0xAA, 0xBB});
+        REQUIRE(writer.size() == 7);
+        REQUIRE(writer.view().toBytes() == Bytes{0x01, 0x02, 0x03, 0x04, 0x02, 0xAA, 0xBB});
+        
+        REQUIRE_THROWS_AS(writer.writeUInt16(1), SerializationException);
+        REQUIRE_THROWS_AS(writer.toArray(), IllegalStateException);
+        
+        writer.clear();
+        writer.writeUInt64(0);
+        REQUIRE(writer.size() == 8);
+    }
+    
+    SECTION("Release moves the buffer out") {
+        BinaryWriter writer;
+        writer.reserve(16);
+        writer.writeFixedString("ab", 4);
+        
+        Bytes result = writer.release();
+        REQUIRE(result == Bytes{'a', 'b', 0x00, 0x00});
+        REQUIRE(writer.size() == 0);
+    }
+    
+    SECTION("VarInt size") {
+        REQUIRE(BinaryWriter::getVarSize(0xFC) == 1);
+        REQUIRE(BinaryWriter::getVarSize(0xFD) == 3);
+        REQUIRE(BinaryWriter::getVarSize(0x10000) == 5);
+        REQUIRE(BinaryWriter::getVarSize(0x100000000ULL) == 9);
+    }
 }
\ No newline at end of file
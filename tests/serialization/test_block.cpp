@@ -0,0 +1,175 @@
+#include <catch2/catch_test_macros.hpp>
+#include "epicchaincpp/protocol/core/block.hpp"
+#include "epicchaincpp/protocol/response_types_impl.hpp"
+#include "epicchaincpp/transaction/transaction.hpp"
+#include "epicchaincpp/transaction/transaction_attribute.hpp"
+#include "epicchaincpp/transaction/signer.hpp"
+#include "epicchaincpp/transaction/witness.hpp"
+#include "epicchaincpp/serialization/binary_writer.hpp"
+#include "epicchaincpp/serialization/binary_reader.hpp"
+#include "epicchaincpp/utils/base64.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include "epicchaincpp/epicchain_constants.hpp"
+
+using namespace epicchaincpp;
+
+namespace {
+
+SharedPtr<Transaction> makeTransaction() {
+    auto tx = std::make_shared<Transaction>();
+    tx->setNonce(0x01020304);
+    tx->setSystemFee(100000);
+    tx->setNetworkFee(2000);
+    tx->setValidUntilBlock(1234);
+    tx->setScript({0x11, 0x40});
+    tx->addSigner(std::make_shared<Signer>(Hash160("0x" + std::string(40, 'a')), WitnessScope::CALLED_BY_ENTRY));
+    tx->addAttribute(TransactionAttribute::highPriority());
+    tx->addWitness(std::make_shared<Witness>(Bytes{0x0c, 0x01, 0xaa}, Bytes{0x41}));
+    return tx;
+}
+
+Bytes makeBlock(const std::vector<SharedPtr<Transaction>>& txs, uint32_t witnessCount = 1) {
+    BinaryWriter writer;
+    writer.writeUInt32(0);                      // version
+    writer.writeBytes(Bytes(32, 0x11));         // previous hash
+    writer.writeBytes(Bytes(32, 0x22));         // merkle root
+    writer.writeUInt64(1700000000000ULL);       // timestamp
+    writer.writeUInt64(0x0102030405060708ULL);  // nonce
+    writer.writeUInt32(42);                     // index
+    writer.writeUInt8(3);                       // primary index
+    writer.writeBytes(Bytes(20, 0x33));         // next consensus
+    writer.writeVarInt(witnessCount);
+    for (uint32_t i = 0; i < witnessCount; ++i) {
+        Witness(Bytes{0x0c, 0x02, 0x01, 0x02}, Bytes{0x41}).serialize(writer);
+    }
+    writer.writeVarInt(txs.size());
+    for (const auto& tx : txs) {
+        tx->serialize(writer);
+    }
+    return writer.toArray();
+}
+
+} // namespace
+
+TEST_CASE("Block decoding", "[serialization]") {
+
+    SECTION("Decode header fields") {
+        Bytes raw = makeBlock({});
+        BinaryReader reader(raw);
+        auto block = Block::deserialize(reader);
+
+        const auto& header = block->getHeader();
+        REQUIRE(header->getVersion() == 0);
+        REQUIRE(header->getPreviousHash().toArray() == Bytes(32, 0x11));
+        REQUIRE(header->getMerkleRoot().toArray() == Bytes(32, 0x22));
+        REQUIRE(header->getTimestamp() == 1700000000000ULL);
+        REQUIRE(header->getNonce() == 0x0102030405060708ULL);
+        REQUIRE(block->getIndex() == 42);
+        REQUIRE(header->getPrimaryIndex() == 3);
+        REQUIRE(header->getNextConsensus().toArray() == Bytes(20, 0x33));
+        REQUIRE(header->getWitness()->getVerificationScript() == Bytes{0x41});
+        REQUIRE(block->getTransactions().empty());
+        REQUIRE_FALSE(reader.hasMore());
+    }
+
+    SECTION("Decode transactions with attributes") {
+        auto tx = makeTransaction();
+        Bytes raw = makeBlock({tx, tx});
+        auto block = Block::fromBase64(Base64::encode(raw));
+
+        REQUIRE(block->getTransactions().size() == 2);
+        const auto& decoded = block->getTransactions()[0];
+        REQUIRE(decoded->getNonce() == tx->getNonce());
+        REQUIRE(decoded->getSystemFee() == tx->getSystemFee());
+        REQUIRE(decoded->getNetworkFee() == tx->getNetworkFee());
+        REQUIRE(decoded->getValidUntilBlock() == tx->getValidUntilBlock());
+        REQUIRE(decoded->getSigners().size() == 1);
+        REQUIRE(decoded->getAttributes().size() == 1);
+        REQUIRE(decoded->getAttributes()[0]->getType() == TransactionAttributeType::HIGH_PRIORITY);
+        REQUIRE(decoded->getScript() == tx->getScript());
+        REQUIRE(decoded->getHash() == tx->getHash());
+    }
+
+    SECTION("Round trip") {
+        Bytes raw = makeBlock({makeTransaction()});
+        BinaryReader reader(raw);
+        auto block = Block::deserialize(reader);
+
+        BinaryWriter writer;
+        block->serialize(writer);
+        REQUIRE(writer.toArray() == raw);
+        REQUIRE(block->getSize() == raw.size());
+    }
+
+    SECTION("Hash is stable and depends on the unsigned header only") {
+        Bytes raw = makeBlock({});
+        BinaryReader r1(raw);
+        auto a = Block::deserialize(r1);
+        Bytes withTx = makeBlock({makeTransaction()});
+        BinaryReader r2(withTx);
+        auto b = Block::deserialize(r2);
+        REQUIRE(a->getHash() == b->getHash());
+    }
+
+    SECTION("Reject malformed blocks") {
+        Bytes twoWitnesses = makeBlock({}, 2);
+        BinaryReader reader(twoWitnesses);
+        REQUIRE_THROWS_AS(Block::deserialize(reader), DeserializationException);
+
+        Bytes trailing = makeBlock({});
+        trailing.push_back(0x00);
+        REQUIRE_THROWS_AS(Block::fromBase64(Base64::encode(trailing)), DeserializationException);
+
+        Bytes truncated = makeBlock({makeTransaction()});
+        truncated.resize(truncated.size() - 3);
+        REQUIRE_THROWS(Block::fromBase64(Base64::encode(truncated)));
+
+        auto crowded = makeTransaction();
+        for (int i = 0; i < NeoConstants::MAX_SIGNERS; ++i) {
+            crowded->addSigner(std::make_shared<Signer>(Hash160("0x" + std::string(40, 'b')), WitnessScope::NONE));
+        }
+        REQUIRE_THROWS_AS(Block::fromBase64(Base64::encode(makeBlock({crowded}))), DeserializationException);
+    }
+}
+
+TEST_CASE("Raw transaction decoding", "[serialization]") {
+    // A GAS transfer in node wire format and its txid in the node's display order
+    const std::string raw =
+        "ANIHn06POQ8AAAAAAOi+EgAAAAAANBJBAAH2QqBAH91WoDEUY5qYt5Y+tYejCgEAWwsCAOH1BQwUWK7P0zW+HrPTET7cUYAJY9/XLZ8M"
+        "FPZCoEAf3VagMRRjmpi3lj61h6MKFMAfDAh0cmFuc2ZlcgwUz3bii9AGLEpHjuNVYQETGfPPpNJBYn1bUjkBQgxAAAECAwQFBgcICQoL"
+        "DA0ODxAREhMUFRYXGBkaGxwdHh8gISIjJCUmJygpKissLS4vMDEyMzQ1Njc4OTo7PD0+PygMIQIBAgMEBQYHCAkKCwwNDg8QERITFBUW"
+        "FxgZGhscHR4fIEFW57Mn";
+    const std::string txid = "0x8cba582c96928ea123f52fefe896da10c412018656e350000d4d52d6c44c171a";
+
+    SECTION("Non-verbose hash matches the verbose one") {
+        EpicChainGetRawTransactionResponse binary;
+        binary.parseJson(raw);
+        REQUIRE(binary.getHash() == Hash256::fromHexString(txid));
+        REQUIRE(binary.getSize() == 249);
+        REQUIRE(binary.getNonce() == 0x4e9f07d2);
+        REQUIRE(binary.getValidUntilBlock() == 4264500);
+
+        EpicChainGetRawTransactionResponse verbose;
+        verbose.parseJson(nlohmann::json{{"hash", txid}});
+        REQUIRE(binary.getHash() == verbose.getHash());
+    }
+
+    SECTION("Transactions decoded from a block report the same hash") {
+        Bytes data = Base64::decode(raw);
+        BinaryReader reader(data);
+        auto tx = Transaction::deserialize(reader);
+        REQUIRE("0x" + tx->getTxId() == txid);
+
+        EpicChainGetBlockResponse block;
+        block.parseJson(Base64::encode(makeBlock({tx, makeTransaction()})));
+        const auto& transactions = block.getBlock()->getTransactions();
+        REQUIRE(transactions.size() == 2);
+        REQUIRE(transactions[0]->getHash() == Hash256::fromHexString(txid));
+
+        // The batched path must agree with the lazy one
+        auto fresh = Block::fromBase64(Base64::encode(makeBlock({tx, makeTransaction()})));
+        Transaction::calculateHashes(fresh->getTransactions());
+        REQUIRE(fresh->getTransactions()[0]->getHash() == transactions[0]->getHash());
+        REQUIRE(fresh->getTransactions()[1]->getHash() == makeTransaction()->calculateHash());
+    }
+}
@@ -0,0 +1,139 @@
+#include <catch2/catch_test_macros.hpp>
+#include "epicchaincpp/transaction/network_fee_calculator.hpp"
+#include "epicchaincpp/transaction/transaction.hpp"
+#include "epicchaincpp/transaction/signer.hpp"
+#include "epicchaincpp/transaction/witness.hpp"
+#include "epicchaincpp/transaction/witness_scope.hpp"
+#include "epicchaincpp/crypto/ec_key_pair.hpp"
+#include "epicchaincpp/script/script_builder.hpp"
+#include "epicchaincpp/script/interop_service.hpp"
+#include "epicchaincpp/types/hash160.hpp"
+#include "epicchaincpp/exceptions.hpp"
+#include <algorithm>
+#include <vector>
+
+using namespace epicchaincpp;
+
+namespace {
+
+/// Verification scripts as the node sees them: PUSHDATA1-encoded keys
+Bytes signatureScript(const Bytes& publicKey) {
+    Bytes script = {0x0c, 0x21};
+    script.insert(script.end(), publicKey.begin(), publicKey.end());
+    script.push_back(0x41);
+    uint32_t hash = InteropService::getHash(InteropId::SYSTEM_CRYPTO_CHECK_SIG);
+    for (int i = 0; i < 4; ++i) {
+        script.push_back((hash >> (i * 8)) & 0xFF);
+    }
+    return script;
+}
+
+Bytes multiSignatureScript(int m, const std::vector<Bytes>& publicKeys) {
+    Bytes script = {static_cast<uint8_t>(0x10 + m)};
+    for (const auto& key : publicKeys) {
+        script.push_back(0x0c);
+        script.push_back(0x21);
+        script.insert(script.end(), key.begin(), key.end());
+    }
+    script.push_back(static_cast<uint8_t>(0x10 + publicKeys.size()));
+    script.push_back(0x41);
+    uint32_t hash = InteropService::getHash(InteropId::SYSTEM_CRYPTO_CHECK_MULTISIG);
+    for (int i = 0; i < 4; ++i) {
+        script.push_back((hash >> (i * 8)) & 0xFF);
+    }
+    return script;
+}
+
+/// Same shape as the node's fee test transactions: one CalledByEntry signer,
+/// no attributes and an 87-byte NEP-17 transfer script
+Transaction makeTransferTransaction() {
+    Transaction tx;
+    tx.setNonce(1);
+    tx.setValidUntilBlock(100);
+    tx.setScript(Bytes(87, 0x0c));
+    tx.addSigner(std::make_shared<Signer>(Hash160(Bytes(20, 0x01)), WitnessScope::CALLED_BY_ENTRY));
+    return tx;
+}
+
+} // namespace
+
+TEST_CASE("NetworkFeeCalculator Tests", "[transaction]") {
+    // Default policy values of a fresh node
+    NetworkFeeCalculator calculator(1000, 30);
+    Bytes key1(33, 0x02);
+    Bytes key2(33, 0x03);
+    
+    SECTION("Verification costs") {
+        REQUIRE(NetworkFeeCalculator::signatureContractCost() == 32784);
+        REQUIRE(NetworkFeeCalculator::multiSignatureContractCost(2, 2) == 65570);
+        REQUIRE(NetworkFeeCalculator::multiSignatureContractCost(3, 5) == 163906);
+    }
+    
+    SECTION("Signature account matches node output") {
+        // Recorded by the node for this shape: 245 bytes, 983520 verification + 245000 size
+        Transaction tx = makeTransferTransaction();
+        REQUIRE(calculator.calculate(tx, {signatureScript(key1)}) == 1228520);
+    }
+    
+    SECTION("Multi-signature account matches node output") {
+        // Recorded by the node for a 2-of-2 account: 348 bytes, 1967100 verification + 348000 size
+        Transaction tx = makeTransferTransaction();
+        REQUIRE(calculator.calculate(tx, {multiSignatureScript(2, {key1, key2})}) == 2315100);
+    }
+    
+    SECTION("Fee equals the size of the signed transaction") {
+        Transaction tx = makeTransferTransaction();
+        int64_t fee = calculator.calculate(tx, {signatureScript(key1)});
+        
+        Bytes invocation = {0x0c, 0x40};
+        invocation.resize(66, 0xab);
+        tx.addWitness(std::make_shared<Witness>(invocation, signatureScript(key1)));
+        REQUIRE(fee == static_cast<int64_t>(tx.getSize()) * 1000 + 983520);
+    }
+    
+    SECTION("Scripts from ScriptBuilder are recognized") {
+        NetworkFeeCalculator::VerificationScriptInfo info;
+        auto keyPair = ECKeyPair::generate();
+        REQUIRE(NetworkFeeCalculator::parseVerificationScript(ScriptBuilder::buildVerificationScript(keyPair.getPublicKey()), info));
+        REQUIRE_FALSE(info.multiSig);
+        
+        std::vector<SharedPtr<ECPublicKey>> keys;
+        for (int i = 0; i < 5; ++i) {
+            keys.push_back(ECKeyPair::generate().getPublicKey());
+        }
+        REQUIRE(NetworkFeeCalculator::parseVerificationScript(ScriptBuilder::buildVerificationScript(keys, 3), info));
+        REQUIRE(info.multiSig);
+        REQUIRE(info.m == 3);
+        REQUIRE(info.n == 5);
+    }
+    
+    SECTION("Non-standard scripts are rejected") {
+        NetworkFeeCalculator::VerificationScriptInfo info;
+        REQUIRE_FALSE(NetworkFeeCalculator::parseVerificationScript(Bytes{}, info));
+        REQUIRE_FALSE(NetworkFeeCalculator::parseVerificationScript(Bytes{0x11, 0x40}, info));
+        
+        Bytes script = multiSignatureScript(2, {key1, key2});
+        script[0] = 0x13; // 3-of-2
+        REQUIRE_FALSE(NetworkFeeCalculator::parseVerificationScript(script, info));
+        
+        // Right shape, wrong interop service
+        Bytes sigScript = signatureScript(key1);
+        sigScript[sigScript.size() - 1] ^= 0xff;
+        REQUIRE_FALSE(NetworkFeeCalculator::parseVerificationScript(sigScript, info));
+        
+        Bytes multiSigScript = multiSignatureScript(1, {key1});
+        Bytes checkSig = signatureScript(key1);
+        std::copy(checkSig.end() - 4, checkSig.end(), multiSigScript.end() - 4);
+        REQUIRE_FALSE(NetworkFeeCalculator::parseVerificationScript(multiSigScript, info));
+        
+        Transaction tx = makeTransferTransaction();
+        REQUIRE_THROWS_AS(calculator.calculate(tx, {Bytes{0x11, 0x40}}), UnsupportedOperationException);
+        REQUIRE_THROWS_AS(calculator.calculate(tx, {}), IllegalArgumentException);
+    }
+    
+    SECTION("Fixed policy values") {
+        auto policy = calculator.getPolicy();
+        REQUIRE(policy.feePerByte == 1000);
+        REQUIRE(policy.execFeeFactor == 30);
+    }
+}
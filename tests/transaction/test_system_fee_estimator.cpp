@@ -0,0 +1,162 @@
+#include <catch2/catch_test_macros.hpp>
+#include "epicchaincpp/transaction/system_fee_estimator.hpp"
+#include "epicchaincpp/transaction/signer.hpp"
+#include "epicchaincpp/transaction/witness_scope.hpp"
+#include "epicchaincpp/transaction/transaction.hpp"
+#include "epicchaincpp/transaction/transaction_builder.hpp"
+#include "epicchaincpp/contract/fungible_token.hpp"
+#include "epicchaincpp/protocol/epicchain_rpc_client.hpp"
+#include "epicchaincpp/script/script_builder.hpp"
+#include "epicchaincpp/types/contract_parameter.hpp"
+#include "epicchaincpp/wallet/account.hpp"
+#include "epicchaincpp/script/interop_service.hpp"
+#include "epicchaincpp/types/hash160.hpp"
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace epicchaincpp;
+
+namespace {
+
+void pushData(Bytes& script, const Bytes& data) {
+    script.push_back(0x0c); // PUSHDATA1
+    script.push_back(static_cast<uint8_t>(data.size()));
+    script.insert(script.end(), data.begin(), data.end());
+}
+
+/// A NEP-17 transfer as the node encodes it
+Bytes transferScript(uint8_t contract, uint8_t from, uint8_t to, uint8_t amount) {
+    Bytes script;
+    script.push_back(0x0b);                 // PUSHNULL (data)
+    script.push_back(0x00);                 // PUSHINT8 amount
+    script.push_back(amount);
+    pushData(script, Bytes(20, to));
+    pushData(script, Bytes(20, from));
+    script.push_back(0x14);                 // PUSH4
+    script.push_back(0xc0);                 // PACK
+    script.push_back(0x1f);                 // PUSH15 (call flags)
+    pushData(script, Bytes{'t', 'r', 'a', 'n', 's', 'f', 'e', 'r'});
+    pushData(script, Bytes(20, contract));
+    script.push_back(0x41);                 // SYSCALL System.Contract.Call
+    uint32_t hash = InteropService::getHash(InteropId::SYSTEM_CONTRACT_CALL);
+    for (int i = 0; i < 4; ++i) {
+        script.push_back((hash >> (i * 8)) & 0xFF);
+    }
+    return script;
+}
+
+/// A call as ScriptBuilder encodes it: arguments, method, hash, with no PACK
+Bytes builderScript(uint8_t contract, const std::string& method, int64_t amount) {
+    ScriptBuilder builder;
+    builder.callContract(Hash160(Bytes(20, contract)), method, {
+        ContractParameter::hash160(Hash160(Bytes(20, 0x01))),
+        ContractParameter::integer(amount)
+    });
+    return builder.toArray();
+}
+
+std::vector<SharedPtr<Signer>> signers(WitnessScope scope) {
+    return {std::make_shared<Signer>(Hash160(Bytes(20, 0x01)), scope)};
+}
+
+} // namespace
+
+TEST_CASE("SystemFeeEstimator Tests", "[transaction]") {
+    auto calledByEntry = signers(WitnessScope::CALLED_BY_ENTRY);
+    
+    SECTION("Transfers differing in arguments share a key") {
+        REQUIRE(SystemFeeEstimator::makeKey(transferScript(0xcf, 1, 2, 10), calledByEntry) ==
+                SystemFeeEstimator::makeKey(transferScript(0xcf, 3, 4, 99), calledByEntry));
+    }
+    
+    SECTION("Contract, method and scopes stay in the key") {
+        auto key = SystemFeeEstimator::makeKey(transferScript(0xcf, 1, 2, 10), calledByEntry);
+        REQUIRE(key != SystemFeeEstimator::makeKey(transferScript(0xd2, 1, 2, 10), calledByEntry));
+        REQUIRE(key != SystemFeeEstimator::makeKey(transferScript(0xcf, 1, 2, 10), signers(WitnessScope::GLOBAL)));
+        
+        Bytes otherMethod = transferScript(0xcf, 1, 2, 10);
+        otherMethod[otherMethod.size() - 30] = 'T';
+        REQUIRE(key != SystemFeeEstimator::makeKey(otherMethod, calledByEntry));
+    }
+    
+    SECTION("ScriptBuilder calls keep contract and method") {
+        auto key = SystemFeeEstimator::makeKey(builderScript(0xcf, "transfer", 1000), calledByEntry);
+        REQUIRE(key == SystemFeeEstimator::makeKey(builderScript(0xcf, "transfer", 2000), calledByEntry));
+        REQUIRE(key != SystemFeeEstimator::makeKey(builderScript(0xd2, "transfer", 1000), calledByEntry));
+        REQUIRE(key != SystemFeeEstimator::makeKey(builderScript(0xcf, "decimals", 1000), calledByEntry));
+    }
+    
+    SECTION("FungibleToken transfers are keyed per token") {
+        auto client = std::make_shared<EpicChainRpcClient>("http://127.0.0.1:1");
+        auto from = Account::create();
+        FungibleToken tokenA(Hash160(Bytes(20, 0xcf)), client);
+        FungibleToken tokenB(Hash160(Bytes(20, 0xd2)), client);
+        auto script = [&](FungibleToken& token, const SharedPtr<Account>& to, int64_t amount) {
+            return token.transfer(from, to->getAddress(), amount)->getTransaction()->getScript();
+        };
+        
+        auto to1 = Account::create();
+        auto to2 = Account::create();
+        auto key = SystemFeeEstimator::makeKey(script(tokenA, to1, 1000), calledByEntry);
+        REQUIRE(key == SystemFeeEstimator::makeKey(script(tokenA, to2, 2000), calledByEntry));
+        REQUIRE(key != SystemFeeEstimator::makeKey(script(tokenB, to1, 1000), calledByEntry));
+        
+        SystemFeeEstimator estimator;
+        estimator.getSystemFee(script(tokenA, to1, 1000), calledByEntry, []() { return 100; });
+        REQUIRE(estimator.getSystemFee(script(tokenB, to1, 1000), calledByEntry, []() { return 200; }) == 200);
+    }
+    
+    SECTION("Undecodable scripts are kept as they are") {
+        Bytes truncated = {0x0c, 0x10, 0x01};
+        REQUIRE(SystemFeeEstimator::normalizeScript(truncated) == truncated);
+    }
+    
+    SECTION("Hits and misses") {
+        SystemFeeEstimator estimator;
+        int calls = 0;
+        auto estimate = [&calls]() { ++calls; return 997775; };
+        for (uint8_t i = 0; i < 10; ++i) {
+            REQUIRE(estimator.getSystemFee(transferScript(0xcf, i, i + 1, i), calledByEntry, estimate) == 997775);
+        }
+        REQUIRE(calls == 1);
+        
+        auto stats = estimator.getStats();
+        REQUIRE(stats.hits == 9);
+        REQUIRE(stats.misses == 1);
+        REQUIRE(stats.entries == 1);
+    }
+    
+    SECTION("New blocks invalidate") {
+        SystemFeeEstimator estimator;
+        int calls = 0;
+        auto estimate = [&calls]() { ++calls; return 100; };
+        estimator.onNewBlock(10);
+        estimator.getSystemFee(transferScript(0xcf, 1, 2, 3), calledByEntry, estimate);
+        estimator.onNewBlock(10);
+        estimator.getSystemFee(transferScript(0xcf, 1, 2, 3), calledByEntry, estimate);
+        REQUIRE(calls == 1);
+        
+        estimator.onNewBlock(11);
+        REQUIRE(estimator.getStats().entries == 0);
+        estimator.getSystemFee(transferScript(0xcf, 1, 2, 3), calledByEntry, estimate);
+        REQUIRE(calls == 2);
+    }
+    
+    SECTION("Entries expire") {
+        SystemFeeEstimator estimator(std::chrono::milliseconds(20));
+        int calls = 0;
+        auto estimate = [&calls]() { ++calls; return 100; };
+        estimator.getSystemFee(transferScript(0xcf, 1, 2, 3), calledByEntry, estimate);
+        std::this_thread::sleep_for(std::chrono::milliseconds(40));
+        estimator.getSystemFee(transferScript(0xcf, 1, 2, 3), calledByEntry, estimate);
+        REQUIRE(calls == 2);
+    }
+    
+    SECTION("Failed estimates are not cached") {
+        SystemFeeEstimator estimator;
+        auto failing = []() -> int64_t { throw std::runtime_error("FAULT"); };
+        REQUIRE_THROWS(estimator.getSystemFee(transferScript(0xcf, 1, 2, 3), calledByEntry, failing));
+        REQUIRE(estimator.getStats().entries == 0);
+    }
+}
@@ -141,6 +141,8 @@ TEST_CASE("Transaction Tests", "[transaction]") {
         REQUIRE(deserialized->getValidUntilBlock() == tx.getValidUntilBlock());
         REQUIRE(deserialized->getScript() == tx.getScript());
         REQUIRE(deserialized->getSigners().size() == tx.getSigners().size());
+        REQUIRE(tx.getSize() == serialized.size());
+        REQUIRE(tx.toArray() == serialized);
     }
     
     SECTION("Sign transaction manually") {
@@ -164,7 +166,7 @@ TEST_CASE("Transaction Tests", "[transaction]") {
         Hash256 txHash = tx.getHash();
         
         // Sign the hash
-        auto signature = keyPair.sign(txHash.toArray());
+        auto signature = keyPair.sign(txHash.toLittleEndianArray());
         
         // Create witness with signature and verification script
         ScriptBuilder invocationBuilder;
@@ -217,4 +219,21 @@ TEST_CASE("Transaction Tests", "[transaction]") {
         // Since TransactionAttribute is not fully implemented, we skip detailed testing
         REQUIRE(tx.getAttributes().empty());
     }
-}
\ No newline at end of file
+    
+    SECTION("Calculate many transaction hashes at once") {
+        std::vector<SharedPtr<Transaction>> transactions;
+        for (uint32_t i = 0; i < 20; i++) {
+            auto tx = std::make_shared<Transaction>();
+            tx->setNonce(i);
+            tx->setScript(Bytes(i * 10, 0x51));
+            transactions.push_back(tx);
+        }
+        Hash256 cached = transactions[3]->getHash();
+        
+        Transaction::calculateHashes(transactions);
+        for (const auto& tx : transactions) {
+            REQUIRE(tx->getHash() == tx->calculateHash());
+        }
+        REQUIRE(transactions[3]->getHash() == cached);
+    }
+}
@@ -139,4 +139,23 @@ TEST_CASE("Hash160 Tests", "[types]") {
         Hash160 multiSigHash3 = Hash160::fromPublicKeys(publicKeys, 1);
         REQUIRE_FALSE(multiSigHash == multiSigHash3);
     }
-}
\ No newline at end of file
+    
+    SECTION("Batch script hashes match one at a time") {
+        std::vector<Bytes> publicKeys;
+        std::vector<Bytes> scripts;
+        for (int i = 0; i < 20; i++) {
+            publicKeys.push_back(ECKeyPair::generate().getPublicKey()->getEncoded());
+            scripts.push_back(Bytes(static_cast<size_t>(i * 7), static_cast<uint8_t>(i)));
+        }
+        
+        auto keyHashes = Hash160::fromEachPublicKey(publicKeys);
+        auto scriptHashes = Hash160::fromScripts(scripts);
+        REQUIRE(keyHashes.size() == publicKeys.size());
+        REQUIRE(scriptHashes.size() == scripts.size());
+        for (size_t i = 0; i < publicKeys.size(); i++) {
+            REQUIRE(keyHashes[i] == Hash160::fromPublicKey(publicKeys[i]));
+            REQUIRE(scriptHashes[i] == Hash160::fromScript(scripts[i]));
+        }
+        REQUIRE(Hash160::fromScripts({}).empty());
+    }
+}
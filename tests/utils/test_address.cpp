@@ -1,6 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include "epicchaincpp/utils/address.hpp"
 #include "epicchaincpp/utils/hex.hpp"
+#include "epicchaincpp/exceptions.hpp"
 #include "epicchaincpp/crypto/ec_key_pair.hpp"
 #include "epicchaincpp/crypto/hash.hpp"
 #include "epicchaincpp/script/script_builder.hpp"
@@ -48,6 +49,18 @@ TEST_CASE("AddressUtils Tests", "[utils]") {
         REQUIRE(AddressUtils::isValidAddress("NZNos2WqTbu5oCgyfss9kUJgBXJqhuYAajXX") == false); // Too long
     }
     
+    SECTION("Validate and convert in one pass") {
+        uint8_t scriptHash[20];
+        REQUIRE(AddressUtils::tryAddressToScriptHash("NZNos2WqTbu5oCgyfss9kUJgBXJqhuYAaj", scriptHash));
+        REQUIRE(Bytes(scriptHash, scriptHash + 20) == AddressUtils::addressToScriptHash("NZNos2WqTbu5oCgyfss9kUJgBXJqhuYAaj"));
+        REQUIRE(AddressUtils::scriptHashToAddress(scriptHash) == "NZNos2WqTbu5oCgyfss9kUJgBXJqhuYAaj");
+        
+        REQUIRE_FALSE(AddressUtils::tryAddressToScriptHash("NZNos2WqTbu5oCgyfss9kUJgBXJqhuYAak", scriptHash)); // Bad checksum
+        REQUIRE_FALSE(AddressUtils::tryAddressToScriptHash("MZNos2WqTbu5oCgyfss9kUJgBXJqhuYAaj", scriptHash));
+        REQUIRE_FALSE(AddressUtils::tryAddressToScriptHash("NZNos2WqTbu5oCgyfss9kUJgBXJqhuYA0j", scriptHash)); // Not Base58
+        REQUIRE_THROWS_AS(AddressUtils::addressToScriptHash("NZNos2WqTbu5oCgyfss9kUJgBXJqhuYAak"), IllegalArgumentException);
+    }
+    
     SECTION("Create address from public key") {
         ECKeyPair keyPair = ECKeyPair::generate();
         
@@ -1,5 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include "epicchaincpp/utils/hex.hpp"
+#include <cctype>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -138,4 +140,66 @@ TEST_CASE("Hex Tests", "[utils]") {
         REQUIRE(longHex.length() == 512);
         REQUIRE(Hex::decode(longHex) == longData);
     }
-}
\ No newline at end of file
+    
+    SECTION("Vector and scalar paths agree at every length") {
+        // Lengths around the 16 and 32 byte blocks, with every byte value
+        const char* digits = "0123456789abcdef";
+        for (size_t length = 0; length <= 200; ++length) {
+            Bytes data(length);
+            std::string expected;
+            for (size_t i = 0; i < length; ++i) {
+                data[i] = static_cast<uint8_t>(i * 37 + length);
+                expected += digits[data[i] >> 4];
+                expected += digits[data[i] & 0x0f];
+            }
+            std::string encoded = Hex::encode(data);
+            REQUIRE(encoded == expected);
+            REQUIRE(Hex::decode(encoded) == data);
+            
+            std::string upper = Hex::encode(data, true);
+            REQUIRE(upper.size() == expected.size());
+            REQUIRE(Hex::decode(upper) == data);
+            for (size_t i = 0; i < upper.size(); ++i) {
+                REQUIRE(std::tolower(static_cast<unsigned char>(upper[i])) == expected[i]);
+            }
+        }
+    }
+    
+    SECTION("Invalid characters are found anywhere") {
+        std::string valid = Hex::encode(Bytes(100, 0x5a));
+        for (char bad : {'/', ':', '@', 'G', '`', 'g', ' ', '\x80', '\xff'}) {
+            for (size_t position : {size_t(0), size_t(31), size_t(63), size_t(64), size_t(130), size_t(199)}) {
+                std::string hex = valid;
+                hex[position] = bad;
+                REQUIRE(Hex::decode(hex).empty());
+                REQUIRE_FALSE(Hex::isValid(hex));
+            }
+        }
+    }
+    
+    SECTION("Encode and decode into caller buffers") {
+        Bytes data = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF};
+        char text[16];
+        Hex::encode(data.data(), data.size(), text);
+        REQUIRE(std::string(text, 16) == "0123456789abcdef");
+        Hex::encode(data.data(), data.size(), text, true);
+        REQUIRE(std::string(text, 16) == "0123456789ABCDEF");
+        
+        uint8_t bytes[8];
+        REQUIRE(Hex::tryDecode(text, 16, bytes));
+        REQUIRE(Bytes(bytes, bytes + 8) == data);
+        REQUIRE_FALSE(Hex::tryDecode(text, 15, bytes));
+        REQUIRE_FALSE(Hex::tryDecode("0x12", 4, bytes));
+    }
+    
+    SECTION("ByteUtils forwards to Hex") {
+        Bytes data = {0x00, 0x0a, 0xff};
+        REQUIRE(ByteUtils::toHex(data) == "000aff");
+        REQUIRE(ByteUtils::toHex(data, true) == "0x000aff");
+        REQUIRE(ByteUtils::fromHex("0x000aff") == data);
+        REQUIRE(ByteUtils::fromHex("abc") == Bytes{0x0a, 0xbc}); // Odd length has an implied leading zero
+        REQUIRE(ByteUtils::fromHex("").empty());
+        REQUIRE_THROWS_AS(ByteUtils::fromHex("12zz"), std::invalid_argument);
+        REQUIRE_THROWS_AS(ByteUtils::fromHex("z12"), std::invalid_argument);
+    }
+}
@@ -0,0 +1,42 @@
+#include <catch2/catch_test_macros.hpp>
+#include "epicchaincpp/utils/thread_pool.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace epicchaincpp;
+
+TEST_CASE("ThreadPool Tests", "[utils]") {
+    ThreadPool pool(3);
+    REQUIRE(pool.size() == 3);
+    
+    SECTION("Submit returns the result") {
+        auto future = pool.submit([]() { return 42; });
+        REQUIRE(future.get() == 42);
+    }
+    
+    SECTION("parallelFor visits every index once") {
+        std::vector<std::atomic<int>> visits(1000);
+        pool.parallelFor(visits.size(), [&visits](size_t i) { visits[i]++; });
+        for (const auto& count : visits) {
+            REQUIRE(count.load() == 1);
+        }
+    }
+    
+    SECTION("parallelFor rethrows the first exception") {
+        REQUIRE_THROWS_AS(pool.parallelFor(100, [](size_t i) {
+            if (i == 10) {
+                throw std::runtime_error("boom");
+            }
+        }), std::runtime_error);
+    }
+    
+    SECTION("parallelFor nested in a pool task") {
+        auto future = pool.submit([&pool]() {
+            std::atomic<size_t> sum(0);
+            pool.parallelFor(100, [&sum](size_t i) { sum += i; });
+            return sum.load();
+        });
+        REQUIRE(future.get() == 4950);
+    }
+}
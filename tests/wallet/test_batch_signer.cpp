@@ -0,0 +1,115 @@
+#include <catch2/catch_test_macros.hpp>
+#include "epicchaincpp/wallet/batch_signer.hpp"
+#include "epicchaincpp/wallet/wallet.hpp"
+#include "epicchaincpp/wallet/account.hpp"
+#include "epicchaincpp/transaction/transaction.hpp"
+#include "epicchaincpp/transaction/signer.hpp"
+#include "epicchaincpp/transaction/witness.hpp"
+#include "epicchaincpp/transaction/witness_scope.hpp"
+#include "epicchaincpp/crypto/ec_key_pair.hpp"
+#include "epicchaincpp/crypto/ecdsa_signature.hpp"
+#include "epicchaincpp/utils/thread_pool.hpp"
+#include <memory>
+#include <vector>
+
+using namespace epicchaincpp;
+
+namespace {
+
+SharedPtr<Transaction> makeTransaction(uint32_t nonce, const std::vector<SharedPtr<Account>>& signers) {
+    auto tx = std::make_shared<Transaction>();
+    tx->setNonce(nonce);
+    tx->setValidUntilBlock(1000);
+    tx->setScript(Bytes{0x11, 0x40});
+    for (const auto& account : signers) {
+        tx->addSigner(std::make_shared<Signer>(account->getScriptHash(), WitnessScope::CALLED_BY_ENTRY));
+    }
+    return tx;
+}
+
+bool isSignedBy(const Transaction& tx, size_t index, const SharedPtr<Account>& account) {
+    const auto& witness = tx.getWitnesses().at(index);
+    const Bytes& invocation = witness->getInvocationScript();
+    if (invocation.size() < 64 || witness->getVerificationScript() != account->getVerificationScript()) {
+        return false;
+    }
+    auto signature = std::make_shared<ECDSASignature>(Bytes(invocation.end() - 64, invocation.end()));
+    return account->getKeyPair()->getPublicKey()->verify(tx.getHashData(), signature);
+}
+
+} // namespace
+
+TEST_CASE("BatchSigner Tests", "[wallet]") {
+    auto wallet = std::make_shared<Wallet>();
+    auto alice = Account::create("alice");
+    auto bob = Account::create("bob");
+    auto stranger = Account::create("stranger");
+    wallet->addAccount(alice);
+    wallet->addAccount(bob);
+    BatchSigner signer(wallet, std::make_shared<ThreadPool>(3));
+    
+    SECTION("Signs every transaction in input order") {
+        std::vector<SharedPtr<Transaction>> transactions;
+        for (uint32_t i = 0; i < 50; ++i) {
+            transactions.push_back(makeTransaction(i, {i % 2 == 0 ? alice : bob}));
+        }
+        
+        auto results = signer.sign(transactions);
+        REQUIRE(results.size() == transactions.size());
+        for (size_t i = 0; i < results.size(); ++i) {
+            REQUIRE(results[i].succeeded());
+            REQUIRE(results[i].transaction == transactions[i]);
+            REQUIRE(transactions[i]->getWitnesses().size() == 1);
+            REQUIRE(isSignedBy(*transactions[i], 0, i % 2 == 0 ? alice : bob));
+        }
+    }
+    
+    SECTION("Witnesses follow signer order") {
+        auto tx = makeTransaction(1, {bob, alice});
+        auto results = signer.sign(std::vector<SharedPtr<Transaction>>{tx});
+        REQUIRE(results[0].succeeded());
+        REQUIRE(tx->getWitnesses().size() == 2);
+        REQUIRE(isSignedBy(*tx, 0, bob));
+        REQUIRE(isSignedBy(*tx, 1, alice));
+    }
+    
+    SECTION("Failures are reported per transaction") {
+        auto good = makeTransaction(1, {alice});
+        auto unknown = makeTransaction(2, {alice, stranger});
+        auto unsignedTx = makeTransaction(3, {});
+        
+        auto results = signer.sign(std::vector<SharedPtr<Transaction>>{good, unknown, nullptr, unsignedTx});
+        REQUIRE(results.size() == 4);
+        REQUIRE(results[0].succeeded());
+        REQUIRE_FALSE(results[1].succeeded());
+        REQUIRE(results[1].error.find(stranger->getAddress()) != std::string::npos);
+        REQUIRE(unknown->getWitnesses().empty());
+        REQUIRE_FALSE(results[2].succeeded());
+        REQUIRE_FALSE(results[3].succeeded());
+    }
+    
+    SECTION("Locked accounts cannot sign") {
+        auto carol = Account::create("carol");
+        wallet->addAccount(carol);
+        carol->lock("password");
+        auto results = signer.sign(std::vector<SharedPtr<Transaction>>{makeTransaction(1, {carol})});
+        REQUIRE_FALSE(results[0].succeeded());
+    }
+    
+    SECTION("Already signed transactions are rejected") {
+        auto tx = makeTransaction(1, {alice});
+        REQUIRE(signer.sign(std::vector<SharedPtr<Transaction>>{tx})[0].succeeded());
+        REQUIRE_FALSE(signer.sign(std::vector<SharedPtr<Transaction>>{tx})[0].succeeded());
+        REQUIRE(tx->getWitnesses().size() == 1);
+    }
+    
+    SECTION("Signing copies leaves the input untouched") {
+        std::vector<Transaction> transactions = {*makeTransaction(1, {alice}), *makeTransaction(2, {bob})};
+        auto results = signer.sign(transactions);
+        REQUIRE(results.size() == 2);
+        REQUIRE(results[0].succeeded());
+        REQUIRE(results[1].succeeded());
+        REQUIRE(transactions[0].getWitnesses().empty());
+        REQUIRE(isSignedBy(*results[1].transaction, 0, bob));
+    }
+}
@@ -4,6 +4,7 @@
 #include "epicchaincpp/crypto/ec_key_pair.hpp"
 #include "epicchaincpp/types/hash160.hpp"
 #include "epicchaincpp/utils/hex.hpp"
+#include "epicchaincpp/exceptions.hpp"
 #include <memory>
 #include <string>
 
@@ -335,4 +336,90 @@ TEST_CASE("Wallet Tests", "[wallet]") {
         // Clean up
         std::remove(filepath.c_str());
     }
+    
+    SECTION("Encrypted wallet decrypted in bulk or on first use") {
+        std::string filepath = "/tmp/test_bulk_wallet.json";
+        std::string password = "SecurePassword123";
+        
+        std::vector<std::string> addresses;
+        std::vector<std::string> wifs;
+        {
+            Wallet wallet("Bulk Wallet", "1.0");
+            for (int i = 0; i < 3; ++i) {
+                auto account = wallet.createAccount("Account " + std::to_string(i));
+                addresses.push_back(account->getAddress());
+                wifs.push_back(account->exportWIF());
+            }
+            XEP2BulkOptions options;
+            options.threads = 2;
+            wallet.save(filepath, password, options);
+        }
+        
+        // Loading with decryption in parallel keeps the accounts locked, as before
+        {
+            size_t reports = 0;
+            WalletLoadOptions options;
+            options.xep2.onProgress = [&](const XEP2BulkProgress&) { reports++; };
+            auto wallet = Wallet::load(filepath, password, options);
+            REQUIRE(reports == 3);
+            REQUIRE(wallet->size() == 3);
+            for (const auto& address : addresses) {
+                REQUIRE(wallet->getAccount(address) != nullptr);
+                REQUIRE(wallet->getAccount(address)->isLocked());
+            }
+            REQUIRE_THROWS(Wallet::load(filepath, "WrongPassword", options));
+        }
+        
+        // Keeping the decrypted keys returns the accounts unlocked
+        {
+            WalletLoadOptions options;
+            options.keepDecryptedKeys = true;
+            auto wallet = Wallet::load(filepath, password, options);
+            REQUIRE(wallet->size() == 3);
+            for (size_t i = 0; i < addresses.size(); ++i) {
+                auto account = wallet->getAccount(addresses[i]);
+                REQUIRE(!account->isLocked());
+                REQUIRE(account->exportWIF() == wifs[i]);
+            }
+            REQUIRE(wallet->unlockAll(password) == 0);
+        }
+        
+        // Loading with decryption on first use needs no password until the accounts are unlocked
+        {
+            WalletLoadOptions options;
+            options.decryptOnFirstUse = true;
+            auto wallet = Wallet::load(filepath, "", options);
+            REQUIRE(wallet->size() == 3);
+            for (const auto& account : wallet->getAccounts()) {
+                REQUIRE(account->isLocked());
+                REQUIRE_THROWS_AS(account->sign(Bytes(32, 1)), WalletException);
+            }
+            
+            REQUIRE(wallet->unlockAll("WrongPassword") == 0);
+            REQUIRE(wallet->unlockAll(password) == 3);
+            for (size_t i = 0; i < addresses.size(); ++i) {
+                auto account = wallet->getAccount(addresses[i]);
+                REQUIRE(!account->isLocked());
+                REQUIRE(account->exportWIF() == wifs[i]);
+            }
+            REQUIRE(wallet->unlockAll(password) == 0);
+        }
+        
+        std::remove(filepath.c_str());
+    }
+    
+    SECTION("Locked account rejects a key that is not its own") {
+        auto keyPair = std::make_shared<ECKeyPair>(ECKeyPair::generate());
+        auto other = std::make_shared<ECKeyPair>(ECKeyPair::generate());
+        std::string xep2 = XEP2::encrypt(*keyPair, "pw", ScryptParams::getLight());
+        Hash160 scriptHash = Hash160::fromPublicKey(keyPair->getPublicKey()->getEncoded());
+        
+        auto account = Account::fromXEP2(xep2, scriptHash, "Locked");
+        REQUIRE(account->isLocked());
+        REQUIRE(account->getAddress() == scriptHash.toAddress());
+        REQUIRE(!account->unlock(other));
+        REQUIRE(account->isLocked());
+        REQUIRE(account->unlock(keyPair));
+        REQUIRE(!account->isLocked());
+    }
 }
\ No newline at end of file